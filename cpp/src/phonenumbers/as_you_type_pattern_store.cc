@@ -0,0 +1,381 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/as_you_type_pattern_store.h"
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+
+#include "phonenumbers/base/logging.h"
+#include "phonenumbers/digit_automaton.h"
+#include "phonenumbers/phonemetadata.pb.h"
+#include "phonenumbers/phonenumberutil.h"
+#include "phonenumbers/regexp_adapter.h"
+#include "phonenumbers/regexp_cache.h"
+#include "phonenumbers/regexp_factory.h"
+#include "phonenumbers/stl_util.h"
+#include "phonenumbers/stringutil.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+
+namespace {
+
+// A pattern that is used to match character classes in regular expressions.
+// An example of a character class is [1-4].
+const char kCharacterClassPattern[] = "\\[([^\\[\\]])*\\]";
+
+// The number from which the formatting templates are created, longer than any
+// number the formats can format.
+const char kLongestPhoneNumber[] = "999999999999999";
+
+// A set of characters that, if found in a national prefix formatting rules, are
+// an indicator to us that we should separate the national prefix from the
+// number when formatting.
+const char kNationalPrefixSeparatorsPattern[] = "[- ]";
+
+// Replaces any standalone digit in the pattern (not any inside a {} grouping)
+// with \d. This function replaces the standalone digit regex used in the Java
+// version which is currently not supported by RE2 because it uses a special
+// construct (?=).
+void ReplacePatternDigits(string* pattern) {
+  DCHECK(pattern);
+  string new_pattern;
+  // This is needed since sometimes there is more than one digit in between the
+  // curly braces.
+  bool is_in_braces = false;
+
+  for (string::const_iterator it = pattern->begin(); it != pattern->end();
+       ++it) {
+    const char current_char = *it;
+
+    if (isdigit(current_char)) {
+      if (is_in_braces) {
+        new_pattern += current_char;
+      } else {
+        new_pattern += "\\d";
+      }
+    } else {
+      new_pattern += current_char;
+      if (current_char == '{') {
+        is_in_braces = true;
+      } else if (current_char == '}') {
+        is_in_braces = false;
+      }
+    }
+  }
+  pattern->assign(new_pattern);
+}
+
+// Returns the automaton of pattern, or NULL if it can't be compiled or if it
+// isn't prefix-free, in which case the length of the prefix its regular
+// expression consumes can't be told by the automaton.
+const DigitAutomaton* CreatePrefixFreeAutomaton(const string& pattern) {
+  const DigitAutomaton* const automaton = DigitAutomaton::Create(pattern);
+  if (automaton && !automaton->IsPrefixFree()) {
+    delete automaton;
+    return NULL;
+  }
+  return automaton;
+}
+
+PhoneMetadata* CreateEmptyMetadata() {
+  PhoneMetadata* const metadata = new PhoneMetadata();
+  metadata->set_international_prefix("NA");
+  return metadata;
+}
+
+}  // namespace
+
+COMPILE_ASSERT(AsYouTypePatternStore::kMaxFormats == DigitAutomaton::kMaxTags,
+               one_automaton_tag_per_format);
+
+const int AsYouTypePatternStore::kMaxFormats;
+const char AsYouTypePatternStore::kDigitPlaceholder[] = "\xE2\x80\x88";
+
+// The automata of the patterns of a list of formats, the i-th format being
+// tagged with the bit (1 << i). The leading digits automaton at index i matches
+// the leading digits patterns at index i of the formats, or their last leading
+// digits pattern if they have fewer, and the automaton of the largest index is
+// used for all the larger indices. The leading digits patterns and the patterns
+// are compiled independently, and the automata which can't be compiled are
+// left empty.
+class AsYouTypePatternStore::FormatAutomata {
+ public:
+  explicit FormatAutomata(const RepeatedPtrField<NumberFormat>& formats) {
+    DCHECK_GE(kMaxFormats, formats.size());
+    CompileLeadingDigitsPatterns(formats);
+    vector<string> patterns;
+    for (RepeatedPtrField<NumberFormat>::const_iterator it = formats.begin();
+         it != formats.end(); ++it) {
+      patterns.push_back(it->pattern());
+    }
+    pattern_automaton_.reset(DigitAutomaton::Create(patterns));
+  }
+
+  ~FormatAutomata() {
+    STLDeleteElements(&leading_digits_automata_);
+  }
+
+  bool MatchLeadingDigits(int leading_digits_index,
+                          const string& leading_digits,
+                          uint32* matching_formats) const {
+    if (leading_digits_automata_.empty()) {
+      return false;
+    }
+    const int size = static_cast<int>(leading_digits_automata_.size());
+    *matching_formats =
+        leading_digits_automata_[std::min(leading_digits_index, size - 1)]
+            ->PrefixMatchTags(leading_digits);
+    return true;
+  }
+
+  bool MatchPatterns(const string& national_number,
+                     uint32* matching_formats) const {
+    if (!pattern_automaton_.get()) {
+      return false;
+    }
+    *matching_formats = pattern_automaton_->FullMatchTags(national_number);
+    return true;
+  }
+
+ private:
+  void CompileLeadingDigitsPatterns(
+      const RepeatedPtrField<NumberFormat>& formats) {
+    int max_size = 1;
+    for (RepeatedPtrField<NumberFormat>::const_iterator it = formats.begin();
+         it != formats.end(); ++it) {
+      max_size = std::max(max_size, it->leading_digits_pattern_size());
+    }
+    for (int index = 0; index < max_size; ++index) {
+      vector<string> patterns;
+      for (RepeatedPtrField<NumberFormat>::const_iterator it = formats.begin();
+           it != formats.end(); ++it) {
+        const int size = it->leading_digits_pattern_size();
+        // The formats without leading digits patterns are kept whatever the
+        // number starts with, which is what the empty pattern does.
+        patterns.push_back(
+            size > 0 ? it->leading_digits_pattern(std::min(index, size - 1))
+                     : "");
+      }
+      const DigitAutomaton* const automaton = DigitAutomaton::Create(patterns);
+      if (!automaton) {
+        STLDeleteElements(&leading_digits_automata_);
+        return;
+      }
+      leading_digits_automata_.push_back(automaton);
+    }
+  }
+
+  vector<const DigitAutomaton*> leading_digits_automata_;
+  scoped_ptr<const DigitAutomaton> pattern_automaton_;
+
+  DISALLOW_COPY_AND_ASSIGN(FormatAutomata);
+};
+
+AsYouTypePatternStore::FormatPatterns::FormatPatterns()
+    : leading_digits_patterns(),
+      pattern(NULL),
+      formatting_template(),
+      max_digits(0),
+      separate_national_prefix(false),
+      eligible(false),
+      national_prefix_rule_has_first_group_only(false) {}
+
+AsYouTypePatternStore::RegionPatterns::RegionPatterns()
+    : international_prefix(NULL),
+      national_prefix_for_parsing(NULL),
+      international_prefix_automaton(),
+      national_prefix_for_parsing_automaton() {}
+
+AsYouTypePatternStore::RegionPatterns::~RegionPatterns() {}
+
+AsYouTypePatternStore::AsYouTypePatternStore(const PhoneNumberUtil& phone_util)
+    : phone_util_(phone_util),
+      regexp_factory_(new RegExpFactory()),
+      regexp_cache_(new RegExpCache(*regexp_factory_, 256)),
+      character_class_pattern_(
+          regexp_factory_->CreateRegExp(kCharacterClassPattern)),
+      national_prefix_separators_pattern_(
+          regexp_factory_->CreateRegExp(kNationalPrefixSeparatorsPattern)),
+      empty_metadata_(CreateEmptyMetadata()),
+      format_patterns_(
+          new ReadMostlyCache<const NumberFormat*, FormatPatterns>(256)),
+      region_patterns_(
+          new ReadMostlyCache<const PhoneMetadata*, RegionPatterns>(64)),
+      format_automata_(
+          new ReadMostlyCache<const RepeatedPtrField<NumberFormat>*,
+                              FormatAutomata>(64)) {}
+
+AsYouTypePatternStore::~AsYouTypePatternStore() {}
+
+const AsYouTypePatternStore::FormatPatterns&
+AsYouTypePatternStore::GetFormatPatterns(const NumberFormat& format) const {
+  const FormatPatterns* patterns;
+  if (format_patterns_->Find(&format, &patterns)) {
+    return *patterns;
+  }
+  FormatPatterns* const new_patterns = new FormatPatterns();
+  for (int i = 0; i < format.leading_digits_pattern_size(); ++i) {
+    new_patterns->leading_digits_patterns.push_back(
+        &regexp_cache_->GetRegExp(format.leading_digits_pattern(i)));
+  }
+  new_patterns->pattern = &regexp_cache_->GetRegExp(format.pattern());
+  // The formatter doesn't format numbers when the pattern contains "|", e.g.
+  // (20|3)\d{4}.
+  if (format.pattern().find('|') == string::npos) {
+    CreateFormattingTemplate(format, new_patterns);
+  }
+  new_patterns->separate_national_prefix =
+      national_prefix_separators_pattern_->PartialMatch(
+          format.national_prefix_formatting_rule());
+  new_patterns->eligible =
+      phone_util_.IsFormatEligibleForAsYouTypeFormatter(format.format());
+  new_patterns->national_prefix_rule_has_first_group_only =
+      phone_util_.FormattingRuleHasFirstGroupOnly(
+          format.national_prefix_formatting_rule());
+  return *format_patterns_->Insert(&format, new_patterns);
+}
+
+void AsYouTypePatternStore::CreateFormattingTemplate(
+    const NumberFormat& format,
+    FormatPatterns* patterns) const {
+  DCHECK(patterns);
+  string number_pattern(format.pattern());
+  // Replace anything in the form of [..] with \d.
+  character_class_pattern_->GlobalReplace(&number_pattern, "\\\\d");
+  // Replace any standalone digit (not the one in d{}) with \d.
+  ReplacePatternDigits(&number_pattern);
+
+  // Creates a phone number consisting only of the digit 9 that matches the
+  // number pattern by applying the pattern, with its groups transformed from
+  // "(...)(...)(...)" to "(.........)", to kLongestPhoneNumber. The patterns
+  // are only compiled for this, so they aren't cached.
+  string longest_number_pattern(number_pattern);
+  strrmm(&longest_number_pattern, "()");
+  const scoped_ptr<const RegExp> longest_number_regexp(
+      regexp_factory_->CreateRegExp(
+          StrCat("(", longest_number_pattern, ")")));
+  const scoped_ptr<RegExpInput> input(
+      regexp_factory_->CreateInput(kLongestPhoneNumber));
+  string a_phone_number;
+  if (!longest_number_regexp->Consume(input.get(), &a_phone_number)) {
+    return;
+  }
+  patterns->max_digits = a_phone_number.length();
+  // Formats the number according to the format.
+  const scoped_ptr<const RegExp> number_regexp(
+      regexp_factory_->CreateRegExp(number_pattern));
+  number_regexp->GlobalReplace(&a_phone_number, format.format());
+  // Replaces each digit with character kDigitPlaceholder.
+  GlobalReplaceSubstring("9", kDigitPlaceholder, &a_phone_number);
+  patterns->formatting_template.swap(a_phone_number);
+}
+
+const AsYouTypePatternStore::RegionPatterns&
+AsYouTypePatternStore::GetRegionPatterns(const PhoneMetadata& metadata) const {
+  const RegionPatterns* patterns;
+  if (region_patterns_->Find(&metadata, &patterns)) {
+    return *patterns;
+  }
+  RegionPatterns* const new_patterns = new RegionPatterns();
+  new_patterns->international_prefix = &regexp_cache_->GetRegExp(
+      StrCat("\\+|", metadata.international_prefix()));
+  new_patterns->international_prefix_automaton.reset(
+      CreatePrefixFreeAutomaton(metadata.international_prefix()));
+  if (metadata.has_national_prefix_for_parsing()) {
+    new_patterns->national_prefix_for_parsing =
+        &regexp_cache_->GetRegExp(metadata.national_prefix_for_parsing());
+    new_patterns->national_prefix_for_parsing_automaton.reset(
+        CreatePrefixFreeAutomaton(metadata.national_prefix_for_parsing()));
+  }
+  return *region_patterns_->Insert(&metadata, new_patterns);
+}
+
+const AsYouTypePatternStore::FormatAutomata*
+AsYouTypePatternStore::GetFormatAutomata(
+    const RepeatedPtrField<NumberFormat>& formats) const {
+  const FormatAutomata* automata;
+  if (!format_automata_->Find(&formats, &automata)) {
+    automata = format_automata_->Insert(
+        &formats,
+        formats.size() <= kMaxFormats ? new FormatAutomata(formats) : NULL);
+  }
+  return automata;
+}
+
+bool AsYouTypePatternStore::MatchLeadingDigits(
+    const RepeatedPtrField<NumberFormat>& formats,
+    int leading_digits_index,
+    const string& leading_digits,
+    uint32* matching_formats) const {
+  DCHECK(matching_formats);
+  DCHECK_GE(leading_digits_index, 0);
+  const FormatAutomata* const automata = GetFormatAutomata(formats);
+  return automata && IsAsciiDigitString(leading_digits) &&
+      automata->MatchLeadingDigits(leading_digits_index, leading_digits,
+                                   matching_formats);
+}
+
+bool AsYouTypePatternStore::MatchPatterns(
+    const RepeatedPtrField<NumberFormat>& formats,
+    const string& national_number,
+    uint32* matching_formats) const {
+  DCHECK(matching_formats);
+  const FormatAutomata* const automata = GetFormatAutomata(formats);
+  return automata && IsAsciiDigitString(national_number) &&
+      automata->MatchPatterns(national_number, matching_formats);
+}
+
+bool AsYouTypePatternStore::MatchInternationalPrefix(
+    const PhoneMetadata& metadata,
+    const string& number,
+    int* prefix_length) const {
+  DCHECK(prefix_length);
+  // The plus sign is the first alternative of the international_prefix
+  // pattern.
+  if (!number.empty() && number[0] == '+') {
+    *prefix_length = 1;
+    return true;
+  }
+  const DigitAutomaton* const automaton =
+      GetRegionPatterns(metadata).international_prefix_automaton.get();
+  if (!automaton || !IsAsciiDigitString(number)) {
+    return false;
+  }
+  *prefix_length =
+      automaton->ShortestPrefixMatchLength(number.data(), number.length());
+  return true;
+}
+
+bool AsYouTypePatternStore::MatchNationalPrefixForParsing(
+    const PhoneMetadata& metadata,
+    const string& national_number,
+    int* prefix_length) const {
+  DCHECK(prefix_length);
+  const DigitAutomaton* const automaton =
+      GetRegionPatterns(metadata).national_prefix_for_parsing_automaton.get();
+  if (!automaton || !IsAsciiDigitString(national_number)) {
+    return false;
+  }
+  *prefix_length = automaton->ShortestPrefixMatchLength(
+      national_number.data(), national_number.length());
+  return true;
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
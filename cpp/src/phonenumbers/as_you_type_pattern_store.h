@@ -0,0 +1,213 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// The patterns AsYouTypeFormatter compiles from the metadata, shared by all the
+// formatters of the process. PhoneNumberUtil owns a single store, and every
+// formatter it creates draws the patterns of the formats and regions it uses
+// from it, so that the patterns are compiled once per process instead of once
+// per formatter and creating a formatter costs almost nothing. The formatting
+// templates of the formats, which only depend on the metadata, are created
+// along with their patterns, so that choosing a template while typing doesn't
+// run any regular expression. The leading digits patterns and the patterns of
+// the lists of formats, and the prefixes of the regions, are compiled into
+// automata, which narrow down the formats a number can be formatted with,
+// choose the format of a complete number and extract its prefixes without
+// running any regular expression or allocating any memory either.
+//
+// The patterns are compiled when first requested and cached by the address of
+// the metadata they are compiled from, which must outlive the store. Looking
+// up patterns which are already compiled doesn't take any lock, and the store
+// is safe for concurrent use.
+
+#ifndef I18N_PHONENUMBERS_AS_YOU_TYPE_PATTERN_STORE_H_
+#define I18N_PHONENUMBERS_AS_YOU_TYPE_PATTERN_STORE_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/repeated_field.h>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/base/memory/scoped_ptr.h"
+#include "phonenumbers/read_mostly_cache.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using google::protobuf::RepeatedPtrField;
+using std::string;
+using std::vector;
+
+class AbstractRegExpFactory;
+class DigitAutomaton;
+class NumberFormat;
+class PhoneMetadata;
+class PhoneNumberUtil;
+class RegExp;
+class RegExpCache;
+
+class AsYouTypePatternStore {
+ public:
+  // The placeholder of the digits in the formatting templates, the punctuation
+  // space U+2008.
+  static const char kDigitPlaceholder[];
+
+  // The maximum number of formats of the lists of formats whose patterns can be
+  // compiled into automata.
+  static const int kMaxFormats = 32;
+
+  // The patterns compiled from a NumberFormat.
+  struct FormatPatterns {
+    FormatPatterns();
+
+    // The leading digits patterns of the format.
+    vector<const RegExp*> leading_digits_patterns;
+    // The pattern of the format.
+    const RegExp* pattern;
+    // The longest number the format can format, encoded in UTF-8, with its
+    // digits replaced by kDigitPlaceholder, or an empty string if no template
+    // can be created for the format, e.g. when its pattern contains
+    // alternatives like (20|3)\d{4}.
+    string formatting_template;
+    // The number of digits of the formatting template.
+    size_t max_digits;
+    // True if the national prefix formatting rule of the format separates the
+    // national prefix from the rest of the number with a space or a dash.
+    bool separate_national_prefix;
+    // See PhoneNumberUtil::IsFormatEligibleForAsYouTypeFormatter().
+    bool eligible;
+    // See PhoneNumberUtil::FormattingRuleHasFirstGroupOnly().
+    bool national_prefix_rule_has_first_group_only;
+  };
+
+  // The patterns compiled from the metadata of a region.
+  struct RegionPatterns {
+    RegionPatterns();
+    ~RegionPatterns();
+
+    // Matches the plus sign or the international prefix of the region.
+    const RegExp* international_prefix;
+    // The national prefix for parsing of the region, or NULL if it has none.
+    const RegExp* national_prefix_for_parsing;
+    // The automata of the international prefix and of the national prefix for
+    // parsing of the region, or NULL if they can't be compiled or aren't
+    // prefix-free, see DigitAutomaton::IsPrefixFree().
+    scoped_ptr<const DigitAutomaton> international_prefix_automaton;
+    scoped_ptr<const DigitAutomaton> national_prefix_for_parsing_automaton;
+
+   private:
+    DISALLOW_COPY_AND_ASSIGN(RegionPatterns);
+  };
+
+  // The flags of the formats are computed with phone_util, which must outlive
+  // the store.
+  explicit AsYouTypePatternStore(const PhoneNumberUtil& phone_util);
+  ~AsYouTypePatternStore();
+
+  const AbstractRegExpFactory& regexp_factory() const {
+    return *regexp_factory_;
+  }
+
+  // Returns the metadata used by the formatters of unsupported regions, which
+  // only format numbers entered with a plus sign.
+  const PhoneMetadata& empty_metadata() const { return *empty_metadata_; }
+
+  const FormatPatterns& GetFormatPatterns(const NumberFormat& format) const;
+
+  const RegionPatterns& GetRegionPatterns(const PhoneMetadata& metadata) const;
+
+  // Sets matching_formats to the set of formats, the i-th format being the bit
+  // (1 << i), whose leading digits pattern at index leading_digits_index, or
+  // whose last leading digits pattern if they have fewer, matches a prefix of
+  // leading_digits, and returns true. The formats without leading digits
+  // patterns always match. All the formats are matched in a single scan of the
+  // first digits of leading_digits.
+  //
+  // Returns false if the leading digits patterns of formats can't be compiled
+  // into automata, if there are more than kMaxFormats formats, or if
+  // leading_digits contains characters other than ASCII digits, in which case
+  // the leading digits patterns of GetFormatPatterns() have to be used.
+  bool MatchLeadingDigits(const RepeatedPtrField<NumberFormat>& formats,
+                          int leading_digits_index,
+                          const string& leading_digits,
+                          uint32* matching_formats) const;
+
+  // Sets matching_formats to the set of formats, the i-th format being the bit
+  // (1 << i), whose pattern matches national_number in its entirety, and
+  // returns true. Returns false if the patterns of formats can't be compiled
+  // into automata, if there are more than kMaxFormats formats, or if
+  // national_number contains characters other than ASCII digits, in which case
+  // the patterns of GetFormatPatterns() have to be used.
+  bool MatchPatterns(const RepeatedPtrField<NumberFormat>& formats,
+                     const string& national_number,
+                     uint32* matching_formats) const;
+
+  // Sets prefix_length to the length in bytes of the plus sign or of the
+  // international prefix of metadata number starts with, or to -1 if it starts
+  // with neither, and returns true. Returns false if number doesn't start with
+  // a plus sign and either the international prefix has no automaton or number
+  // contains characters other than ASCII digits, in which case the
+  // international_prefix pattern of GetRegionPatterns() has to be used.
+  bool MatchInternationalPrefix(const PhoneMetadata& metadata,
+                                const string& number,
+                                int* prefix_length) const;
+
+  // Sets prefix_length to the length of the national prefix for parsing of
+  // metadata national_number starts with, or to -1 if it doesn't start with
+  // it, and returns true. Returns false if the national prefix for parsing has
+  // no automaton or if national_number contains characters other than ASCII
+  // digits, in which case the national_prefix_for_parsing pattern of
+  // GetRegionPatterns() has to be used.
+  bool MatchNationalPrefixForParsing(const PhoneMetadata& metadata,
+                                     const string& national_number,
+                                     int* prefix_length) const;
+
+ private:
+  class FormatAutomata;
+
+  // Returns the automata of formats, or NULL if there are more than
+  // kMaxFormats formats.
+  const FormatAutomata* GetFormatAutomata(
+      const RepeatedPtrField<NumberFormat>& formats) const;
+
+  // Sets the formatting template of patterns and its number of digits, if a
+  // template can be created for format.
+  void CreateFormattingTemplate(const NumberFormat& format,
+                                FormatPatterns* patterns) const;
+
+  const PhoneNumberUtil& phone_util_;
+  const scoped_ptr<const AbstractRegExpFactory> regexp_factory_;
+  // Shares the compiled patterns between the formats and regions using the
+  // same patterns.
+  const scoped_ptr<RegExpCache> regexp_cache_;
+  const scoped_ptr<const RegExp> character_class_pattern_;
+  const scoped_ptr<const RegExp> national_prefix_separators_pattern_;
+  const scoped_ptr<const PhoneMetadata> empty_metadata_;
+  const scoped_ptr<ReadMostlyCache<const NumberFormat*, FormatPatterns> >
+      format_patterns_;
+  const scoped_ptr<ReadMostlyCache<const PhoneMetadata*, RegionPatterns> >
+      region_patterns_;
+  // The lists of more than kMaxFormats formats are mapped to NULL.
+  const scoped_ptr<ReadMostlyCache<const RepeatedPtrField<NumberFormat>*,
+                                   FormatAutomata> >
+      format_automata_;
+
+  DISALLOW_COPY_AND_ASSIGN(AsYouTypePatternStore);
+};
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_AS_YOU_TYPE_PATTERN_STORE_H_
@@ -15,19 +15,22 @@
 #include "phonenumbers/asyoutypeformatter.h"
 
 #include <math.h>
-#include <cctype>
-#include <list>
+#include <string.h>
+#include <algorithm>
 #include <string>
 
 #include <google/protobuf/message_lite.h>
 
+#include "phonenumbers/as_you_type_pattern_store.h"
 #include "phonenumbers/base/logging.h"
 #include "phonenumbers/base/memory/scoped_ptr.h"
+#include "phonenumbers/default_logger.h"
+#include "phonenumbers/normalize_digits.h"
 #include "phonenumbers/phonemetadata.pb.h"
 #include "phonenumbers/phonenumberutil.h"
-#include "phonenumbers/regexp_cache.h"
-#include "phonenumbers/regexp_factory.h"
+#include "phonenumbers/regexp_adapter.h"
 #include "phonenumbers/stringutil.h"
+#include "phonenumbers/template_formatter.h"
 #include "phonenumbers/unicodestring.h"
 
 namespace i18n {
@@ -39,95 +42,25 @@ namespace {
 
 const char kPlusSign = '+';
 
-// A pattern that is used to match character classes in regular expressions.
-// An example of a character class is [1-4].
-const char kCharacterClassPattern[] = "\\[([^\\[\\]])*\\]";
-
 // This is the minimum length of national number accrued that is required to
 // trigger the formatter. The first element of the leading_digits_pattern of
 // each number_format contains a regular expression that matches up to this
 // number of digits.
 const size_t kMinLeadingDigitsLength = 3;
 
-// The digits that have not been entered yet will be represented by a \u2008,
-// the punctuation space.
-const char kDigitPlaceholder[] = "\xE2\x80\x88"; /* " " */
-
 // Character used when appropriate to separate a prefix, such as a long NDD or a
 // country calling code, from the national number.
 const char kSeparatorBeforeNationalNumber = ' ';
 
-// A set of characters that, if found in a national prefix formatting rules, are
-// an indicator to us that we should separate the national prefix from the
-// number when formatting.
-const char kNationalPrefixSeparatorsPattern[] = "[- ]";
-
-// Replaces any standalone digit in the pattern (not any inside a {} grouping)
-// with \d. This function replaces the standalone digit regex used in the Java
-// version which is currently not supported by RE2 because it uses a special
-// construct (?=).
-void ReplacePatternDigits(string* pattern) {
-  DCHECK(pattern);
-  string new_pattern;
-  // This is needed since sometimes there is more than one digit in between the
-  // curly braces.
-  bool is_in_braces = false;
-
-  for (string::const_iterator it = pattern->begin(); it != pattern->end();
-       ++it) {
-    const char current_char = *it;
-
-    if (isdigit(current_char)) {
-      if (is_in_braces) {
-        new_pattern += current_char;
-      } else {
-        new_pattern += "\\d";
-      }
-    } else {
-      new_pattern += current_char;
-      if (current_char == '{') {
-        is_in_braces = true;
-      } else if (current_char == '}') {
-        is_in_braces = false;
-      }
-    }
-  }
-  pattern->assign(new_pattern);
-}
-
-// Matches all the groups contained in 'input' against 'pattern'.
-void MatchAllGroups(const string& pattern,
-                    const string& input,
-                    const AbstractRegExpFactory& regexp_factory,
-                    RegExpCache* cache,
-                    string* group) {
-  DCHECK(cache);
-  DCHECK(group);
-  string new_pattern(pattern);
-
-  // Transforms pattern "(...)(...)(...)" to "(.........)".
-  strrmm(&new_pattern, "()");
-  new_pattern = StrCat("(", new_pattern, ")");
-
-  const scoped_ptr<RegExpInput> consume_input(
-      regexp_factory.CreateInput(input));
-  bool status =
-      cache->GetRegExp(new_pattern).Consume(consume_input.get(), group);
-  DCHECK(status);
-}
-
-PhoneMetadata CreateEmptyMetadata() {
-  PhoneMetadata metadata;
-  metadata.set_international_prefix("NA");
-  return metadata;
+// Returns the set of formats with the format at index i only.
+inline uint32 FormatBit(int i) {
+  return 1U << i;
 }
 
 }  // namespace
 
 AsYouTypeFormatter::AsYouTypeFormatter(const string& region_code)
-    : regexp_factory_(new RegExpFactory()),
-      regexp_cache_(*regexp_factory_.get(), 64),
-      current_output_(),
+    : current_output_(),
       formatting_template_(),
       current_formatting_pattern_(),
       accrued_input_(),
@@ -137,8 +70,8 @@ AsYouTypeFormatter::AsYouTypeFormatter(const string& region_code)
       is_complete_number_(false),
       is_expecting_country_code_(false),
       phone_util_(*PhoneNumberUtil::GetInstance()),
+      pattern_store_(*phone_util_.as_you_type_pattern_store_),
       default_country_(region_code),
-      empty_metadata_(CreateEmptyMetadata()),
       default_metadata_(GetMetadataForRegion(region_code)),
       current_metadata_(default_metadata_),
       last_match_position_(0),
@@ -148,7 +81,10 @@ AsYouTypeFormatter::AsYouTypeFormatter(const string& region_code)
       should_add_space_after_national_prefix_(false),
       extracted_national_prefix_(),
       national_number_(),
-      possible_formats_() {
+      available_formats_(NULL),
+      possible_formats_(0),
+      formatted_national_number_(),
+      unformatted_input_() {
 }
 
 // The metadata needed by this class is the same for all regions sharing the
@@ -167,16 +103,18 @@ const PhoneMetadata* AsYouTypeFormatter::GetMetadataForRegion(
   // Set to a default instance of the metadata. This allows us to function with
   // an incorrect region code, even if formatting only works for numbers
   // specified with "+".
-  return &empty_metadata_;
+  return &pattern_store_.empty_metadata();
 }
 
 bool AsYouTypeFormatter::MaybeCreateNewTemplate() {
   // When there are multiple available formats, the formatter uses the first
   // format where a formatting template could be created.
-  for (list<const NumberFormat*>::const_iterator it = possible_formats_.begin();
-       it != possible_formats_.end(); ++it) {
-    DCHECK(*it);
-    const NumberFormat& number_format = **it;
+  uint32 formats = possible_formats_;
+  for (int i = 0; formats != 0; ++i, formats >>= 1) {
+    if (!(formats & 1)) {
+      continue;
+    }
+    const NumberFormat& number_format = available_formats_->Get(i);
     const string& pattern = number_format.pattern();
     if (current_formatting_pattern_ == pattern) {
       return false;
@@ -202,14 +140,27 @@ void AsYouTypeFormatter::GetAvailableFormats(const string& leading_digits) {
           : current_metadata_->number_format();
   bool national_prefix_used_by_country =
       current_metadata_->has_national_prefix();
-  for (RepeatedPtrField<NumberFormat>::const_iterator it = format_list.begin();
-       it != format_list.end(); ++it) {
+  available_formats_ = &format_list;
+  possible_formats_ = 0;
+  // The possible formats are a set of kMaxFormats bits, twice as many as the
+  // formats of any region. If the metadata outgrew it, the formats past the
+  // first kMaxFormats would never be used, so this is reported.
+  int num_formats = format_list.size();
+  if (num_formats > AsYouTypePatternStore::kMaxFormats) {
+    LOG(DFATAL) << "Only the first " << AsYouTypePatternStore::kMaxFormats
+                << " of the " << num_formats << " formats of region "
+                << current_metadata_->id() << " can be used.";
+    num_formats = AsYouTypePatternStore::kMaxFormats;
+  }
+  for (int i = 0; i < num_formats; ++i) {
+    const NumberFormat& format = format_list.Get(i);
+    const AsYouTypePatternStore::FormatPatterns& patterns =
+        pattern_store_.GetFormatPatterns(format);
     if (!national_prefix_used_by_country || is_complete_number_ ||
-        it->national_prefix_optional_when_formatting() ||
-        phone_util_.FormattingRuleHasFirstGroupOnly(
-            it->national_prefix_formatting_rule())) {
-      if (phone_util_.IsFormatEligibleForAsYouTypeFormatter(it->format())) {
-        possible_formats_.push_back(&*it);
+        format.national_prefix_optional_when_formatting() ||
+        patterns.national_prefix_rule_has_first_group_only) {
+      if (patterns.eligible) {
+        possible_formats_ |= FormatBit(i);
       }
     }
   }
@@ -218,101 +169,73 @@ void AsYouTypeFormatter::GetAvailableFormats(const string& leading_digits) {
 
 void AsYouTypeFormatter::NarrowDownPossibleFormats(
     const string& leading_digits) {
+  if (!possible_formats_) {
+    return;
+  }
   const int index_of_leading_digits_pattern =
       leading_digits.length() - kMinLeadingDigitsLength;
 
-  for (list<const NumberFormat*>::iterator it = possible_formats_.begin();
-       it != possible_formats_.end(); ) {
-    DCHECK(*it);
-    const NumberFormat& format = **it;
+  // The leading digits patterns of all the formats are usually matched at once
+  // by automata.
+  uint32 matching_formats;
+  if (pattern_store_.MatchLeadingDigits(*available_formats_,
+                                        index_of_leading_digits_pattern,
+                                        leading_digits, &matching_formats)) {
+    possible_formats_ &= matching_formats;
+    return;
+  }
+  uint32 formats = possible_formats_;
+  for (int i = 0; formats != 0; ++i, formats >>= 1) {
+    if (!(formats & 1)) {
+      continue;
+    }
+    const NumberFormat& format = available_formats_->Get(i);
     if (format.leading_digits_pattern_size() == 0) {
       // Keep everything that isn't restricted by leading digits.
-      ++it;
       continue;
     }
     int last_leading_digits_pattern =
         std::min(index_of_leading_digits_pattern,
                  format.leading_digits_pattern_size() - 1);
     const scoped_ptr<RegExpInput> input(
-        regexp_factory_->CreateInput(leading_digits));
-    if (!regexp_cache_.GetRegExp(format.leading_digits_pattern().Get(
-            last_leading_digits_pattern)).Consume(input.get())) {
-      it = possible_formats_.erase(it);
-      continue;
+        pattern_store_.regexp_factory().CreateInput(leading_digits));
+    if (!pattern_store_.GetFormatPatterns(format)
+             .leading_digits_patterns[last_leading_digits_pattern]
+             ->Consume(input.get())) {
+      possible_formats_ &= ~FormatBit(i);
     }
-    ++it;
   }
 }
 
 void AsYouTypeFormatter::SetShouldAddSpaceAfterNationalPrefix(
     const NumberFormat& format) {
-  static const scoped_ptr<const RegExp> national_prefix_separators_pattern(
-      regexp_factory_->CreateRegExp(kNationalPrefixSeparatorsPattern));
   should_add_space_after_national_prefix_ =
-      national_prefix_separators_pattern->PartialMatch(
-          format.national_prefix_formatting_rule());
+      pattern_store_.GetFormatPatterns(format).separate_national_prefix;
 }
 
 bool AsYouTypeFormatter::CreateFormattingTemplate(const NumberFormat& format) {
-  string number_pattern = format.pattern();
-
-  // The formatter doesn't format numbers when numberPattern contains "|", e.g.
+  const AsYouTypePatternStore::FormatPatterns& patterns =
+      pattern_store_.GetFormatPatterns(format);
+  // The formatter doesn't format numbers when the pattern contains "|", e.g.
   // (20|3)\d{4}. In those cases we quickly return.
-  if (number_pattern.find('|') != string::npos) {
+  if (patterns.formatting_template.empty()) {
     return false;
   }
-  // Replace anything in the form of [..] with \d.
-  static const scoped_ptr<const RegExp> character_class_pattern(
-      regexp_factory_->CreateRegExp(kCharacterClassPattern));
-  character_class_pattern->GlobalReplace(&number_pattern, "\\\\d");
-
-  // Replace any standalone digit (not the one in d{}) with \d.
-  ReplacePatternDigits(&number_pattern);
-
-  string number_format = format.format();
-  formatting_template_.remove();
-  UnicodeString temp_template;
-  GetFormattingTemplate(number_pattern, number_format, &temp_template);
-
-  if (temp_template.length() > 0) {
-    formatting_template_.append(temp_template);
-    return true;
-  }
-  return false;
-}
-
-void AsYouTypeFormatter::GetFormattingTemplate(
-    const string& number_pattern,
-    const string& number_format,
-    UnicodeString* formatting_template) {
-  DCHECK(formatting_template);
-
-  // Creates a phone number consisting only of the digit 9 that matches the
-  // number_pattern by applying the pattern to the longest_phone_number string.
-  static const char longest_phone_number[] = "999999999999999";
-  string a_phone_number;
-
-  MatchAllGroups(number_pattern, longest_phone_number, *regexp_factory_,
-                 &regexp_cache_, &a_phone_number);
   // No formatting template can be created if the number of digits entered so
   // far is longer than the maximum the current formatting rule can accommodate.
-  if (a_phone_number.length() < national_number_.length()) {
-    formatting_template->remove();
-    return;
+  if (patterns.max_digits < national_number_.length()) {
+    formatting_template_.clear();
+    return false;
   }
-  // Formats the number according to number_format.
-  regexp_cache_.GetRegExp(number_pattern).GlobalReplace(
-      &a_phone_number, number_format);
-  // Replaces each digit with character kDigitPlaceholder.
-  GlobalReplaceSubstring("9", kDigitPlaceholder, &a_phone_number);
-  formatting_template->setTo(a_phone_number.c_str(), a_phone_number.size());
+  formatting_template_ = patterns.formatting_template;
+  return true;
 }
 
 void AsYouTypeFormatter::Clear() {
   current_output_.clear();
   accrued_input_.remove();
   accrued_input_without_formatting_.remove();
-  formatting_template_.remove();
+  formatting_template_.clear();
   last_match_position_ = 0;
   current_formatting_pattern_.clear();
   prefix_before_national_number_.clear();
@@ -324,12 +247,10 @@ void AsYouTypeFormatter::Clear() {
   original_position_ = 0;
   is_complete_number_ = false;
   is_expecting_country_code_ = false;
-  possible_formats_.clear();
+  available_formats_ = NULL;
+  possible_formats_ = 0;
   should_add_space_after_national_prefix_ = false;
-
-  if (current_metadata_ != default_metadata_) {
-    current_metadata_ = GetMetadataForRegion(default_country_);
-  }
+  current_metadata_ = default_metadata_;
 }
 
 const string& AsYouTypeFormatter::InputDigit(char32 next_char, string* result) {
@@ -362,11 +283,8 @@ void AsYouTypeFormatter::InputDigitWithOptionToRememberPosition(
   }
   // We do formatting on-the-fly only when each character entered is either a
   // plus sign (accepted at the start of the number only).
-  string next_char_string;
-  UnicodeString(next_char).toUTF8String(next_char_string);
-
   char normalized_next_char = '\0';
-  if (!(phone_util_.ContainsOnlyValidDigits(next_char_string) ||
+  if (!(GetDigitValue(next_char) >= 0 ||
       (accrued_input_.length() == 1 && next_char == kPlusSign))) {
     able_to_format_ = false;
     input_has_formatting_ = true;
@@ -430,17 +348,15 @@ void AsYouTypeFormatter::InputDigitWithOptionToRememberPosition(
         phone_number->append(national_number_);
         return;
       }
-      if (possible_formats_.size() > 0) {
+      if (possible_formats_) {
         // The formatting patterns are already chosen.
-        string temp_national_number;
-        InputDigitHelper(normalized_next_char, &temp_national_number);
+        InputDigitHelper(normalized_next_char, &formatted_national_number_);
         // See if accrued digits can be formatted properly already. If not, use
         // the results from InputDigitHelper, which does formatting based on the
         // formatting pattern chosen.
-        string formatted_number;
-        AttemptToFormatAccruedDigits(&formatted_number);
-        if (formatted_number.length() > 0) {
-          phone_number->assign(formatted_number);
+        phone_number->clear();
+        AttemptToFormatAccruedDigits(phone_number);
+        if (phone_number->length() > 0) {
           return;
         }
         NarrowDownPossibleFormats(national_number_);
@@ -449,7 +365,7 @@ void AsYouTypeFormatter::InputDigitWithOptionToRememberPosition(
           return;
         }
         if (able_to_format_) {
-          AppendNationalNumber(temp_national_number, phone_number);
+          AppendNationalNumber(formatted_national_number_, phone_number);
         } else {
           phone_number->clear();
           accrued_input_.toUTF8String(*phone_number);
@@ -465,7 +381,7 @@ void AsYouTypeFormatter::AttemptToChoosePatternWithPrefixExtracted(
     string* formatted_number) {
   able_to_format_ = true;
   is_expecting_country_code_ = false;
-  possible_formats_.clear();
+  possible_formats_ = 0;
   AttemptToChooseFormattingPattern(formatted_number);
 }
 
@@ -494,21 +410,40 @@ void AsYouTypeFormatter::AttemptToFormatAccruedDigits(
     string* formatted_result) {
   DCHECK(formatted_result);
 
-  for (list<const NumberFormat*>::const_iterator it = possible_formats_.begin();
-       it != possible_formats_.end(); ++it) {
-    DCHECK(*it);
-    const NumberFormat& number_format = **it;
-    const string& pattern = number_format.pattern();
+  uint32 formats = possible_formats_;
+  if (!formats) {
+    return;
+  }
+  // The patterns of all the formats are usually matched at once by automata.
+  uint32 matching_formats;
+  const bool matched_patterns = pattern_store_.MatchPatterns(
+      *available_formats_, national_number_, &matching_formats);
+  if (matched_patterns) {
+    formats &= matching_formats;
+  }
+  for (int i = 0; formats != 0; ++i, formats >>= 1) {
+    if (!(formats & 1)) {
+      continue;
+    }
+    const NumberFormat& number_format = available_formats_->Get(i);
+    const RegExp& pattern =
+        *pattern_store_.GetFormatPatterns(number_format).pattern;
 
-    if (regexp_cache_.GetRegExp(pattern).FullMatch(national_number_)) {
+    if (matched_patterns || pattern.FullMatch(national_number_)) {
       SetShouldAddSpaceAfterNationalPrefix(number_format);
 
+      formatted_result->clear();
+      AppendPrefixBeforeNationalNumber(formatted_result);
+      if (phone_util_.template_formatter_->Format(
+              national_number_, number_format, false, formatted_result)) {
+        return;
+      }
       string formatted_number(national_number_);
-      bool status = regexp_cache_.GetRegExp(pattern).GlobalReplace(
-          &formatted_number, number_format.format());
+      bool status =
+          pattern.GlobalReplace(&formatted_number, number_format.format());
       DCHECK(status);
 
-      AppendNationalNumber(formatted_number, formatted_result);
+      formatted_result->append(formatted_number);
       return;
     }
   }
@@ -535,6 +470,14 @@ int AsYouTypeFormatter::GetRememberedPosition() const {
 
 void AsYouTypeFormatter::AppendNationalNumber(const string& national_number,
                                               string* phone_number) const {
+  phone_number->clear();
+  AppendPrefixBeforeNationalNumber(phone_number);
+  phone_number->append(national_number);
+}
+
+void AsYouTypeFormatter::AppendPrefixBeforeNationalNumber(
+    string* phone_number) const {
+  phone_number->append(prefix_before_national_number_);
   int prefix_before_national_number_length =
       prefix_before_national_number_.size();
   if (should_add_space_after_national_prefix_ &&
@@ -546,12 +489,7 @@ void AsYouTypeFormatter::AppendNationalNumber(const string& national_number,
     // formatting rule indicates that this would normally be done, with the
     // exception of the case where we already appended a space because the NDD
     // was surprisingly long.
-    phone_number->assign(prefix_before_national_number_);
     phone_number->push_back(kSeparatorBeforeNationalNumber);
-    StrAppend(phone_number, national_number);
-  } else {
-    phone_number->assign(
-        StrCat(prefix_before_national_number_, national_number));
   }
 }
 
@@ -585,14 +523,11 @@ void AsYouTypeFormatter::InputAccruedNationalNumber(string* number) {
   int length_of_national_number = national_number_.length();
 
   if (length_of_national_number > 0) {
-    string temp_national_number;
-
     for (int i = 0; i < length_of_national_number; ++i) {
-      temp_national_number.clear();
-      InputDigitHelper(national_number_[i], &temp_national_number);
+      InputDigitHelper(national_number_[i], &formatted_national_number_);
     }
     if (able_to_format_) {
-      AppendNationalNumber(temp_national_number, number);
+      AppendNationalNumber(formatted_national_number_, number);
     } else {
       number->clear();
       accrued_input_.toUTF8String(*number);
@@ -624,25 +559,29 @@ void AsYouTypeFormatter::RemoveNationalPrefixFromNationalNumber(
     prefix_before_national_number_.push_back(kSeparatorBeforeNationalNumber);
     is_complete_number_ = true;
   } else if (current_metadata_->has_national_prefix_for_parsing()) {
-    const scoped_ptr<RegExpInput> consumed_input(
-        regexp_factory_->CreateInput(national_number_));
-    const RegExp& pattern = regexp_cache_.GetRegExp(
-        current_metadata_->national_prefix_for_parsing());
-
+    int national_prefix_length;
+    if (!pattern_store_.MatchNationalPrefixForParsing(
+            *current_metadata_, national_number_, &national_prefix_length)) {
+      const scoped_ptr<RegExpInput> consumed_input(
+          pattern_store_.regexp_factory().CreateInput(national_number_));
+      const RegExp& pattern = *pattern_store_.GetRegionPatterns(
+          *current_metadata_).national_prefix_for_parsing;
+      national_prefix_length =
+          pattern.Consume(consumed_input.get())
+              ? national_number_.length() - consumed_input->ToString().length()
+              : -1;
+    }
     // Since some national prefix patterns are entirely optional, check that a
     // national prefix could actually be extracted.
-    if (pattern.Consume(consumed_input.get())) {
-      start_of_national_number =
-          national_number_.length() - consumed_input->ToString().length();
-      if (start_of_national_number > 0) {
-        // When the national prefix is detected, we use international formatting
-        // rules instead of national ones, because national formatting rules
-        // could countain local formatting rules for numbers entered without
-        // area code.
-        is_complete_number_ = true;
-        prefix_before_national_number_.append(
-            national_number_.substr(0, start_of_national_number));
-      }
+    if (national_prefix_length > 0) {
+      start_of_national_number = national_prefix_length;
+      // When the national prefix is detected, we use international formatting
+      // rules instead of national ones, because national formatting rules
+      // could countain local formatting rules for numbers entered without
+      // area code.
+      is_complete_number_ = true;
+      prefix_before_national_number_.append(national_number_, 0,
+                                            start_of_national_number);
     }
   }
   national_prefix->assign(national_number_, 0, start_of_national_number);
@@ -650,30 +589,31 @@ void AsYouTypeFormatter::RemoveNationalPrefixFromNationalNumber(
 }
 
 bool AsYouTypeFormatter::AttemptToExtractIdd() {
-  string accrued_input_without_formatting_stdstring;
-  accrued_input_without_formatting_
-      .toUTF8String(accrued_input_without_formatting_stdstring);
-  const scoped_ptr<RegExpInput> consumed_input(
-      regexp_factory_->CreateInput(accrued_input_without_formatting_stdstring));
-  const RegExp& international_prefix = regexp_cache_.GetRegExp(
-      StrCat("\\", string(&kPlusSign, 1), "|",
-             current_metadata_->international_prefix()));
-
-  if (international_prefix.Consume(consumed_input.get())) {
-    is_complete_number_ = true;
-    const int start_of_country_code =
-        accrued_input_without_formatting_.length() -
-        consumed_input->ToString().length();
+  accrued_input_without_formatting_.toUTF8String(unformatted_input_);
+  // The position of the country code is computed in bytes, and the prefix
+  // before it is matched either by an automaton when the input only contains
+  // ASCII characters, or by the regular expression otherwise.
+  int start_of_country_code;
+  if (!pattern_store_.MatchInternationalPrefix(
+          *current_metadata_, unformatted_input_, &start_of_country_code)) {
+    const scoped_ptr<RegExpInput> consumed_input(
+        pattern_store_.regexp_factory().CreateInput(unformatted_input_));
+    const RegExp& international_prefix = *pattern_store_.GetRegionPatterns(
+        *current_metadata_).international_prefix;
+    start_of_country_code =
+        international_prefix.Consume(consumed_input.get())
+            ? static_cast<int>(unformatted_input_.length() -
+                               consumed_input->ToString().length())
+            : -1;
+  }
 
-    national_number_.clear();
-    accrued_input_without_formatting_.tempSubString(start_of_country_code)
-        .toUTF8String(national_number_);
+  if (start_of_country_code >= 0) {
+    is_complete_number_ = true;
 
-    string before_country_code;
-    accrued_input_without_formatting_.tempSubString(0, start_of_country_code)
-        .toUTF8String(before_country_code);
-    prefix_before_national_number_.clear();
-    prefix_before_national_number_.append(before_country_code);
+    national_number_.assign(unformatted_input_, start_of_country_code,
+                            string::npos);
+    prefix_before_national_number_.assign(unformatted_input_, 0,
+                                          start_of_country_code);
 
     if (accrued_input_without_formatting_[0] != kPlusSign) {
       prefix_before_national_number_.push_back(kSeparatorBeforeNationalNumber);
@@ -687,13 +627,11 @@ bool AsYouTypeFormatter::AttemptToExtractCountryCode() {
   if (national_number_.length() == 0) {
     return false;
   }
-  string number_without_country_code(national_number_);
-  int country_code =
-    phone_util_.ExtractCountryCode(&number_without_country_code);
+  // The country code is only removed from the national number if it is found.
+  int country_code = phone_util_.ExtractCountryCode(&national_number_);
   if (country_code == 0) {
     return false;
   }
-  national_number_.assign(number_without_country_code);
   string new_region_code;
   phone_util_.GetRegionCodeForCountryCode(country_code, &new_region_code);
   if (PhoneNumberUtil::kRegionCodeForNonGeoEntity == new_region_code) {
@@ -719,12 +657,9 @@ char AsYouTypeFormatter::NormalizeAndAccrueDigitsAndPlusSign(
   if (next_char == kPlusSign) {
     accrued_input_without_formatting_.append(next_char);
   } else {
-    string number;
-    UnicodeString(next_char).toUTF8String(number);
-    phone_util_.NormalizeDigitsOnly(&number);
+    normalized_char = static_cast<char>('0' + GetDigitValue(next_char));
     accrued_input_without_formatting_.append(next_char);
-    national_number_.append(number);
-    normalized_char = number[0];
+    national_number_.push_back(normalized_char);
   }
   if (remember_position) {
     position_to_remember_ = accrued_input_without_formatting_.length();
@@ -734,20 +669,20 @@ char AsYouTypeFormatter::NormalizeAndAccrueDigitsAndPlusSign(
 
 void AsYouTypeFormatter::InputDigitHelper(char next_char, string* number) {
   DCHECK(number);
-  number->clear();
-  const char32 placeholder_codepoint = UnicodeString(kDigitPlaceholder)[0];
-  int placeholder_pos = formatting_template_
-      .tempSubString(last_match_position_).indexOf(placeholder_codepoint);
-  if (placeholder_pos != -1) {
-    UnicodeString temp_template = formatting_template_;
-    placeholder_pos = temp_template.indexOf(placeholder_codepoint);
-    temp_template.setCharAt(placeholder_pos, UnicodeString(next_char)[0]);
+  // The digits replace the placeholders of the template in order, the first
+  // placeholder left following the last digit. A placeholder is longer than a
+  // digit, so the template is edited in place.
+  const size_t placeholder_pos = formatting_template_.find(
+      AsYouTypePatternStore::kDigitPlaceholder, last_match_position_);
+  if (placeholder_pos != string::npos) {
+    formatting_template_.replace(
+        placeholder_pos, strlen(AsYouTypePatternStore::kDigitPlaceholder), 1,
+        next_char);
     last_match_position_ = placeholder_pos;
-    formatting_template_.replace(0, temp_template.length(), temp_template);
-    formatting_template_.tempSubString(0, last_match_position_ + 1)
-        .toUTF8String(*number);
+    number->assign(formatting_template_, 0, last_match_position_ + 1);
   } else {
-    if (possible_formats_.size() == 1) {
+    // Checks whether a single format is left.
+    if ((possible_formats_ & (possible_formats_ - 1)) == 0) {
       // More digits are entered than we could handle, and there are no other
       // valid patterns to try.
       able_to_format_ = false;
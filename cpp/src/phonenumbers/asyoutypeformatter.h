@@ -33,22 +33,18 @@
 #ifndef I18N_PHONENUMBERS_ASYOUTYPEFORMATTER_H_
 #define I18N_PHONENUMBERS_ASYOUTYPEFORMATTER_H_
 
-#include <list>
 #include <string>
 
 #include "phonenumbers/base/basictypes.h"
-#include "phonenumbers/base/memory/scoped_ptr.h"
-#include "phonenumbers/regexp_adapter.h"
-#include "phonenumbers/regexp_cache.h"
 #include "phonenumbers/phonemetadata.pb.h"
 #include "phonenumbers/unicodestring.h"
 
 namespace i18n {
 namespace phonenumbers {
 
-using std::list;
 using std::string;
 
+class AsYouTypePatternStore;
 class PhoneNumberUtil;
 
 class AsYouTypeFormatter {
@@ -101,14 +97,12 @@ class AsYouTypeFormatter {
   // for this formatting rule or not.
   void SetShouldAddSpaceAfterNationalPrefix(const NumberFormat& format);
 
+  // Sets the formatting template to the one of the format, which is used to
+  // efficiently format a partial number where digits are added one by one, and
+  // returns true, or returns false if the format has no template which can
+  // accommodate the digits entered so far.
   bool CreateFormattingTemplate(const NumberFormat& format);
 
-  // Gets a formatting template which could be used to efficiently format a
-  // partial number where digits are added one by one.
-  void GetFormattingTemplate(const string& number_pattern,
-                             const string& number_format,
-                             UnicodeString* formatting_template);
-
   void InputDigitWithOptionToRememberPosition(char32 next_char,
                                               bool remember_position,
                                               string* phone_number);
@@ -134,6 +128,10 @@ class AsYouTypeFormatter {
   void AppendNationalNumber(const string& national_number,
                             string* phone_number) const;
 
+  // Appends to phone_number the prefix that was collected, followed by the
+  // space AppendNationalNumber() inserts before the national number, if any.
+  void AppendPrefixBeforeNationalNumber(string* phone_number) const;
+
   // Attempts to set the formatting template and assigns the passed-in string
   // parameter to the formatted version of the digits entered so far.
   void AttemptToChooseFormattingPattern(string* formatted_number);
@@ -173,13 +171,14 @@ class AsYouTypeFormatter {
   // Converts UnicodeString position to std::string position.
   static int ConvertUnicodeStringPosition(const UnicodeString& s, int pos);
 
-  // Class attributes.
-  const scoped_ptr<const AbstractRegExpFactory> regexp_factory_;
-  RegExpCache regexp_cache_;
-
+  // Class attributes. The strings keep their capacity when the formatter is
+  // cleared, so that a formatter which is reused doesn't allocate any memory
+  // once it has formatted a few numbers.
   string current_output_;
 
-  UnicodeString formatting_template_;
+  // The formatting template of the format in use, encoded in UTF-8, whose
+  // placeholders are replaced by the digits as they are entered.
+  string formatting_template_;
   string current_formatting_pattern_;
 
   UnicodeString accrued_input_;
@@ -199,14 +198,16 @@ class AsYouTypeFormatter {
   bool is_expecting_country_code_;
 
   const PhoneNumberUtil& phone_util_;
+  // The patterns compiled from the metadata, shared by all the formatters.
+  const AsYouTypePatternStore& pattern_store_;
 
   const string default_country_;
 
-  const PhoneMetadata empty_metadata_;
   const PhoneMetadata* const default_metadata_;
   const PhoneMetadata* current_metadata_;
 
-  int last_match_position_;
+  // The position in bytes in formatting_template_ of the last digit entered.
+  size_t last_match_position_;
 
   // The position of a digit upon which InputDigitAndRememberPosition is most
   // recently invoked, as found in the original sequence of characters the user
@@ -227,13 +228,23 @@ class AsYouTypeFormatter {
   string extracted_national_prefix_;
   string national_number_;
 
-  list<const NumberFormat*> possible_formats_;
+  // The list of formats of the current metadata the number is formatted with.
+  const google::protobuf::RepeatedPtrField<NumberFormat>* available_formats_;
+  // The formats of available_formats_ the number may be formatted with, the
+  // i-th format being the bit (1 << i). Their leading digits patterns are
+  // matched by the automata of the pattern store, which narrow them down
+  // without running any regular expression.
+  uint32 possible_formats_;
+
+  // Scratch buffers: the national number formatted with the formatting
+  // template, and accrued_input_without_formatting_ encoded in UTF-8.
+  string formatted_national_number_;
+  string unformatted_input_;
 
+  friend class AsYouTypeFormatterPool;
   friend class PhoneNumberUtil;
   friend class AsYouTypeFormatterTest;
 
-  // Disallow copy and assign since this class uses RegExpCache which can't be
-  // copied.
   DISALLOW_COPY_AND_ASSIGN(AsYouTypeFormatter);
 };
 
@@ -0,0 +1,107 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/asyoutypeformatterpool.h"
+
+#include "phonenumbers/asyoutypeformatter.h"
+#include "phonenumbers/base/logging.h"
+#include "phonenumbers/phonenumberutil.h"
+#include "phonenumbers/stl_util.h"
+#include "phonenumbers/utf/unicodetext.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+AsYouTypeFormatterPool::AsYouTypeFormatterPool(
+    size_t max_idle_formatters_per_region)
+    : max_idle_formatters_per_region_(max_idle_formatters_per_region),
+      lock_(),
+      idle_formatters_() {}
+
+AsYouTypeFormatterPool::~AsYouTypeFormatterPool() {
+  for (FormatterMap::iterator it = idle_formatters_.begin();
+       it != idle_formatters_.end(); ++it) {
+    STLDeleteElements(&it->second);
+  }
+}
+
+AsYouTypeFormatter* AsYouTypeFormatterPool::Acquire(
+    const string& region_code) {
+  {
+    AutoLock l(lock_);
+    const FormatterMap::iterator it = idle_formatters_.find(region_code);
+    if (it != idle_formatters_.end() && !it->second.empty()) {
+      AsYouTypeFormatter* const formatter = it->second.back();
+      it->second.pop_back();
+      return formatter;
+    }
+  }
+  return PhoneNumberUtil::GetInstance()->GetAsYouTypeFormatter(region_code);
+}
+
+void AsYouTypeFormatterPool::Release(AsYouTypeFormatter* formatter) {
+  DCHECK(formatter);
+  // The formatter is cleared before taking the lock, and keeps the capacity of
+  // its buffers.
+  formatter->Clear();
+  {
+    AutoLock l(lock_);
+    vector<AsYouTypeFormatter*>& formatters =
+        idle_formatters_[formatter->default_country_];
+    if (formatters.size() < max_idle_formatters_per_region_) {
+      formatters.push_back(formatter);
+      return;
+    }
+  }
+  delete formatter;
+}
+
+void AsYouTypeFormatterPool::FormatAsTyped(const string& region_code,
+                                           const string& typed_number,
+                                           vector<string>* steps,
+                                           string* result) {
+  DCHECK(result);
+  AsYouTypeFormatter* const formatter = Acquire(region_code);
+  UnicodeText typed_text;
+  typed_text.PointToUTF8(typed_number.data(), typed_number.size());
+  size_t step = 0;
+  for (UnicodeText::const_iterator it = typed_text.begin();
+       it != typed_text.end(); ++it) {
+    // The output of the formatter is only copied when the intermediate outputs
+    // are requested.
+    formatter->InputDigitWithOptionToRememberPosition(
+        *it, false, &formatter->current_output_);
+    if (steps) {
+      if (step == steps->size()) {
+        steps->push_back(string());
+      }
+      (*steps)[step++].assign(formatter->current_output_);
+    }
+  }
+  if (steps) {
+    steps->resize(step);
+  }
+  result->assign(formatter->current_output_);
+  Release(formatter);
+}
+
+size_t AsYouTypeFormatterPool::GetIdleFormatterCount(
+    const string& region_code) const {
+  AutoLock l(lock_);
+  const FormatterMap::const_iterator it = idle_formatters_.find(region_code);
+  return it != idle_formatters_.end() ? it->second.size() : 0;
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
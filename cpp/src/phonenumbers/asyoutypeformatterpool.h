@@ -0,0 +1,103 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// A pool of AsYouTypeFormatter instances keyed by region, for the services
+// formatting one typed number after another, like a dialer starting a new
+// input session for every call. The formatters released to the pool are
+// cleared but keep the buffers they have grown, so that once the pool is warm,
+// typing a number into a formatter acquired from it doesn't allocate any
+// memory.
+//
+// AsYouTypeFormatterPool pool(4);
+// AsYouTypeFormatter* formatter = pool.Acquire("US");
+// string result;
+// formatter->InputDigit('6', &result);
+// ...
+// pool.Release(formatter);
+//
+// The pool is thread-safe, while each acquired formatter must only be used by
+// one thread at a time. The numbers which were typed already can also be
+// formatted in one call with FormatAsTyped().
+
+#ifndef I18N_PHONENUMBERS_ASYOUTYPEFORMATTERPOOL_H_
+#define I18N_PHONENUMBERS_ASYOUTYPEFORMATTERPOOL_H_
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/base/synchronization/lock.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::map;
+using std::string;
+using std::vector;
+
+class AsYouTypeFormatter;
+
+class AsYouTypeFormatterPool {
+ public:
+  // Creates a pool keeping at most max_idle_formatters_per_region released
+  // formatters of each region, the formatters released beyond that being
+  // deleted.
+  explicit AsYouTypeFormatterPool(size_t max_idle_formatters_per_region);
+
+  // Deletes the released formatters. The formatters which are still acquired
+  // must then be deleted by their users.
+  ~AsYouTypeFormatterPool();
+
+  // Returns a cleared formatter of region_code, one which was released to the
+  // pool if there is any, or a new one otherwise. The formatter must be given
+  // back with Release() once the number is typed.
+  AsYouTypeFormatter* Acquire(const string& region_code);
+
+  // Clears formatter, which must have been returned by Acquire(), and gives it
+  // back to the pool.
+  void Release(AsYouTypeFormatter* formatter);
+
+  // Types typed_number, a UTF-8 string, into a formatter of region_code one
+  // character after the other, as InputDigit() would, and sets result to the
+  // final output. If steps isn't NULL, it is also set to the outputs after each
+  // character, reusing the strings it already holds. This is meant for
+  // re-formatting numbers which were typed already, like those of a batch of
+  // stored records, and can be called from several threads at once, the
+  // formatters of the pool and the patterns of the regions being shared
+  // between the calls.
+  void FormatAsTyped(const string& region_code,
+                     const string& typed_number,
+                     vector<string>* steps,
+                     string* result);
+
+  // Returns the number of released formatters of region_code.
+  size_t GetIdleFormatterCount(const string& region_code) const;
+
+ private:
+  typedef map<string, vector<AsYouTypeFormatter*> > FormatterMap;
+
+  const size_t max_idle_formatters_per_region_;
+
+  mutable Lock lock_;
+  FormatterMap idle_formatters_;
+
+  DISALLOW_COPY_AND_ASSIGN(AsYouTypeFormatterPool);
+};
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_ASYOUTYPEFORMATTERPOOL_H_
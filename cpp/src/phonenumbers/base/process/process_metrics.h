@@ -0,0 +1,53 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef I18N_PHONENUMBERS_BASE_PROCESS_PROCESS_METRICS_H_
+#define I18N_PHONENUMBERS_BASE_PROCESS_PROCESS_METRICS_H_
+
+#include "phonenumbers/base/basictypes.h"
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#endif
+
+namespace i18n {
+namespace phonenumbers {
+
+// Returns the number of bytes currently allocated on the heap by the process,
+// or -1 if this can't be determined on the platform.
+inline int64 GetAllocatedHeapBytes() {
+#if defined(__GLIBC__) && \
+    (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+  const struct mallinfo2 info = mallinfo2();
+  return static_cast<int64>(info.uordblks + info.hblkhd);
+#elif defined(__GLIBC__)
+  // The fields of mallinfo overflow above 2GB.
+  const struct mallinfo info = mallinfo();
+  return static_cast<int64>(static_cast<unsigned int>(info.uordblks)) +
+         static_cast<unsigned int>(info.hblkhd);
+#elif defined(__APPLE__)
+  malloc_statistics_t stats;
+  malloc_zone_statistics(NULL, &stats);
+  return static_cast<int64>(stats.size_in_use);
+#else
+  return -1;
+#endif
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_BASE_PROCESS_PROCESS_METRICS_H_
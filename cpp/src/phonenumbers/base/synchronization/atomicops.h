@@ -0,0 +1,78 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This file provides the minimal set of atomic operations needed to publish
+// immutable objects to threads reading them without taking a lock: a pointer
+// written with Release_Store() and read with Acquire_Load() is guaranteed to
+// point to an object whose construction is visible to the reading thread.
+
+#ifndef I18N_PHONENUMBERS_BASE_SYNCHRONIZATION_ATOMICOPS_H_
+#define I18N_PHONENUMBERS_BASE_SYNCHRONIZATION_ATOMICOPS_H_
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace i18n {
+namespace phonenumbers {
+
+#if defined(__GNUC__)
+
+template <typename T>
+inline T Acquire_Load(const T* ptr) {
+  return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+template <typename T>
+inline void Release_Store(T* ptr, T value) {
+  __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+
+#elif defined(_MSC_VER)
+
+// Accesses to volatile variables have acquire and release semantics with
+// MSVC, the compiler barriers prevent any other reordering.
+template <typename T>
+inline T Acquire_Load(const T* ptr) {
+  const T value = *static_cast<const volatile T*>(ptr);
+  _ReadWriteBarrier();
+  return value;
+}
+
+template <typename T>
+inline void Release_Store(T* ptr, T value) {
+  _ReadWriteBarrier();
+  *static_cast<volatile T*>(ptr) = value;
+}
+
+#else
+
+// Plain accesses are enough on the platforms without thread-safety, see
+// base/thread_checker.h.
+template <typename T>
+inline T Acquire_Load(const T* ptr) {
+  return *ptr;
+}
+
+template <typename T>
+inline void Release_Store(T* ptr, T value) {
+  *ptr = value;
+}
+
+#endif
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_BASE_SYNCHRONIZATION_ATOMICOPS_H_
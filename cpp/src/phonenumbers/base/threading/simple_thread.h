@@ -0,0 +1,112 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Minimal thread running the Run() method of a delegate, emulating
+// base/threading/simple_thread.h.
+//
+// class Task : public SimpleThread::Delegate {
+//  public:
+//   virtual void Run() { ... }
+// };
+//
+// Task task;
+// SimpleThread thread(&task);
+// thread.Start();
+// thread.Join();
+
+#ifndef I18N_PHONENUMBERS_BASE_THREADING_SIMPLE_THREAD_H_
+#define I18N_PHONENUMBERS_BASE_THREADING_SIMPLE_THREAD_H_
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/base/logging.h"
+
+#if defined(I18N_PHONENUMBERS_USE_BOOST)
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread/thread.hpp>
+#elif defined(__linux__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+namespace i18n {
+namespace phonenumbers {
+
+class SimpleThread {
+ public:
+  class Delegate {
+   public:
+    virtual ~Delegate() {}
+    virtual void Run() = 0;
+  };
+
+  // The delegate is not owned and must outlive the thread.
+  explicit SimpleThread(Delegate* delegate)
+      : delegate_(delegate),
+        started_(false) {}
+
+  ~SimpleThread() {
+    DCHECK(!started_);
+  }
+
+  // Starts running the delegate on a new thread. On platforms without thread
+  // support, the delegate is run on the calling thread instead.
+  void Start() {
+    DCHECK(!started_);
+    started_ = true;
+#if defined(I18N_PHONENUMBERS_USE_BOOST)
+    thread_.reset(new boost::thread(&SimpleThread::ThreadMain, this));
+#elif defined(__linux__) || defined(__APPLE__)
+    const int ret = pthread_create(&thread_, NULL, &SimpleThread::ThreadMain,
+                                   this);
+    (void) ret;
+    DCHECK_EQ(0, ret);
+#else
+    delegate_->Run();
+#endif
+  }
+
+  // Waits for the delegate to return.
+  void Join() {
+    DCHECK(started_);
+#if defined(I18N_PHONENUMBERS_USE_BOOST)
+    thread_->join();
+    thread_.reset();
+#elif defined(__linux__) || defined(__APPLE__)
+    const int ret = pthread_join(thread_, NULL);
+    (void) ret;
+    DCHECK_EQ(0, ret);
+#endif
+    started_ = false;
+  }
+
+ private:
+  static void* ThreadMain(void* thread) {
+    static_cast<SimpleThread*>(thread)->delegate_->Run();
+    return NULL;
+  }
+
+  Delegate* const delegate_;
+  bool started_;
+#if defined(I18N_PHONENUMBERS_USE_BOOST)
+  boost::scoped_ptr<boost::thread> thread_;
+#elif defined(__linux__) || defined(__APPLE__)
+  pthread_t thread_;
+#endif
+
+  DISALLOW_COPY_AND_ASSIGN(SimpleThread);
+};
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_BASE_THREADING_SIMPLE_THREAD_H_
@@ -0,0 +1,51 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef I18N_PHONENUMBERS_BASE_TIME_TIME_H_
+#define I18N_PHONENUMBERS_BASE_TIME_TIME_H_
+
+#include "phonenumbers/base/basictypes.h"
+
+#if defined(I18N_PHONENUMBERS_USE_BOOST)
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#elif defined(__linux__) || defined(__APPLE__)
+#include <sys/time.h>
+#else
+#include <ctime>
+#endif
+
+namespace i18n {
+namespace phonenumbers {
+
+// Returns the current time in microseconds, to measure elapsed times.
+inline int64 GetCurrentTimeMicroseconds() {
+#if defined(I18N_PHONENUMBERS_USE_BOOST)
+  static const boost::posix_time::ptime epoch(
+      boost::gregorian::date(1970, 1, 1));
+  return (boost::posix_time::microsec_clock::universal_time() - epoch)
+      .total_microseconds();
+#elif defined(__linux__) || defined(__APPLE__)
+  struct timeval now;
+  gettimeofday(&now, NULL);
+  return static_cast<int64>(now.tv_sec) * 1000000 + now.tv_usec;
+#else
+  // Processor time, which is the best approximation available.
+  return static_cast<int64>(clock()) * 1000000 / CLOCKS_PER_SEC;
+#endif
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_BASE_TIME_TIME_H_
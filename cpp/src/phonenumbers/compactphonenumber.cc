@@ -0,0 +1,121 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/compactphonenumber.h"
+
+#include "phonenumbers/base/logging.h"
+#include "phonenumbers/phonenumber.pb.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+// The fields leave no padding, so that the numbers can also be hashed and
+// compared as bytes.
+COMPILE_ASSERT(sizeof(CompactPhoneNumber) == 16,
+               compact_phone_number_is_16_bytes_large);
+
+CompactPhoneNumber::CompactPhoneNumber()
+    : national_number_(0),
+      extension_(0),
+      country_code_(0),
+      number_of_leading_zeros_(0),
+      extension_length_(0) {}
+
+// static
+bool CompactPhoneNumber::FromPhoneNumber(const PhoneNumber& number,
+                                         CompactPhoneNumber* compact_number) {
+  DCHECK(compact_number);
+  if (number.country_code() < 0 || number.country_code() > kuint16max) {
+    return false;
+  }
+  if (number.italian_leading_zero() &&
+      (number.number_of_leading_zeros() < 1 ||
+       number.number_of_leading_zeros() > kuint8max)) {
+    return false;
+  }
+  const string& extension = number.extension();
+  if (extension.length() > static_cast<size_t>(kMaxExtensionLength)) {
+    return false;
+  }
+  uint32 extension_digits = 0;
+  for (string::const_iterator it = extension.begin(); it != extension.end();
+       ++it) {
+    if (*it < '0' || *it > '9') {
+      return false;
+    }
+    extension_digits = extension_digits * 10 + (*it - '0');
+  }
+  compact_number->national_number_ = number.national_number();
+  compact_number->extension_ = extension_digits;
+  compact_number->country_code_ = static_cast<uint16>(number.country_code());
+  compact_number->number_of_leading_zeros_ = number.italian_leading_zero()
+      ? static_cast<uint8>(number.number_of_leading_zeros())
+      : 0;
+  compact_number->extension_length_ = static_cast<uint8>(extension.length());
+  return true;
+}
+
+void CompactPhoneNumber::ToPhoneNumber(PhoneNumber* number) const {
+  DCHECK(number);
+  number->Clear();
+  number->set_country_code(country_code_);
+  number->set_national_number(national_number_);
+  if (italian_leading_zero()) {
+    number->set_italian_leading_zero(true);
+    if (number_of_leading_zeros_ > 1) {
+      number->set_number_of_leading_zeros(number_of_leading_zeros_);
+    }
+  }
+  if (has_extension()) {
+    GetExtension(number->mutable_extension());
+  }
+}
+
+void CompactPhoneNumber::GetExtension(string* extension) const {
+  DCHECK(extension);
+  char digits[kMaxExtensionLength];
+  uint32 remaining_digits = extension_;
+  for (int i = extension_length_ - 1; i >= 0; --i) {
+    digits[i] = static_cast<char>('0' + remaining_digits % 10);
+    remaining_digits /= 10;
+  }
+  extension->append(digits, extension_length_);
+}
+
+bool CompactPhoneNumber::operator==(const CompactPhoneNumber& other) const {
+  return national_number_ == other.national_number_ &&
+      extension_ == other.extension_ &&
+      country_code_ == other.country_code_ &&
+      number_of_leading_zeros_ == other.number_of_leading_zeros_ &&
+      extension_length_ == other.extension_length_;
+}
+
+bool CompactPhoneNumber::operator<(const CompactPhoneNumber& other) const {
+  if (country_code_ != other.country_code_) {
+    return country_code_ < other.country_code_;
+  }
+  if (national_number_ != other.national_number_) {
+    return national_number_ < other.national_number_;
+  }
+  if (number_of_leading_zeros_ != other.number_of_leading_zeros_) {
+    return number_of_leading_zeros_ < other.number_of_leading_zeros_;
+  }
+  if (extension_length_ != other.extension_length_) {
+    return extension_length_ < other.extension_length_;
+  }
+  return extension_ < other.extension_;
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
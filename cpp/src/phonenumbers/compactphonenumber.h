@@ -0,0 +1,105 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// A compact representation of the PhoneNumber messages, for the applications
+// holding large numbers of phone numbers, e.g. in deduplication tables. It is
+// 16 bytes large, trivially copyable, and only keeps what identifies a number:
+// its country calling code, its national number, its Italian leading zeros and
+// its extension. The raw input, the country code source and the preferred
+// domestic carrier code of PhoneNumber are dropped.
+//
+// The extension is packed as a number along with its length, so that its
+// leading zeros are kept. Only the extensions made of up to 9 ASCII digits can
+// be represented, which covers the extensions PhoneNumberUtil::Parse() finds
+// in ASCII text since they have up to 7 digits.
+//
+// PhoneNumberUtil has overloads of IsValidNumber(), GetNumberType() and
+// IsNumberMatch() which work on the compact fields, and of Format(), which
+// converts the number to a PhoneNumber.
+
+#ifndef I18N_PHONENUMBERS_COMPACTPHONENUMBER_H_
+#define I18N_PHONENUMBERS_COMPACTPHONENUMBER_H_
+
+#include <string>
+
+#include "phonenumbers/base/basictypes.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+
+class PhoneNumber;
+
+class CompactPhoneNumber {
+ public:
+  static const int kMaxExtensionLength = 9;
+
+  // Creates a number whose country calling code and national number are 0.
+  CompactPhoneNumber();
+
+  // Sets compact_number to the representation of number and returns true, or
+  // returns false if number can't be represented: its country calling code
+  // doesn't fit in 16 bits, its number of leading zeros isn't between 1 and
+  // 255 while it has an Italian leading zero, or its extension isn't made of up
+  // to kMaxExtensionLength ASCII digits. An empty extension is dropped.
+  static bool FromPhoneNumber(const PhoneNumber& number,
+                              CompactPhoneNumber* compact_number);
+
+  // Sets number to the PhoneNumber this number was created from, without the
+  // fields which were dropped.
+  void ToPhoneNumber(PhoneNumber* number) const;
+
+  int country_code() const { return country_code_; }
+  uint64 national_number() const { return national_number_; }
+  bool italian_leading_zero() const { return number_of_leading_zeros_ > 0; }
+  // Returns 1 if the number has no Italian leading zero, like PhoneNumber.
+  int number_of_leading_zeros() const {
+    return number_of_leading_zeros_ > 0 ? number_of_leading_zeros_ : 1;
+  }
+  bool has_extension() const { return extension_length_ > 0; }
+  // Returns true if both numbers have the same extension, or none.
+  bool HasSameExtensionAs(const CompactPhoneNumber& other) const {
+    return extension_ == other.extension_ &&
+        extension_length_ == other.extension_length_;
+  }
+
+  // Appends the extension of this number to extension.
+  void GetExtension(string* extension) const;
+
+  // The numbers are equal if all their fields are equal, i.e. if the
+  // PhoneNumber messages they were created from are the same except for the
+  // fields which are dropped. They are ordered by country calling code first
+  // and by national number next.
+  bool operator==(const CompactPhoneNumber& other) const;
+  bool operator!=(const CompactPhoneNumber& other) const {
+    return !(*this == other);
+  }
+  bool operator<(const CompactPhoneNumber& other) const;
+
+ private:
+  uint64 national_number_;
+  // The digits of the extension, read as a decimal number.
+  uint32 extension_;
+  uint16 country_code_;
+  // 0 if the number has no Italian leading zero.
+  uint8 number_of_leading_zeros_;
+  // 0 if the number has no extension.
+  uint8 extension_length_;
+};
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_COMPACTPHONENUMBER_H_
@@ -0,0 +1,277 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/decoded_text.h"
+
+#include <algorithm>
+
+#include <unicode/uchar.h>
+#include <unicode/utf16.h>
+
+#include "phonenumbers/base/logging.h"
+#include "phonenumbers/sse2_util.h"
+#include "phonenumbers/utf/utf.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::min;
+
+namespace {
+
+// The distance in bytes between two checkpoints of the offset map, which
+// bounds the decoding needed to convert an offset far from the last one.
+const int kCheckpointInterval = 4096;
+
+// Decodes the character at the start of s, of length bytes, and returns its
+// length in bytes.
+int DecodeCharacter(const char* s, int length, Rune* rune) {
+  if (!(*s & 0x80)) {
+    *rune = *s;
+    return 1;
+  }
+  const int character_length = charntorune(rune, s, length);
+  if (character_length > 0) {
+    return character_length;
+  }
+  // The incomplete characters at the end of the text.
+  *rune = Runeerror;
+  return 1;
+}
+
+struct CodeUnitRange {
+  UChar first;
+  UChar last;
+};
+
+// The ranges of UTF-16 code units which contain all the decimal digits of the
+// BMP, and the lead surrogates of the ones outside of it. They leave out most
+// of the letters and punctuation of the common scripts, so that the code units
+// in them rarely need to be looked up in the Unicode data.
+const CodeUnitRange kDigitRanges[] = {
+  { '0', '9' },
+  { 0x0660, 0x1FFF },  // From the Arabic-Indic digits to the Greek Extended.
+  { 0xA000, 0xABFF },  // From the Yi syllables to the Meetei Mayek digits.
+  { 0xD800, 0xDBFF },  // The lead surrogates.
+  { 0xFF10, 0xFF19 },  // The full-width digits.
+};
+
+bool IsInDigitRanges(UChar c) {
+  for (size_t i = 0; i < arraysize(kDigitRanges); ++i) {
+    if (c >= kDigitRanges[i].first && c <= kDigitRanges[i].last) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Returns true if the character starting at the index-th code unit of text, of
+// length code units, is a decimal digit.
+bool IsDigitAt(const UChar* text, int length, int index) {
+  UChar32 c;
+  U16_GET(text, 0, index, length, c);
+  return u_isdigit(c);
+}
+
+#if defined(I18N_PHONENUMBERS_USE_SSE2)
+
+// The number of UTF-8 bytes, or of UTF-16 code units, in 16 bytes.
+const int kUtf8BlockLength = 16;
+const int kUtf16BlockLength = 8;
+
+// Returns the mask of the code units of the block within [first, last].
+__m128i RangeMask(__m128i block, UChar first, UChar last) {
+  // SSE2 only compares signed 16-bit integers, so the offsets from first are
+  // moved by 0x8000, which maps the ones below first, after wrapping around,
+  // above the maximum offset.
+  const __m128i offsets = _mm_sub_epi16(
+      block, _mm_set1_epi16(static_cast<short>(first + 0x8000)));
+  return _mm_cmplt_epi16(
+      offsets, _mm_set1_epi16(static_cast<short>(last - first + 1 - 0x8000)));
+}
+
+// Returns the mask, with a bit per code unit, of the code units of the block
+// which are in kDigitRanges.
+uint32 DigitRangesMask(__m128i block) {
+  const __m128i ascii_digits = RangeMask(block, '0', '9');
+  const __m128i other_digits = RangeMask(block, 0x0660, 0xFFFF);
+  // Most of the blocks of the texts in the scripts with no code units above
+  // the Arabic-Indic digits have no digit at all.
+  if (!_mm_movemask_epi8(other_digits)) {
+    return static_cast<uint32>(_mm_movemask_epi8(
+        _mm_packs_epi16(ascii_digits, _mm_setzero_si128())));
+  }
+  __m128i mask = ascii_digits;
+  for (size_t i = 1; i < arraysize(kDigitRanges); ++i) {
+    mask = _mm_or_si128(mask, RangeMask(block, kDigitRanges[i].first,
+                                        kDigitRanges[i].last));
+  }
+  return static_cast<uint32>(
+      _mm_movemask_epi8(_mm_packs_epi16(mask, _mm_setzero_si128())));
+}
+
+#endif  // I18N_PHONENUMBERS_USE_SSE2
+
+// Converts the ASCII characters starting at s, of length bytes, to UTF-16 code
+// units written to buffer, a block at a time, and returns their number. The
+// code units of the block after them are also written, and must fit in the
+// buffer.
+int WidenAsciiCharacters(const char* s, int length, UChar* buffer) {
+  int ascii_length = 0;
+#if defined(I18N_PHONENUMBERS_USE_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+  while (length - ascii_length >= kUtf8BlockLength) {
+    const __m128i block = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(s + ascii_length));
+    __m128i* const output =
+        reinterpret_cast<__m128i*>(buffer + ascii_length);
+    _mm_storeu_si128(output, _mm_unpacklo_epi8(block, zero));
+    _mm_storeu_si128(output + 1, _mm_unpackhi_epi8(block, zero));
+    const uint32 non_ascii_mask =
+        static_cast<uint32>(_mm_movemask_epi8(block));
+    if (non_ascii_mask) {
+      return ascii_length + CountTrailingZeros(non_ascii_mask);
+    }
+    ascii_length += kUtf8BlockLength;
+  }
+#endif  // I18N_PHONENUMBERS_USE_SSE2
+  return ascii_length;
+}
+
+}  // namespace
+
+DecodedText::DecodedText(const string& utf8_text)
+    : utf8_text_(utf8_text),
+      utf16_text_(),
+      checkpoints_(1, Position(0, 0)),
+      cursor_(0, 0) {
+  const char* const data = utf8_text.data();
+  const int length = static_cast<int>(utf8_text.length());
+  // The text has at most as many UTF-16 code units as UTF-8 bytes.
+  UChar* const buffer = utf16_text_.getBuffer(length + 1);
+  int utf16_index = 0;
+  int next_checkpoint = kCheckpointInterval;
+  for (int offset = 0; offset < length;) {
+    if (offset >= next_checkpoint) {
+      checkpoints_.push_back(Position(offset, utf16_index));
+      next_checkpoint += kCheckpointInterval;
+    }
+    if (!(data[offset] & 0x80)) {
+      // The checkpoints are not skipped, so that they stay at the first
+      // characters after the multiples of kCheckpointInterval.
+      const int ascii_length = WidenAsciiCharacters(
+          data + offset, min(length, next_checkpoint) - offset,
+          buffer + utf16_index);
+      if (ascii_length > 0) {
+        offset += ascii_length;
+        utf16_index += ascii_length;
+        continue;
+      }
+    }
+    Rune rune;
+    offset += DecodeCharacter(data + offset, length - offset, &rune);
+    if (rune > 0xFFFF) {
+      buffer[utf16_index++] = U16_LEAD(rune);
+      buffer[utf16_index++] = U16_TRAIL(rune);
+    } else {
+      buffer[utf16_index++] = static_cast<UChar>(rune);
+    }
+  }
+  utf16_text_.releaseBuffer(utf16_index);
+}
+
+int DecodedText::ToUtf16Index(int utf8_offset) {
+  DCHECK_GE(utf8_offset, 0);
+  DCHECK(utf8_offset <= static_cast<int>(utf8_text_.length()));
+  Position position = GetStartingPosition(utf8_offset, -1);
+  while (position.utf8_offset < utf8_offset) {
+    Advance(&position);
+  }
+  DCHECK_EQ(utf8_offset, position.utf8_offset);
+  cursor_ = position;
+  return position.utf16_index;
+}
+
+int DecodedText::ToUtf8Offset(int utf16_index) {
+  DCHECK_GE(utf16_index, 0);
+  DCHECK(utf16_index <= utf16_text_.length());
+  Position position = GetStartingPosition(-1, utf16_index);
+  while (position.utf16_index < utf16_index) {
+    Advance(&position);
+  }
+  DCHECK_EQ(utf16_index, position.utf16_index);
+  cursor_ = position;
+  return position.utf8_offset;
+}
+
+int DecodedText::FindDigit(int utf16_index) const {
+  DCHECK_GE(utf16_index, 0);
+  const UChar* const text = utf16_text_.getBuffer();
+  const int length = utf16_text_.length();
+  int index = utf16_index;
+#if defined(I18N_PHONENUMBERS_USE_SSE2)
+  for (; length - index >= kUtf16BlockLength; index += kUtf16BlockLength) {
+    const __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + index));
+    for (uint32 mask = DigitRangesMask(block); mask; mask &= mask - 1) {
+      const int candidate_index = index + CountTrailingZeros(mask);
+      if (IsDigitAt(text, length, candidate_index)) {
+        return candidate_index;
+      }
+    }
+  }
+#endif  // I18N_PHONENUMBERS_USE_SSE2
+  for (; index < length; ++index) {
+    if (IsInDigitRanges(text[index]) && IsDigitAt(text, length, index)) {
+      return index;
+    }
+  }
+  return length;
+}
+
+void DecodedText::Advance(Position* position) const {
+  Rune rune;
+  position->utf8_offset += DecodeCharacter(
+      utf8_text_.data() + position->utf8_offset,
+      static_cast<int>(utf8_text_.length()) - position->utf8_offset, &rune);
+  position->utf16_index += rune > 0xFFFF ? 2 : 1;
+}
+
+DecodedText::Position DecodedText::GetStartingPosition(int utf8_offset,
+                                                       int utf16_index) const {
+  const bool by_utf8_offset = utf8_offset >= 0;
+  // Finds the last checkpoint not after the requested position.
+  size_t begin = 0;
+  size_t end = checkpoints_.size();
+  while (end - begin > 1) {
+    const size_t middle = begin + (end - begin) / 2;
+    const Position& checkpoint = checkpoints_[middle];
+    if (by_utf8_offset ? checkpoint.utf8_offset <= utf8_offset
+                       : checkpoint.utf16_index <= utf16_index) {
+      begin = middle;
+    } else {
+      end = middle;
+    }
+  }
+  const Position& checkpoint = checkpoints_[begin];
+  const bool cursor_is_closer = by_utf8_offset
+      ? cursor_.utf8_offset > checkpoint.utf8_offset &&
+            cursor_.utf8_offset <= utf8_offset
+      : cursor_.utf16_index > checkpoint.utf16_index &&
+            cursor_.utf16_index <= utf16_index;
+  return cursor_is_closer ? cursor_ : checkpoint;
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
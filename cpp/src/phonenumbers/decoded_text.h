@@ -0,0 +1,101 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// A UTF-8 text decoded once to UTF-16 for the ICU regular expressions, with a
+// map between the offsets of the characters in both encodings.
+//
+// The map doesn't store the offsets of every character, which would take
+// several times the size of the text. It records the offsets of a character
+// every kCheckpointInterval bytes instead, and converts an offset by decoding
+// the text from the closest preceding checkpoint, or from the last converted
+// offset when it's closer. Converting increasing offsets, as a scan of the
+// text does, therefore decodes each character about once.
+//
+// Invalid UTF-8 sequences are decoded one byte at a time to U+FFFD, so that
+// every byte of the text belongs to a character.
+//
+// The runs of ASCII characters, and the searches for decimal digits, which
+// let the matcher skip the text which can't contain phone numbers, are
+// processed several characters at a time with SSE2 when it is available.
+
+#ifndef I18N_PHONENUMBERS_DECODED_TEXT_H_
+#define I18N_PHONENUMBERS_DECODED_TEXT_H_
+
+#include <string>
+#include <vector>
+
+#include <unicode/unistr.h>
+
+#include "phonenumbers/base/basictypes.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+using std::vector;
+
+class DecodedText {
+ public:
+  // The text is not copied and must outlive this object.
+  explicit DecodedText(const string& utf8_text);
+
+  const icu::UnicodeString& utf16_text() const {
+    return utf16_text_;
+  }
+
+  // Returns the UTF-16 index of the character starting at utf8_offset, which
+  // must be the offset of a character or the length of the text.
+  int ToUtf16Index(int utf8_offset);
+
+  // Returns the UTF-8 offset of the character starting at utf16_index, which
+  // must be the index of a character or the length of the text.
+  int ToUtf8Offset(int utf16_index);
+
+  // Returns the UTF-16 index of the first decimal digit (i.e. of general
+  // category Nd) at or after utf16_index, or the length of the text if there
+  // is none.
+  int FindDigit(int utf16_index) const;
+
+ private:
+  // The offsets of a character in both encodings.
+  struct Position {
+    Position(int utf8_offset, int utf16_index)
+        : utf8_offset(utf8_offset), utf16_index(utf16_index) {}
+
+    int utf8_offset;
+    int utf16_index;
+  };
+
+  // Decodes the character at position and moves position to the next one.
+  void Advance(Position* position) const;
+
+  // Returns the closest known position before the character at utf8_offset,
+  // or at utf16_index if utf8_offset is negative.
+  Position GetStartingPosition(int utf8_offset, int utf16_index) const;
+
+  const string& utf8_text_;
+  icu::UnicodeString utf16_text_;
+  // The positions of the first characters starting at multiples of
+  // kCheckpointInterval bytes.
+  vector<Position> checkpoints_;
+  // The last converted position.
+  Position cursor_;
+
+  DISALLOW_COPY_AND_ASSIGN(DecodedText);
+};
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_DECODED_TEXT_H_
@@ -0,0 +1,70 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/dfa_based_matcher.h"
+
+#include <string>
+
+#include "phonenumbers/digit_automaton.h"
+#include "phonenumbers/phonemetadata.pb.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+
+DfaBasedMatcher::DfaBasedMatcher()
+    : regex_based_matcher_(),
+      cache_impl_(new CacheImpl(128)) {}
+
+DfaBasedMatcher::~DfaBasedMatcher() {}
+
+bool DfaBasedMatcher::MatchesNationalNumber(
+    const string& national_number, const PhoneNumberDesc& number_desc,
+    bool allow_prefix_match) const {
+  const DigitAutomaton* automaton =
+      GetAutomaton(number_desc.national_number_pattern());
+  if (!automaton || !IsAsciiDigitString(national_number)) {
+    return regex_based_matcher_.MatchesNationalNumber(
+        national_number, number_desc, allow_prefix_match);
+  }
+  return allow_prefix_match
+      ? automaton->PrefixMatch(national_number)
+      : automaton->FullMatch(national_number);
+}
+
+bool DfaBasedMatcher::MatchesPossibleNumber(
+    const string& national_number, const PhoneNumberDesc& number_desc) const {
+  const DigitAutomaton* automaton =
+      GetAutomaton(number_desc.possible_number_pattern());
+  if (!automaton || !IsAsciiDigitString(national_number)) {
+    return regex_based_matcher_.MatchesPossibleNumber(national_number,
+                                                      number_desc);
+  }
+  return automaton->FullMatch(national_number);
+}
+
+const DigitAutomaton* DfaBasedMatcher::GetAutomaton(
+    const string& number_pattern) const {
+  const DigitAutomaton* automaton;
+  if (cache_impl_->Find(number_pattern, &automaton)) return automaton;
+
+  // Patterns which can't be compiled are cached as well, so that they are only
+  // parsed once.
+  return cache_impl_->Insert(number_pattern,
+                             DigitAutomaton::Create(number_pattern));
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -0,0 +1,66 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef I18N_PHONENUMBERS_DFA_BASED_MATCHER_H_
+#define I18N_PHONENUMBERS_DFA_BASED_MATCHER_H_
+
+#include <string>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/base/memory/scoped_ptr.h"
+#include "phonenumbers/matcher_api.h"
+#include "phonenumbers/read_mostly_cache.h"
+#include "phonenumbers/regex_based_matcher.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+class DigitAutomaton;
+class PhoneNumberDesc;
+
+// Implementation of the matcher API compiling the patterns in the
+// PhoneNumberDesc proto message into deterministic automata over the digits,
+// which are then run without allocating any memory. Patterns using constructs
+// the automata don't support, and numbers containing characters other than
+// ASCII digits, are matched with regular expressions instead.
+class DfaBasedMatcher : public MatcherApi {
+ public:
+  DfaBasedMatcher();
+  ~DfaBasedMatcher();
+
+  bool MatchesNationalNumber(const string& national_number,
+                             const PhoneNumberDesc& number_desc,
+                             bool allow_prefix_match) const;
+
+  bool MatchesPossibleNumber(const string& national_number,
+                             const PhoneNumberDesc& number_desc) const;
+
+ private:
+  typedef ReadMostlyCache<string, DigitAutomaton> CacheImpl;
+
+  // Returns the automaton compiled from number_pattern, or NULL if the pattern
+  // can't be compiled into an automaton.
+  const DigitAutomaton* GetAutomaton(const string& number_pattern) const;
+
+  const RegexBasedMatcher regex_based_matcher_;
+
+  const scoped_ptr<CacheImpl> cache_impl_;
+
+  DISALLOW_COPY_AND_ASSIGN(DfaBasedMatcher);
+};
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_DFA_BASED_MATCHER_H_
@@ -0,0 +1,692 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/digit_automaton.h"
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "phonenumbers/base/logging.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::make_pair;
+using std::map;
+using std::pair;
+using std::sort;
+using std::string;
+using std::vector;
+
+namespace {
+
+// Bit mask of a set of digits, bit i standing for the digit i.
+typedef uint16 DigitSet;
+
+const DigitSet kAllDigits = (1 << DigitAutomaton::kNumDigits) - 1;
+const int kUnbounded = -1;
+// Limits protecting against pathological patterns. Patterns exceeding them are
+// reported as not supported so that callers fall back to regular expressions.
+const int kMaxRepetition = 64;
+const size_t kMaxNfaStates = 20000;
+const size_t kMaxDfaStates = 10000;
+
+// Node of the syntax tree of a pattern.
+struct Node {
+  enum Kind {
+    DIGITS,  // Matches one digit of the set digits.
+    CONCATENATION,
+    ALTERNATION,
+    REPETITION  // Matches children[0] between min and max times.
+  };
+
+  explicit Node(Kind node_kind)
+      : kind(node_kind), digits(0), min(0), max(0), children() {}
+
+  Kind kind;
+  DigitSet digits;
+  int min;
+  int max;
+  vector<int> children;
+};
+
+// Recursive descent parser for the subset of the regular expression syntax
+// used in the metadata. The nodes are stored in a vector and referenced by
+// their index in it.
+//
+// Since the automaton only ever sees ASCII digits, any other literal character
+// of the pattern is compiled to the empty set of digits: it can never match.
+// Constructs whose semantics can't be expressed this way (anchors, look-around,
+// back-references, flags, possessive quantifiers, other escapes) make the
+// parser fail.
+class PatternParser {
+ public:
+  PatternParser(const string& pattern, vector<Node>* nodes)
+      : pattern_(pattern), position_(0), nodes_(nodes) {}
+
+  // Parses the whole pattern and returns the index of the root node, or -1 on
+  // failure.
+  int Parse() {
+    const int root = ParseAlternation();
+    if (root < 0 || position_ != pattern_.length()) {
+      return -1;
+    }
+    return root;
+  }
+
+ private:
+  bool AtEnd() const { return position_ >= pattern_.length(); }
+
+  char Peek() const { return pattern_[position_]; }
+
+  int AddNode(const Node& node) {
+    nodes_->push_back(node);
+    return static_cast<int>(nodes_->size() - 1);
+  }
+
+  int AddDigits(DigitSet digits) {
+    Node node(Node::DIGITS);
+    node.digits = digits;
+    return AddNode(node);
+  }
+
+  // alternation := concatenation ('|' concatenation)*
+  int ParseAlternation() {
+    Node alternation(Node::ALTERNATION);
+    for (;;) {
+      const int concatenation = ParseConcatenation();
+      if (concatenation < 0) {
+        return -1;
+      }
+      alternation.children.push_back(concatenation);
+      if (AtEnd() || Peek() != '|') {
+        break;
+      }
+      ++position_;
+    }
+    if (alternation.children.size() == 1) {
+      return alternation.children[0];
+    }
+    return AddNode(alternation);
+  }
+
+  // concatenation := repetition*
+  int ParseConcatenation() {
+    Node concatenation(Node::CONCATENATION);
+    while (!AtEnd() && Peek() != '|' && Peek() != ')') {
+      const int repetition = ParseRepetition();
+      if (repetition < 0) {
+        return -1;
+      }
+      concatenation.children.push_back(repetition);
+    }
+    return AddNode(concatenation);
+  }
+
+  // repetition := atom quantifier*
+  int ParseRepetition() {
+    int node = ParseAtom();
+    while (node >= 0 && !AtEnd()) {
+      int min;
+      int max;
+      const char c = Peek();
+      if (c == '?') {
+        min = 0;
+        max = 1;
+        ++position_;
+      } else if (c == '*') {
+        min = 0;
+        max = kUnbounded;
+        ++position_;
+      } else if (c == '+') {
+        min = 1;
+        max = kUnbounded;
+        ++position_;
+      } else if (c == '{') {
+        if (!ParseInterval(&min, &max)) {
+          return -1;
+        }
+      } else {
+        break;
+      }
+      if (!AtEnd()) {
+        if (Peek() == '+') {
+          // Possessive quantifiers change the language matched.
+          return -1;
+        }
+        if (Peek() == '?') {
+          // Reluctant quantifiers don't change whether a match exists.
+          ++position_;
+        }
+      }
+      Node repetition(Node::REPETITION);
+      repetition.min = min;
+      repetition.max = max;
+      repetition.children.push_back(node);
+      node = AddNode(repetition);
+    }
+    return node;
+  }
+
+  // Parses "{n}", "{n,}" or "{n,m}".
+  bool ParseInterval(int* min, int* max) {
+    DCHECK(Peek() == '{');
+    ++position_;
+    if (!ParseNumber(min)) {
+      return false;
+    }
+    *max = *min;
+    if (!AtEnd() && Peek() == ',') {
+      ++position_;
+      if (!AtEnd() && Peek() == '}') {
+        *max = kUnbounded;
+      } else if (!ParseNumber(max) || *max < *min) {
+        return false;
+      }
+    }
+    if (AtEnd() || Peek() != '}') {
+      return false;
+    }
+    ++position_;
+    return true;
+  }
+
+  bool ParseNumber(int* number) {
+    *number = 0;
+    const size_t start = position_;
+    while (!AtEnd() && Peek() >= '0' && Peek() <= '9') {
+      *number = *number * 10 + (Peek() - '0');
+      if (*number > kMaxRepetition) {
+        return false;
+      }
+      ++position_;
+    }
+    return position_ > start;
+  }
+
+  // atom := digit | '.' | escape | class | '(' ['?:'] alternation ')'
+  int ParseAtom() {
+    const char c = Peek();
+    switch (c) {
+      case '(': {
+        ++position_;
+        if (!AtEnd() && Peek() == '?') {
+          if (position_ + 1 >= pattern_.length() ||
+              pattern_[position_ + 1] != ':') {
+            return -1;
+          }
+          position_ += 2;
+        }
+        const int group = ParseAlternation();
+        if (group < 0 || AtEnd() || Peek() != ')') {
+          return -1;
+        }
+        ++position_;
+        return group;
+      }
+      case '[':
+        return ParseClass();
+      case '\\': {
+        DigitSet digits;
+        if (!ParseEscape(&digits)) {
+          return -1;
+        }
+        return AddDigits(digits);
+      }
+      case '.':
+        ++position_;
+        return AddDigits(kAllDigits);
+      case ')':
+      case '|':
+      case '?':
+      case '*':
+      case '+':
+      case '{':
+      case '}':
+      case ']':
+      case '^':
+      case '$':
+        return -1;
+      default:
+        if (static_cast<unsigned char>(c) >= 0x80) {
+          return -1;
+        }
+        ++position_;
+        return AddDigits(DigitsInRange(c, c));
+    }
+  }
+
+  // Parses an escape sequence, outside or inside a character class.
+  bool ParseEscape(DigitSet* digits) {
+    DCHECK(Peek() == '\\');
+    ++position_;
+    if (AtEnd()) {
+      return false;
+    }
+    const char c = Peek();
+    ++position_;
+    if (c == 'd') {
+      *digits = kAllDigits;
+      return true;
+    }
+    // Only escaped punctuation is supported: letters and digits introduce
+    // character classes, anchors and back-references.
+    if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') ||
+        (c >= 'A' && c <= 'Z') || static_cast<unsigned char>(c) >= 0x80) {
+      return false;
+    }
+    *digits = 0;
+    return true;
+  }
+
+  // class := '[' ['^'] (item | item '-' item)+ ']'
+  int ParseClass() {
+    DCHECK(Peek() == '[');
+    ++position_;
+    bool negated = false;
+    if (!AtEnd() && Peek() == '^') {
+      negated = true;
+      ++position_;
+    }
+    DigitSet digits = 0;
+    bool empty = true;
+    while (!AtEnd() && Peek() != ']') {
+      const char c = Peek();
+      if (c == '[' || static_cast<unsigned char>(c) >= 0x80) {
+        // Nested classes and set operations are not supported.
+        return -1;
+      }
+      if (c == '\\') {
+        DigitSet escaped_digits;
+        if (!ParseEscape(&escaped_digits)) {
+          return -1;
+        }
+        digits |= escaped_digits;
+      } else {
+        ++position_;
+        if (position_ + 1 < pattern_.length() && Peek() == '-' &&
+            pattern_[position_ + 1] != ']') {
+          const char last = pattern_[position_ + 1];
+          if (last == '\\' || last == '[' || last < c) {
+            return -1;
+          }
+          position_ += 2;
+          digits |= DigitsInRange(c, last);
+        } else {
+          digits |= DigitsInRange(c, c);
+        }
+      }
+      empty = false;
+    }
+    if (AtEnd() || empty) {
+      return -1;
+    }
+    ++position_;
+    return AddDigits(negated ? (kAllDigits & ~digits) : digits);
+  }
+
+  static DigitSet DigitsInRange(char first, char last) {
+    DigitSet digits = 0;
+    for (char c = '0'; c <= '9'; ++c) {
+      if (first <= c && c <= last) {
+        digits |= 1 << (c - '0');
+      }
+    }
+    return digits;
+  }
+
+  const string& pattern_;
+  size_t position_;
+  vector<Node>* const nodes_;
+
+  DISALLOW_COPY_AND_ASSIGN(PatternParser);
+};
+
+// Non-deterministic automaton with epsilon transitions, built from the syntax
+// trees using Thompson's construction.
+class Nfa {
+ public:
+  Nfa() : states_(), marks_(), generation_(0), stack_() {}
+
+  int AddState() {
+    states_.push_back(State());
+    return static_cast<int>(states_.size() - 1);
+  }
+
+  size_t size() const { return states_.size(); }
+
+  void AddEpsilon(int from, int to) {
+    states_[from].epsilon.push_back(to);
+  }
+
+  void AddTags(int state, uint32 tags) {
+    states_[state].tags |= tags;
+  }
+
+  // Appends the automaton of the tree rooted at node to the state from, and
+  // returns the final state of the appended automaton, or -1 if the automaton
+  // has grown too large.
+  int Build(const vector<Node>& nodes, int node_index, int from) {
+    if (states_.size() > kMaxNfaStates) {
+      return -1;
+    }
+    const Node& node = nodes[node_index];
+    switch (node.kind) {
+      case Node::DIGITS: {
+        const int to = AddState();
+        states_[from].transitions.push_back(make_pair(node.digits, to));
+        return to;
+      }
+      case Node::CONCATENATION: {
+        int current = from;
+        for (vector<int>::const_iterator it = node.children.begin();
+             it != node.children.end() && current >= 0; ++it) {
+          current = Build(nodes, *it, current);
+        }
+        return current;
+      }
+      case Node::ALTERNATION: {
+        const int to = AddState();
+        for (vector<int>::const_iterator it = node.children.begin();
+             it != node.children.end(); ++it) {
+          const int branch = AddState();
+          AddEpsilon(from, branch);
+          const int branch_end = Build(nodes, *it, branch);
+          if (branch_end < 0) {
+            return -1;
+          }
+          AddEpsilon(branch_end, to);
+        }
+        return to;
+      }
+      case Node::REPETITION: {
+        const int child = node.children[0];
+        int current = from;
+        for (int i = 0; i < node.min && current >= 0; ++i) {
+          current = Build(nodes, child, current);
+        }
+        if (current < 0) {
+          return -1;
+        }
+        if (node.max == kUnbounded) {
+          const int loop = AddState();
+          AddEpsilon(current, loop);
+          const int loop_end = Build(nodes, child, loop);
+          if (loop_end < 0) {
+            return -1;
+          }
+          AddEpsilon(loop_end, loop);
+          return loop;
+        }
+        const int to = AddState();
+        for (int i = node.min; i < node.max && current >= 0; ++i) {
+          AddEpsilon(current, to);
+          current = Build(nodes, child, current);
+        }
+        if (current < 0) {
+          return -1;
+        }
+        AddEpsilon(current, to);
+        return to;
+      }
+    }
+    return -1;
+  }
+
+  // Replaces the set of states by its epsilon closure, sorted. Only the states
+  // with transitions on digits or with tags are kept, since the others don't
+  // influence the behaviour of the automaton.
+  void Close(vector<int>* states) const {
+    if (marks_.size() != states_.size()) {
+      marks_.assign(states_.size(), 0);
+      generation_ = 0;
+    }
+    ++generation_;
+    stack_.assign(states->begin(), states->end());
+    states->clear();
+    while (!stack_.empty()) {
+      const int state = stack_.back();
+      stack_.pop_back();
+      if (marks_[state] == generation_) {
+        continue;
+      }
+      marks_[state] = generation_;
+      const State& nfa_state = states_[state];
+      if (!nfa_state.transitions.empty() || nfa_state.tags) {
+        states->push_back(state);
+      }
+      stack_.insert(stack_.end(), nfa_state.epsilon.begin(),
+                    nfa_state.epsilon.end());
+    }
+    sort(states->begin(), states->end());
+  }
+
+  // Computes the states reached from the given set of states on each digit.
+  void Step(const vector<int>& states,
+            vector<int> next[DigitAutomaton::kNumDigits]) const {
+    for (int digit = 0; digit < DigitAutomaton::kNumDigits; ++digit) {
+      next[digit].clear();
+    }
+    for (vector<int>::const_iterator it = states.begin(); it != states.end();
+         ++it) {
+      const vector<pair<DigitSet, int> >& transitions =
+          states_[*it].transitions;
+      for (vector<pair<DigitSet, int> >::const_iterator transition =
+               transitions.begin();
+           transition != transitions.end(); ++transition) {
+        for (int digit = 0; digit < DigitAutomaton::kNumDigits; ++digit) {
+          if (transition->first & (1 << digit)) {
+            next[digit].push_back(transition->second);
+          }
+        }
+      }
+    }
+    for (int digit = 0; digit < DigitAutomaton::kNumDigits; ++digit) {
+      Close(&next[digit]);
+    }
+  }
+
+  uint32 Tags(const vector<int>& states) const {
+    uint32 tags = 0;
+    for (vector<int>::const_iterator it = states.begin(); it != states.end();
+         ++it) {
+      tags |= states_[*it].tags;
+    }
+    return tags;
+  }
+
+ private:
+  struct State {
+    State() : epsilon(), transitions(), tags(0) {}
+
+    vector<int> epsilon;
+    vector<pair<DigitSet, int> > transitions;
+    uint32 tags;
+  };
+
+  vector<State> states_;
+  // Scratch space of Close(), kept to avoid reallocating it at every call.
+  mutable vector<int> marks_;
+  mutable int generation_;
+  mutable vector<int> stack_;
+
+  DISALLOW_COPY_AND_ASSIGN(Nfa);
+};
+
+}  // namespace
+
+const int DigitAutomaton::kNumDigits;
+const int DigitAutomaton::kMaxTags;
+const uint16 DigitAutomaton::kDeadState;
+const uint16 DigitAutomaton::kStartState;
+
+// static
+DigitAutomaton* DigitAutomaton::Create(const string& pattern) {
+  return Create(vector<string>(1, pattern));
+}
+
+// static
+DigitAutomaton* DigitAutomaton::Create(const vector<string>& patterns) {
+  DigitAutomaton* automaton = new DigitAutomaton();
+  if (!automaton->Compile(patterns)) {
+    delete automaton;
+    return NULL;
+  }
+  return automaton;
+}
+
+bool DigitAutomaton::Compile(const vector<string>& patterns) {
+  DCHECK(patterns.size() <= static_cast<size_t>(kMaxTags));
+  Nfa nfa;
+  const int nfa_start = nfa.AddState();
+  for (size_t i = 0; i < patterns.size(); ++i) {
+    vector<Node> nodes;
+    const int root = PatternParser(patterns[i], &nodes).Parse();
+    if (root < 0) {
+      return false;
+    }
+    const int pattern_start = nfa.AddState();
+    nfa.AddEpsilon(nfa_start, pattern_start);
+    const int pattern_end = nfa.Build(nodes, root, pattern_start);
+    if (pattern_end < 0) {
+      return false;
+    }
+    nfa.AddTags(pattern_end, 1U << i);
+  }
+
+  // Subset construction. Each state of the automaton stands for a set of
+  // states of the NFA, the empty set being the dead state.
+  map<vector<int>, uint16> state_ids;
+  vector<vector<int> > state_sets;
+  state_sets.push_back(vector<int>());
+  vector<int> start(1, nfa_start);
+  nfa.Close(&start);
+  state_sets.push_back(start);
+  state_ids.insert(make_pair(state_sets[kDeadState], kDeadState));
+  state_ids.insert(make_pair(state_sets[kStartState], kStartState));
+
+  transitions_.assign(2 * kNumDigits, kDeadState);
+  accepted_tags_.assign(2, 0);
+  accepted_tags_[kStartState] = nfa.Tags(start);
+  vector<int> next_sets[kNumDigits];
+  for (size_t state = kStartState; state < state_sets.size(); ++state) {
+    nfa.Step(state_sets[state], next_sets);
+    for (int digit = 0; digit < kNumDigits; ++digit) {
+      const vector<int>& next = next_sets[digit];
+      map<vector<int>, uint16>::const_iterator it = state_ids.find(next);
+      uint16 next_state;
+      if (it != state_ids.end()) {
+        next_state = it->second;
+      } else {
+        if (state_sets.size() >= kMaxDfaStates) {
+          return false;
+        }
+        next_state = static_cast<uint16>(state_sets.size());
+        state_ids.insert(make_pair(next, next_state));
+        state_sets.push_back(next);
+        transitions_.resize(transitions_.size() + kNumDigits, kDeadState);
+        accepted_tags_.push_back(nfa.Tags(next));
+      }
+      transitions_[state * kNumDigits + digit] = next_state;
+    }
+  }
+  return true;
+}
+
+uint32 DigitAutomaton::FullMatchTags(const string& number) const {
+  DCHECK(IsAsciiDigitString(number));
+  uint16 state = kStartState;
+  for (string::const_iterator it = number.begin();
+       it != number.end() && state != kDeadState; ++it) {
+    state = Next(state, *it);
+  }
+  return accepted_tags_[state];
+}
+
+uint32 DigitAutomaton::PrefixMatchTags(const string& number) const {
+  DCHECK(IsAsciiDigitString(number));
+  return PrefixMatchTags(number.data(), number.length());
+}
+
+uint32 DigitAutomaton::PrefixMatchTags(const char* digits,
+                                       size_t length) const {
+  uint16 state = kStartState;
+  uint32 tags = accepted_tags_[state];
+  for (const char* it = digits;
+       it != digits + length && state != kDeadState; ++it) {
+    DCHECK(*it >= '0' && *it <= '9');
+    state = Next(state, *it);
+    tags |= accepted_tags_[state];
+  }
+  return tags;
+}
+
+int DigitAutomaton::ShortestPrefixMatchLength(const char* digits,
+                                              size_t length) const {
+  uint16 state = kStartState;
+  for (size_t i = 0; state != kDeadState; ++i) {
+    if (accepted_tags_[state]) {
+      return static_cast<int>(i);
+    }
+    if (i == length) {
+      break;
+    }
+    DCHECK(digits[i] >= '0' && digits[i] <= '9');
+    state = Next(state, digits[i]);
+  }
+  return -1;
+}
+
+bool DigitAutomaton::IsPrefixFree() const {
+  const size_t num_states = accepted_tags_.size();
+  for (size_t state = kStartState; state < num_states; ++state) {
+    if (!accepted_tags_[state]) {
+      continue;
+    }
+    // Looks for an accepting state reachable from this one.
+    vector<bool> reached(num_states, false);
+    vector<size_t> pending(1, state);
+    while (!pending.empty()) {
+      const size_t current = pending.back();
+      pending.pop_back();
+      for (int digit = 0; digit < kNumDigits; ++digit) {
+        const uint16 next = transitions_[current * kNumDigits + digit];
+        if (next == kDeadState || reached[next]) {
+          continue;
+        }
+        if (accepted_tags_[next]) {
+          return false;
+        }
+        reached[next] = true;
+        pending.push_back(next);
+      }
+    }
+  }
+  return true;
+}
+
+bool IsAsciiDigitString(const string& s) {
+  for (string::const_iterator it = s.begin(); it != s.end(); ++it) {
+    if (*it < '0' || *it > '9') {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
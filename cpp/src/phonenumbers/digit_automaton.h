@@ -0,0 +1,136 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// DigitAutomaton is a deterministic finite automaton over the alphabet of the
+// ten ASCII decimal digits. It is compiled from the small subset of the regular
+// expression syntax that is used by the number patterns of the metadata
+// (literal digits, \d, character classes, groups, alternations and
+// quantifiers), and can be run without allocating any memory.
+//
+// Every pattern the automaton is compiled from carries a tag bit. Running the
+// automaton over a number returns the set of tags whose pattern matched, so
+// several patterns can be evaluated in a single scan of the number.
+//
+// scoped_ptr<const DigitAutomaton> automaton(
+//     DigitAutomaton::Create("[2-9]\\d{7}"));
+// if (automaton.get()) {
+//   bool matches = automaton->FullMatch("23456789");
+// }
+
+#ifndef I18N_PHONENUMBERS_DIGIT_AUTOMATON_H_
+#define I18N_PHONENUMBERS_DIGIT_AUTOMATON_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "phonenumbers/base/basictypes.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+using std::vector;
+
+class DigitAutomaton {
+ public:
+  // Size of the input alphabet.
+  static const int kNumDigits = 10;
+  // Maximum number of patterns (and therefore tags) per automaton.
+  static const int kMaxTags = 32;
+
+  // Compiles a single pattern into an automaton whose only tag is 1. Returns
+  // NULL if the pattern uses a construct that is not supported, or if the
+  // resulting automaton would be too large. The deletion of the returned
+  // instance is under the responsibility of the caller.
+  static DigitAutomaton* Create(const string& pattern);
+
+  // Compiles several patterns into a single automaton, the i-th pattern being
+  // tagged with the bit (1 << i). There can't be more than kMaxTags patterns.
+  // Returns NULL under the same conditions as Create(const string&).
+  static DigitAutomaton* Create(const vector<string>& patterns);
+
+  // Returns true if number, which must only contain ASCII digits, is matched
+  // in its entirety by the pattern.
+  bool FullMatch(const string& number) const {
+    return FullMatchTags(number) != 0;
+  }
+
+  // Returns true if a prefix of number, which must only contain ASCII digits,
+  // is matched by the pattern. This is the equivalent of RegExp::Consume().
+  bool PrefixMatch(const string& number) const {
+    return PrefixMatchTags(number) != 0;
+  }
+
+  // Same as PrefixMatch(const string&), for the number made of the length
+  // digits pointed to by digits.
+  bool PrefixMatch(const char* digits, size_t length) const {
+    return PrefixMatchTags(digits, length) != 0;
+  }
+
+  // Returns the tags of the patterns matching number in its entirety.
+  uint32 FullMatchTags(const string& number) const;
+
+  // Returns the tags of the patterns matching a prefix of number.
+  uint32 PrefixMatchTags(const string& number) const;
+
+  // Returns the tags of the patterns matching a prefix of the number made of
+  // the length digits pointed to by digits.
+  uint32 PrefixMatchTags(const char* digits, size_t length) const;
+
+  // Returns the length of the shortest prefix of the number made of the length
+  // digits pointed to by digits which is matched by the pattern, or -1 if there
+  // is none.
+  int ShortestPrefixMatchLength(const char* digits, size_t length) const;
+
+  // Returns true if no string matched by the patterns is a proper prefix of
+  // another one. A number then starts with at most one match, which is the
+  // prefix any regular expression engine consumes, whatever the order in which
+  // it tries the alternatives and the quantifiers of the pattern.
+  bool IsPrefixFree() const;
+
+  // Returns the number of states, including the dead state.
+  size_t num_states() const { return accepted_tags_.size(); }
+
+ private:
+  // The dead state, which has no outgoing transitions and accepts nothing.
+  static const uint16 kDeadState = 0;
+  static const uint16 kStartState = 1;
+
+  DigitAutomaton() {}
+
+  // Compiles the given patterns into this automaton. The i-th pattern is
+  // tagged with the bit (1 << i). Returns false if one of the patterns is not
+  // supported.
+  bool Compile(const vector<string>& patterns);
+
+  uint16 Next(uint16 state, char digit) const {
+    return transitions_[state * kNumDigits + (digit - '0')];
+  }
+
+  // Transition table, indexed by state * kNumDigits + digit.
+  vector<uint16> transitions_;
+  // The tags of the patterns that accept in each state.
+  vector<uint32> accepted_tags_;
+
+  DISALLOW_COPY_AND_ASSIGN(DigitAutomaton);
+};
+
+// Returns true if s only contains ASCII digits.
+bool IsAsciiDigitString(const string& s);
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_DIGIT_AUTOMATON_H_
@@ -0,0 +1,125 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/digit_block_splitter.h"
+
+#include "phonenumbers/base/logging.h"
+#include "phonenumbers/digit_group_pattern.h"
+#include "phonenumbers/phonemetadata.pb.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+namespace {
+
+// The separators of the groups in the formats with a known layout. They are
+// all part of PhoneNumberUtil::kValidPunctuation, so that the RFC3966 format
+// replaces each of them by a single '-'.
+const char kSeparatorChars[] = " -./";
+
+}  // namespace
+
+// The pattern of a format made of groups of digits, whose format separates all
+// the groups. The separators of the format between the groups end the blocks.
+class DigitBlockSplitter::Layout {
+ public:
+  // Returns the layout of format, or NULL if it is not known.
+  static Layout* Create(const NumberFormat& format) {
+    Layout* layout = new Layout();
+    if (!layout->pattern_.Parse(format.pattern()) ||
+        !layout->IsFormatOfAllGroups(format.format())) {
+      delete layout;
+      return NULL;
+    }
+    return layout;
+  }
+
+  void Split(const string& national_number,
+             vector<StringPiece>* blocks) const {
+    const int length = static_cast<int>(national_number.length());
+    const char* const digits = national_number.data();
+    int group_ends[DigitGroupPattern::kMaxGroups];
+    int match_start;
+    int block_start = 0;
+    int offset = 0;
+    // The pattern is replaced again after each match. Nothing separates the
+    // last group of a replacement from the digits up to the first group of the
+    // next one, or from the digits left after the last one, so that they end
+    // up in the same block.
+    while (pattern_.Match(national_number, offset, &match_start, group_ends)) {
+      for (int i = 1; i < pattern_.num_groups(); ++i) {
+        blocks->push_back(
+            StringPiece(digits + block_start, group_ends[i - 1] - block_start));
+        block_start = group_ends[i - 1];
+      }
+      offset = group_ends[pattern_.num_groups() - 1];
+    }
+    if (length > block_start) {
+      blocks->push_back(StringPiece(digits + block_start,
+                                    length - block_start));
+    }
+  }
+
+ private:
+  Layout() : pattern_() {}
+
+  // Returns true if the format is made of all the groups in order, separated
+  // by kSeparatorChars, e.g. "$1 $2".
+  bool IsFormatOfAllGroups(const string& format) const {
+    size_t index = 0;
+    for (int group = 1; group <= pattern_.num_groups(); ++group) {
+      if (group > 1) {
+        const size_t separator_end =
+            format.find_first_not_of(kSeparatorChars, index);
+        if (separator_end == index || separator_end == string::npos) {
+          return false;
+        }
+        index = separator_end;
+      }
+      if (index + 1 >= format.length() || format[index] != '$' ||
+          format[index + 1] != static_cast<char>('0' + group)) {
+        return false;
+      }
+      index += 2;
+    }
+    return index == format.length();
+  }
+
+  DigitGroupPattern pattern_;
+
+  DISALLOW_COPY_AND_ASSIGN(Layout);
+};
+
+DigitBlockSplitter::DigitBlockSplitter()
+    : cache_impl_(new CacheImpl(256)) {}
+
+DigitBlockSplitter::~DigitBlockSplitter() {}
+
+bool DigitBlockSplitter::Split(const string& national_number,
+                               const NumberFormat& format,
+                               vector<StringPiece>* blocks) const {
+  DCHECK(blocks);
+  const Layout* layout;
+  if (!cache_impl_->Find(&format, &layout)) {
+    layout = cache_impl_->Insert(&format, Layout::Create(format));
+  }
+  if (!layout) {
+    return false;
+  }
+  layout->Split(national_number, blocks);
+  return true;
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -0,0 +1,73 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Splits national significant numbers into the blocks of digits a NumberFormat
+// groups together, i.e. the parts of their RFC3966 format separated by '-',
+// without formatting them. This is what the grouping checks of
+// PhoneNumberMatcher compare the candidates with.
+//
+// The layout of a format is computed once, from its pattern and its format, and
+// cached. It is only known for the patterns made of groups of digits, such as
+// "(\d{3})(\d{3,4})" or "([2-9]\d)(\d{4})", whose format joins all the
+// groups in order with punctuation, such as "$1-$2", which most of the formats
+// are. The number is
+// then sliced where the global replacement of the pattern done when formatting
+// it would match the groups.
+
+#ifndef I18N_PHONENUMBERS_DIGIT_BLOCK_SPLITTER_H_
+#define I18N_PHONENUMBERS_DIGIT_BLOCK_SPLITTER_H_
+
+#include <string>
+#include <vector>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/base/memory/scoped_ptr.h"
+#include "phonenumbers/base/strings/string_piece.h"
+#include "phonenumbers/read_mostly_cache.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+using std::vector;
+
+class NumberFormat;
+
+class DigitBlockSplitter {
+ public:
+  DigitBlockSplitter();
+  ~DigitBlockSplitter();
+
+  // Appends to blocks the digit blocks of national_number, made of ASCII
+  // digits, formatted with format by PhoneNumberUtil::FormatNsnUsingPattern()
+  // in RFC3966, and returns true. The blocks point to national_number. Returns
+  // false if the layout of the format is not known, in which case the number
+  // has to be formatted. The format must outlive this instance, since its
+  // layout is cached.
+  bool Split(const string& national_number, const NumberFormat& format,
+             vector<StringPiece>* blocks) const;
+
+ private:
+  class Layout;
+  typedef ReadMostlyCache<const NumberFormat*, Layout> CacheImpl;
+
+  const scoped_ptr<CacheImpl> cache_impl_;
+
+  DISALLOW_COPY_AND_ASSIGN(DigitBlockSplitter);
+};
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_DIGIT_BLOCK_SPLITTER_H_
@@ -0,0 +1,182 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/digit_group_pattern.h"
+
+#include "phonenumbers/base/logging.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+namespace {
+
+const uint16 kAllDigits = (1 << 10) - 1;
+
+// Parses the number starting at the index-th character of s, which is at most
+// 99, and moves index after it. Returns -1 if there is none.
+int ParseSmallNumber(const string& s, size_t* index) {
+  int number = -1;
+  for (; *index < s.length() && s[*index] >= '0' && s[*index] <= '9';
+       ++*index) {
+    number = (number < 0 ? 0 : 10 * number) + (s[*index] - '0');
+    if (number > 99) {
+      return -1;
+    }
+  }
+  return number;
+}
+
+bool IsDigit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+// Parses the character class of digits starting at the index-th character of
+// pattern, e.g. "[2-79]", and moves index after it. Returns the digits of the
+// class, or 0 if it isn't made of digits and ranges of digits.
+uint16 ParseDigitClass(const string& pattern, size_t* index) {
+  DCHECK_EQ('[', pattern[*index]);
+  uint16 digits = 0;
+  size_t i = *index + 1;
+  while (i < pattern.length() && pattern[i] != ']') {
+    if (!IsDigit(pattern[i])) {
+      return 0;
+    }
+    const char first = pattern[i];
+    char last = first;
+    if (i + 2 < pattern.length() && pattern[i + 1] == '-') {
+      last = pattern[i + 2];
+      if (!IsDigit(last) || last < first) {
+        return 0;
+      }
+      i += 2;
+    }
+    for (char c = first; c <= last; ++c) {
+      digits |= 1 << (c - '0');
+    }
+    ++i;
+  }
+  if (i == pattern.length()) {
+    return 0;
+  }
+  *index = i + 1;
+  return digits;
+}
+
+}  // namespace
+
+DigitGroupPattern::DigitGroupPattern()
+    : atoms_(), num_groups_(0), min_length_(0) {}
+
+DigitGroupPattern::~DigitGroupPattern() {}
+
+bool DigitGroupPattern::Parse(const string& pattern) {
+  atoms_.clear();
+  num_groups_ = 0;
+  min_length_ = 0;
+  size_t index = 0;
+  while (index < pattern.length()) {
+    if (pattern[index] != '(' || num_groups_ == kMaxGroups) {
+      return false;
+    }
+    ++index;
+    int group_min_length = 0;
+    while (index < pattern.length() && pattern[index] != ')') {
+      Atom atom;
+      if (IsDigit(pattern[index])) {
+        atom.digits = 1 << (pattern[index] - '0');
+        ++index;
+      } else if (pattern.compare(index, 2, "\\d") == 0) {
+        atom.digits = kAllDigits;
+        index += 2;
+      } else if (pattern[index] == '[') {
+        atom.digits = ParseDigitClass(pattern, &index);
+        if (!atom.digits) {
+          return false;
+        }
+      } else {
+        return false;
+      }
+      atom.min_count = 1;
+      atom.max_count = 1;
+      if (index < pattern.length() && pattern[index] == '{') {
+        ++index;
+        atom.min_count = atom.max_count = ParseSmallNumber(pattern, &index);
+        if (index < pattern.length() && pattern[index] == ',') {
+          ++index;
+          atom.max_count = ParseSmallNumber(pattern, &index);
+        }
+        if (index == pattern.length() || pattern[index] != '}' ||
+            atom.min_count < 0 || atom.max_count < atom.min_count) {
+          return false;
+        }
+        ++index;
+      }
+      atom.ended_group = -1;
+      atoms_.push_back(atom);
+      group_min_length += atom.min_count;
+    }
+    // Groups which can be empty would make the replacements of empty matches
+    // matter.
+    if (index == pattern.length() || group_min_length == 0) {
+      return false;
+    }
+    ++index;
+    atoms_.back().ended_group = num_groups_++;
+    min_length_ += group_min_length;
+  }
+  return num_groups_ > 0;
+}
+
+bool DigitGroupPattern::Match(const string& number, int offset,
+                              int* match_start, int* group_ends) const {
+  DCHECK(match_start);
+  DCHECK(group_ends);
+  const int length = static_cast<int>(number.length());
+  for (int start = offset; start + min_length_ <= length; ++start) {
+    if (MatchAtoms(number, 0, start, group_ends)) {
+      *match_start = start;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool DigitGroupPattern::MatchAtoms(const string& number, size_t atom_index,
+                                   int position, int* group_ends) const {
+  if (atom_index == atoms_.size()) {
+    return true;
+  }
+  const Atom& atom = atoms_[atom_index];
+  const int length = static_cast<int>(number.length());
+  int count = 0;
+  while (count < atom.max_count && position + count < length &&
+         IsDigit(number[position + count]) &&
+         (atom.digits & (1 << (number[position + count] - '0')))) {
+    ++count;
+  }
+  // The quantifiers are greedy, so that the longest repetitions are tried
+  // first.
+  for (; count >= atom.min_count; --count) {
+    if (atom.ended_group >= 0) {
+      group_ends[atom.ended_group] = position + count;
+    }
+    if (MatchAtoms(number, atom_index + 1, position + count, group_ends)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
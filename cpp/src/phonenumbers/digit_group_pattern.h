@@ -0,0 +1,88 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// The patterns of the formats which are only made of groups of digits, such as
+// "(\d{3})(\d{3,4})" or "([2-9]\d{2})(\d{4})", which most of the formats of the
+// metadata are. Such patterns are matched against numbers made of ASCII
+// digits without running a regular expression, with the same results.
+
+#ifndef I18N_PHONENUMBERS_DIGIT_GROUP_PATTERN_H_
+#define I18N_PHONENUMBERS_DIGIT_GROUP_PATTERN_H_
+
+#include <string>
+#include <vector>
+
+#include "phonenumbers/base/basictypes.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+using std::vector;
+
+class DigitGroupPattern {
+ public:
+  // The maximum number of groups of a pattern, since the formats refer to them
+  // with a single digit.
+  static const int kMaxGroups = 9;
+
+  DigitGroupPattern();
+  ~DigitGroupPattern();
+
+  // Parses a pattern made of groups of digits, "\d" or character classes of
+  // digits, each optionally followed by a "{n}" or "{m,n}" quantifier, e.g.
+  // "(\d{3})([2-9]\d{3,4})". Returns false for any other pattern.
+  bool Parse(const string& pattern);
+
+  int num_groups() const {
+    return num_groups_;
+  }
+
+  // Finds the first match of the pattern in number starting at or after
+  // offset, which is the match
+  // RegExp::GlobalReplace() would replace next. Sets match_start to its start
+  // and group_ends[i] to the end of its i-th group, the groups being
+  // contiguous. Returns false if there is no match. group_ends must have room
+  // for num_groups() elements.
+  bool Match(const string& number, int offset, int* match_start,
+             int* group_ends) const;
+
+ private:
+  // A digit, \d or a character class, and its quantifier.
+  struct Atom {
+    // Bit mask of the digits matched, bit i standing for the digit i.
+    uint16 digits;
+    int min_count;
+    int max_count;
+    // The group of the atom, starting at 0, if the atom ends it, or -1.
+    int ended_group;
+  };
+
+  // Matches the atoms starting at atom_index at position in number, with the
+  // priorities of the greedy quantifiers of a regular expression.
+  bool MatchAtoms(const string& number, size_t atom_index, int position,
+                  int* group_ends) const;
+
+  vector<Atom> atoms_;
+  int num_groups_;
+  // The minimum length of the numbers matched.
+  int min_length_;
+
+  DISALLOW_COPY_AND_ASSIGN(DigitGroupPattern);
+};
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_DIGIT_GROUP_PATTERN_H_
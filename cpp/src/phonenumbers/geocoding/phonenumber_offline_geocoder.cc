@@ -17,7 +17,6 @@
 #include "phonenumbers/geocoding/phonenumber_offline_geocoder.h"
 
 #include <algorithm>
-#include <map>
 #include <string>
 
 #include <unicode/unistr.h>  // NOLINT(build/include_order)
@@ -26,17 +25,19 @@
 #include "phonenumbers/geocoding/geocoding_data.h"
 #include "phonenumbers/geocoding/mapping_file_provider.h"
 #include "phonenumbers/phonenumberutil.h"
-#include "phonenumbers/stl_util.h"
+#include "phonenumbers/read_mostly_cache.h"
 
 namespace i18n {
 namespace phonenumbers {
 
 using icu::UnicodeString;
-using std::map;
 using std::string;
 
 namespace {
 
+// The number of maps the cache of the loaded maps is initially sized for.
+const size_t kMinAreaCodeMaps = 64;
+
 // Returns true if s1 comes strictly before s2 in lexicographic order.
 bool IsLowerThan(const char* s1, const char* s2) {
   return strcmp(s1, s2) < 0;
@@ -44,7 +45,9 @@ bool IsLowerThan(const char* s1, const char* s2) {
 
 }  // namespace
 
-PhoneNumberOfflineGeocoder::PhoneNumberOfflineGeocoder() {
+PhoneNumberOfflineGeocoder::PhoneNumberOfflineGeocoder()
+    : available_maps_(new AreaCodeMaps(kMinAreaCodeMaps)),
+      load_lock_() {
   Init(get_country_calling_codes(), get_country_calling_codes_size(),
        get_country_languages, get_prefix_language_code_pairs(),
        get_prefix_language_code_pairs_size(), get_prefix_descriptions);
@@ -55,7 +58,9 @@ PhoneNumberOfflineGeocoder::PhoneNumberOfflineGeocoder(
     country_languages_getter get_country_languages,
     const char** prefix_language_code_pairs,
     int prefix_language_code_pairs_size,
-    prefix_descriptions_getter get_prefix_descriptions) {
+    prefix_descriptions_getter get_prefix_descriptions)
+    : available_maps_(new AreaCodeMaps(kMinAreaCodeMaps)),
+      load_lock_() {
   Init(country_calling_codes, country_calling_codes_size,
        get_country_languages, prefix_language_code_pairs,
        prefix_language_code_pairs_size, get_prefix_descriptions);
@@ -76,9 +81,12 @@ void PhoneNumberOfflineGeocoder::Init(
   get_prefix_descriptions_ = get_prefix_descriptions;
 }
 
-PhoneNumberOfflineGeocoder::~PhoneNumberOfflineGeocoder() {
-  STLDeleteContainerPairSecondPointers(
-      available_maps_.begin(), available_maps_.end());
+PhoneNumberOfflineGeocoder::~PhoneNumberOfflineGeocoder() {}
+
+void PhoneNumberOfflineGeocoder::LoadAllAreaCodeMaps() const {
+  for (int i = 0; i < prefix_language_code_pairs_size_; ++i) {
+    GetAreaCodeMap(prefix_language_code_pairs_[i]);
+  }
 }
 
 const AreaCodeMap* PhoneNumberOfflineGeocoder::GetPhonePrefixDescriptions(
@@ -89,18 +97,25 @@ const AreaCodeMap* PhoneNumberOfflineGeocoder::GetPhonePrefixDescriptions(
   if (filename.empty()) {
     return NULL;
   }
-  AreaCodeMaps::const_iterator it = available_maps_.find(filename);
-  if (it == available_maps_.end()) {
-    it = LoadAreaCodeMapFromFile(filename);
-    if (it == available_maps_.end()) {
-      return NULL;
-    }
+  return GetAreaCodeMap(filename);
+}
+
+const AreaCodeMap* PhoneNumberOfflineGeocoder::GetAreaCodeMap(
+    const string& filename) const {
+  const AreaCodeMap* area_code_map;
+  if (available_maps_->Find(filename, &area_code_map)) {
+    return area_code_map;
+  }
+  AutoLock l(load_lock_);
+  // Another thread may have loaded the map while this one was waiting.
+  if (available_maps_->Find(filename, &area_code_map)) {
+    return area_code_map;
   }
-  return it->second;
+  // The files which don't exist are cached as well, as NULL maps.
+  return available_maps_->Insert(filename, LoadAreaCodeMapFromFile(filename));
 }
 
-PhoneNumberOfflineGeocoder::AreaCodeMaps::const_iterator
-PhoneNumberOfflineGeocoder::LoadAreaCodeMapFromFile(
+const AreaCodeMap* PhoneNumberOfflineGeocoder::LoadAreaCodeMapFromFile(
     const string& filename) const {
   const char** const prefix_language_code_pairs_end =
       prefix_language_code_pairs_ + prefix_language_code_pairs_size_;
@@ -113,9 +128,9 @@ PhoneNumberOfflineGeocoder::LoadAreaCodeMapFromFile(
     AreaCodeMap* const m = new AreaCodeMap();
     m->ReadAreaCodeMap(get_prefix_descriptions_(
             prefix_language_code_pair - prefix_language_code_pairs_));
-    return available_maps_.insert(AreaCodeMaps::value_type(filename, m)).first;
+    return m;
   }
-  return available_maps_.end();
+  return NULL;
 }
 
 string PhoneNumberOfflineGeocoder::GetCountryNameForNumber(
@@ -17,18 +17,17 @@
 #ifndef I18N_PHONENUMBERS_GEOCODING_PHONENUMBER_OFFLINE_GEOCODER_H_
 #define I18N_PHONENUMBERS_GEOCODING_PHONENUMBER_OFFLINE_GEOCODER_H_
 
-#include <map>
 #include <string>
 
 #include <unicode/locid.h>  // NOLINT(build/include_order)
 
 #include "phonenumbers/base/basictypes.h"
 #include "phonenumbers/base/memory/scoped_ptr.h"
+#include "phonenumbers/base/synchronization/lock.h"
 
 namespace i18n {
 namespace phonenumbers {
 
-using std::map;
 using std::string;
 
 class AreaCodeMap;
@@ -37,13 +36,17 @@ class PhoneNumber;
 class PhoneNumberUtil;
 struct CountryLanguages;
 struct PrefixDescriptions;
+template <typename Key, typename Value> class ReadMostlyCache;
 typedef icu::Locale Locale;
 
 // An offline geocoder which provides geographical information related to a
 // phone number.
+//
+// This class is thread-safe. The phone prefix maps are loaded the first time
+// they are needed, after which looking them up doesn't take any lock.
 class PhoneNumberOfflineGeocoder {
  private:
-  typedef map<string, const AreaCodeMap*> AreaCodeMaps;
+  typedef ReadMostlyCache<string, AreaCodeMap> AreaCodeMaps;
 
  public:
   typedef const CountryLanguages* (*country_languages_getter)(int index);
@@ -62,6 +65,15 @@ class PhoneNumberOfflineGeocoder {
 
   virtual ~PhoneNumberOfflineGeocoder();
 
+  // Builds the area code map of every prefix and language pair of the
+  // geocoding data, e.g. "1_en" or "33_fr", which is otherwise only built the
+  // first time a number is described with it. The maps point into the
+  // compiled-in descriptions instead of copying them, so this only costs one
+  // small index object per pair, kept until the geocoder is destroyed. This
+  // can be called while other threads call GetDescriptionForNumber(): each map
+  // is built once under a lock before being published in the cache.
+  void LoadAllAreaCodeMaps() const;
+
   // Returns a text description for the given phone number, in the language
   // provided. The description might consist of the name of the country where
   // the phone number is from, or the name of the geographical area the phone
@@ -113,8 +125,13 @@ class PhoneNumberOfflineGeocoder {
   const AreaCodeMap* GetPhonePrefixDescriptions(int prefix,
       const string& language, const string& script, const string& region) const;
 
-  AreaCodeMaps::const_iterator LoadAreaCodeMapFromFile(
-      const string& filename) const;
+  // Returns the map loaded from filename, or NULL if there is no such file.
+  // The caller takes ownership of the map.
+  const AreaCodeMap* LoadAreaCodeMapFromFile(const string& filename) const;
+
+  // Returns the map loaded from filename, loading it if this wasn't done yet,
+  // or NULL if there is no such file.
+  const AreaCodeMap* GetAreaCodeMap(const string& filename) const;
 
   // Returns the customary display name in the given language for the given
   // region.
@@ -153,7 +170,10 @@ class PhoneNumberOfflineGeocoder {
 
   // A mapping from country calling codes languages pairs to the corresponding
   // phone prefix map that has been loaded.
-  mutable AreaCodeMaps available_maps_;
+  const scoped_ptr<AreaCodeMaps> available_maps_;
+  // Serializes the loading of the maps, so that a map requested by several
+  // threads at once is only loaded once.
+  mutable Lock load_lock_;
 
   DISALLOW_COPY_AND_ASSIGN(PhoneNumberOfflineGeocoder);
 };
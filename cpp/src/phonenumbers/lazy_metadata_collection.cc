@@ -0,0 +1,150 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/lazy_metadata_collection.h"
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+
+#include "phonenumbers/base/logging.h"
+#include "phonenumbers/base/synchronization/atomicops.h"
+#include "phonenumbers/default_logger.h"
+#include "phonenumbers/phonemetadata.pb.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using google::protobuf::io::CodedInputStream;
+using google::protobuf::internal::WireFormatLite;
+
+namespace {
+
+// Field numbers of the serialized messages, from phonemetadata.proto.
+const int kCollectionMetadataField = 1;  // PhoneMetadataCollection.metadata
+const int kIdField = 9;  // PhoneMetadata.id
+const int kCountryCodeField = 10;  // PhoneMetadata.country_code
+const int kMainCountryForCodeField = 22;  // PhoneMetadata.main_country_for_code
+
+uint32 MakeTag(int field_number, WireFormatLite::WireType wire_type) {
+  return WireFormatLite::MakeTag(field_number, wire_type);
+}
+
+}  // namespace
+
+LazyMetadataCollection::Entry::Entry()
+    : data(NULL),
+      size(0),
+      id(),
+      country_code(0),
+      main_country_for_code(false),
+      metadata(NULL) {}
+
+LazyMetadataCollection::LazyMetadataCollection()
+    : lock_(),
+      entries_() {}
+
+LazyMetadataCollection::~LazyMetadataCollection() {
+  for (vector<Entry>::const_iterator it = entries_.begin();
+       it != entries_.end(); ++it) {
+    delete it->metadata;
+  }
+}
+
+bool LazyMetadataCollection::Init(const void* data, int size) {
+  DCHECK(entries_.empty());
+  const uint8* const bytes = static_cast<const uint8*>(data);
+  CodedInputStream input(bytes, size);
+  const uint32 metadata_tag = MakeTag(kCollectionMetadataField,
+                                      WireFormatLite::WIRETYPE_LENGTH_DELIMITED);
+  uint32 tag;
+  while ((tag = input.ReadTag()) != 0) {
+    if (tag != metadata_tag) {
+      if (!WireFormatLite::SkipField(&input, tag)) {
+        return false;
+      }
+      continue;
+    }
+    uint32 length;
+    if (!input.ReadVarint32(&length) ||
+        length > static_cast<uint32>(size - input.CurrentPosition())) {
+      return false;
+    }
+    Entry entry;
+    entry.data = bytes + input.CurrentPosition();
+    entry.size = static_cast<int>(length);
+    if (!ReadEntryKeys(&entry) || !input.Skip(entry.size)) {
+      return false;
+    }
+    entries_.push_back(entry);
+  }
+  // ReadTag() also returns 0 on malformed tags.
+  return input.CurrentPosition() == size;
+}
+
+// static
+bool LazyMetadataCollection::ReadEntryKeys(Entry* entry) {
+  CodedInputStream input(entry->data, entry->size);
+  uint32 tag;
+  while ((tag = input.ReadTag()) != 0) {
+    if (tag == MakeTag(kIdField, WireFormatLite::WIRETYPE_LENGTH_DELIMITED)) {
+      if (!WireFormatLite::ReadString(&input, &entry->id)) {
+        return false;
+      }
+    } else if (tag == MakeTag(kCountryCodeField,
+                              WireFormatLite::WIRETYPE_VARINT)) {
+      uint32 country_code;
+      if (!input.ReadVarint32(&country_code)) {
+        return false;
+      }
+      entry->country_code = static_cast<int>(country_code);
+    } else if (tag == MakeTag(kMainCountryForCodeField,
+                              WireFormatLite::WIRETYPE_VARINT)) {
+      uint32 main_country_for_code;
+      if (!input.ReadVarint32(&main_country_for_code)) {
+        return false;
+      }
+      entry->main_country_for_code = main_country_for_code != 0;
+    } else if (!WireFormatLite::SkipField(&input, tag)) {
+      return false;
+    }
+  }
+  return input.CurrentPosition() == entry->size;
+}
+
+const PhoneMetadata* LazyMetadataCollection::Get(int index) const {
+  DCHECK_GE(index, 0);
+  DCHECK_LT(index, size());
+  Entry& entry = entries_[index];
+  const PhoneMetadata* metadata = Acquire_Load(&entry.metadata);
+  if (metadata) {
+    return metadata;
+  }
+  AutoLock l(lock_);
+  if (entry.metadata) {
+    return entry.metadata;
+  }
+  PhoneMetadata* const parsed_metadata = new PhoneMetadata();
+  if (!parsed_metadata->ParseFromArray(entry.data, entry.size)) {
+    // The region would otherwise look unsupported.
+    LOG(DFATAL) << "Could not parse compiled-in metadata of region "
+                << entry.id << ".";
+    delete parsed_metadata;
+    return NULL;
+  }
+  Release_Store(&entry.metadata, parsed_metadata);
+  return parsed_metadata;
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -0,0 +1,107 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// LazyMetadataCollection gives access to the PhoneMetadata messages of a
+// serialized PhoneMetadataCollection without parsing it as a whole.
+//
+// Init() only scans the serialized collection to locate its entries and to
+// read the few fields needed to index them (id, country_code and
+// main_country_for_code). An entry is parsed into a PhoneMetadata the first
+// time it is requested, which is safe to do from several threads. The
+// serialized data is not copied and must outlive the collection.
+//
+// LazyMetadataCollection collection;
+// if (collection.Init(metadata_get(), metadata_size())) {
+//   for (int i = 0; i < collection.size(); ++i) {
+//     if (collection.id(i) == "CH") {
+//       const PhoneMetadata* metadata = collection.Get(i);
+//     }
+//   }
+// }
+
+#ifndef I18N_PHONENUMBERS_LAZY_METADATA_COLLECTION_H_
+#define I18N_PHONENUMBERS_LAZY_METADATA_COLLECTION_H_
+
+#include <string>
+#include <vector>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/base/synchronization/lock.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+using std::vector;
+
+class PhoneMetadata;
+
+class LazyMetadataCollection {
+ public:
+  LazyMetadataCollection();
+  ~LazyMetadataCollection();
+
+  // Indexes the serialized PhoneMetadataCollection of size bytes pointed to by
+  // data, which must remain valid for the lifetime of this object. Returns
+  // false if the data is malformed. Must be called once, before any other
+  // method.
+  bool Init(const void* data, int size);
+
+  // Returns the number of metadata entries of the collection.
+  int size() const { return static_cast<int>(entries_.size()); }
+
+  // Accessors to the fields of the index-th entry which are read by Init().
+  const string& id(int index) const { return entries_[index].id; }
+  int country_code(int index) const { return entries_[index].country_code; }
+  bool main_country_for_code(int index) const {
+    return entries_[index].main_country_for_code;
+  }
+
+  // Returns the index-th metadata entry, parsing it the first time it is
+  // requested. Returns NULL, after logging an error, if it can't be parsed,
+  // which only happens if the compiled-in metadata is corrupt. This method is
+  // thread-safe and the returned pointer remains valid for the lifetime of this
+  // object.
+  const PhoneMetadata* Get(int index) const;
+
+ private:
+  struct Entry {
+    Entry();
+
+    // The serialized PhoneMetadata message.
+    const uint8* data;
+    int size;
+
+    string id;
+    int country_code;
+    bool main_country_for_code;
+
+    // The parsed message, NULL until it is first requested. Published with a
+    // release store so that it can be read without taking lock_.
+    PhoneMetadata* metadata;
+  };
+
+  // Reads the fields of the entry which are used as keys.
+  static bool ReadEntryKeys(Entry* entry);
+
+  mutable Lock lock_;  // serializes the parsing of the entries
+  mutable vector<Entry> entries_;
+
+  DISALLOW_COPY_AND_ASSIGN(LazyMetadataCollection);
+};
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_LAZY_METADATA_COLLECTION_H_
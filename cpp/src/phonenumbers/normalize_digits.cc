@@ -0,0 +1,213 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/normalize_digits.h"
+
+#include <string.h>
+
+#include <unicode/uchar.h>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/sse2_util.h"
+#include "phonenumbers/utf/utf.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+namespace {
+
+// The full-width plus sign, U+FF0B.
+const char kFullWidthPlusSign[] = "\xEF\xBC\x8B";
+
+bool IsAsciiDigit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+bool IsAsciiLetter(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+// Decodes the character starting at the offset-th byte of s, of length bytes,
+// and returns its length in bytes.
+int DecodeCharacter(const char* s, size_t length, size_t offset, Rune* rune) {
+  const int character_length =
+      charntorune(rune, s + offset, static_cast<int>(length - offset));
+  // Incomplete characters are skipped one byte at a time.
+  return character_length > 0 ? character_length : 1;
+}
+
+#if defined(I18N_PHONENUMBERS_USE_SSE2)
+
+const int kBlockSize = 16;
+
+int CountBits(uint32 mask) {
+  int count = 0;
+  for (; mask; mask &= mask - 1) {
+    ++count;
+  }
+  return count;
+}
+
+__m128i LoadBlock(const char* s) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+}
+
+// Returns the mask of the bytes of the block which are not ASCII.
+uint32 NonAsciiMask(__m128i block) {
+  return static_cast<uint32>(_mm_movemask_epi8(block));
+}
+
+// Returns the mask of the bytes of the block within [first, first + size),
+// for size <= 127.
+uint32 RangeMask(__m128i block, char first, char size) {
+  // Bytes below first wrap around and end up above size, as do non-ASCII
+  // bytes since size is small.
+  const __m128i offsets = _mm_sub_epi8(block, _mm_set1_epi8(first));
+  const __m128i max_offset = _mm_set1_epi8(static_cast<char>(size - 1));
+  return static_cast<uint32>(_mm_movemask_epi8(
+      _mm_cmpeq_epi8(_mm_min_epu8(offsets, max_offset), offsets)));
+}
+
+uint32 AsciiDigitMask(__m128i block) {
+  return RangeMask(block, '0', 10);
+}
+
+uint32 AsciiLetterMask(__m128i block) {
+  // Setting the 0x20 bit maps the upper-case letters to lower-case ones, and
+  // doesn't map any other character to a lower-case letter.
+  return RangeMask(_mm_or_si128(block, _mm_set1_epi8(0x20)), 'a', 26);
+}
+
+#endif  // I18N_PHONENUMBERS_USE_SSE2
+
+}  // namespace
+
+void StripNonDigitsAndNormalize(string* number) {
+  if (number->empty()) {
+    return;
+  }
+  // The number is normalized in place: the output is never longer than the
+  // input read so far.
+  char* const data = &(*number)[0];
+  const size_t length = number->length();
+  size_t read = 0;
+  size_t written = 0;
+  while (read < length) {
+#if defined(I18N_PHONENUMBERS_USE_SSE2)
+    if (read + kBlockSize <= length) {
+      const __m128i block = LoadBlock(data + read);
+      const uint32 non_ascii_mask = NonAsciiMask(block);
+      // Only the bytes before the first non-ASCII byte are handled here.
+      const int num_ascii_bytes =
+          non_ascii_mask ? CountTrailingZeros(non_ascii_mask) : kBlockSize;
+      const uint32 digit_mask =
+          AsciiDigitMask(block) & ((1U << num_ascii_bytes) - 1);
+      if (digit_mask == 0xFFFF) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + written), block);
+        written += kBlockSize;
+      } else if (digit_mask) {
+        char bytes[kBlockSize];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes), block);
+        for (uint32 mask = digit_mask; mask; mask &= mask - 1) {
+          data[written++] = bytes[CountTrailingZeros(mask)];
+        }
+      }
+      read += num_ascii_bytes;
+      if (num_ascii_bytes == kBlockSize) {
+        continue;
+      }
+    }
+#endif
+    const char c = data[read];
+    if (!(c & 0x80)) {
+      if (IsAsciiDigit(c)) {
+        data[written++] = c;
+      }
+      ++read;
+      continue;
+    }
+    Rune rune;
+    read += DecodeCharacter(data, length, read, &rune);
+    if (u_charType(rune) == U_DECIMAL_DIGIT_NUMBER) {
+      data[written++] = static_cast<char>('0' + u_charDigitValue(rune));
+    }
+  }
+  number->resize(written);
+}
+
+int GetDigitValue(char32 c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c < 0x80 || u_charType(c) != U_DECIMAL_DIGIT_NUMBER) {
+    return -1;
+  }
+  return u_charDigitValue(c);
+}
+
+size_t CountAsciiLetters(const string& s) {
+  const char* const data = s.data();
+  const size_t length = s.length();
+  size_t count = 0;
+  size_t i = 0;
+#if defined(I18N_PHONENUMBERS_USE_SSE2)
+  for (; i + kBlockSize <= length; i += kBlockSize) {
+    count += CountBits(AsciiLetterMask(LoadBlock(data + i)));
+  }
+#endif
+  for (; i < length; ++i) {
+    if (IsAsciiLetter(data[i])) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+bool IsAsciiString(const string& s) {
+  const char* const data = s.data();
+  const size_t length = s.length();
+  size_t i = 0;
+#if defined(I18N_PHONENUMBERS_USE_SSE2)
+  for (; i + kBlockSize <= length; i += kBlockSize) {
+    if (NonAsciiMask(LoadBlock(data + i))) {
+      return false;
+    }
+  }
+#endif
+  for (; i < length; ++i) {
+    if (data[i] & 0x80) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t GetLeadingPlusCharsLength(const string& s) {
+  const size_t full_width_plus_sign_length = sizeof(kFullWidthPlusSign) - 1;
+  size_t i = 0;
+  while (i < s.length()) {
+    if (s[i] == '+') {
+      ++i;
+    } else if (s.compare(i, full_width_plus_sign_length,
+                         kFullWidthPlusSign) == 0) {
+      i += full_width_plus_sign_length;
+    } else {
+      break;
+    }
+  }
+  return i;
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -0,0 +1,55 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Character class scans of UTF-8 phone numbers which don't rely on regular
+// expressions. The ASCII parts of the strings, which make up most of the
+// numbers, are processed 16 bytes at a time with SSE2 when it is available,
+// while the other characters are decoded one by one.
+
+#ifndef I18N_PHONENUMBERS_NORMALIZE_DIGITS_H_
+#define I18N_PHONENUMBERS_NORMALIZE_DIGITS_H_
+
+#include <cstddef>
+#include <string>
+
+#include "phonenumbers/base/basictypes.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+
+// Removes from number all the characters which are not decimal digits (i.e. of
+// Unicode general category Nd), and replaces the remaining ones, such as the
+// full-width and the Arabic-Indic digits, by their ASCII counterparts.
+void StripNonDigitsAndNormalize(string* number);
+
+// Returns the value of c if it is a decimal digit (i.e. of Unicode general
+// category Nd), or -1 otherwise.
+int GetDigitValue(char32 c);
+
+// Returns the number of ASCII letters in s.
+size_t CountAsciiLetters(const string& s);
+
+// Returns true if s only contains ASCII characters.
+bool IsAsciiString(const string& s);
+
+// Returns the length in bytes of the run of plus signs, ASCII or full-width,
+// which starts s.
+size_t GetLeadingPlusCharsLength(const string& s);
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_NORMALIZE_DIGITS_H_
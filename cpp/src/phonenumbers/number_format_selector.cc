@@ -0,0 +1,120 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/number_format_selector.h"
+
+#include <vector>
+
+#include "phonenumbers/base/logging.h"
+#include "phonenumbers/digit_automaton.h"
+#include "phonenumbers/phonemetadata.pb.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::vector;
+
+// The automata of a list of formats, the i-th format being tagged with the bit
+// (1 << i).
+class NumberFormatSelector::Automata {
+ public:
+  // Returns the automata of formats, or NULL if one of their patterns can't be
+  // compiled or if there are more formats than tags.
+  static Automata* Create(const RepeatedPtrField<NumberFormat>& formats) {
+    if (formats.size() > DigitAutomaton::kMaxTags) {
+      return NULL;
+    }
+    vector<string> leading_digits_patterns;
+    vector<string> patterns;
+    for (RepeatedPtrField<NumberFormat>::const_iterator it = formats.begin();
+         it != formats.end(); ++it) {
+      const int size = it->leading_digits_pattern_size();
+      // The last leading digits pattern is used, as it is the most detailed.
+      // The formats without any are selected whatever the number starts with,
+      // which is what the empty pattern does.
+      leading_digits_patterns.push_back(
+          size > 0 ? it->leading_digits_pattern(size - 1) : "");
+      patterns.push_back(it->pattern());
+    }
+    const DigitAutomaton* const leading_digits =
+        DigitAutomaton::Create(leading_digits_patterns);
+    const DigitAutomaton* const full_patterns =
+        DigitAutomaton::Create(patterns);
+    if (!leading_digits || !full_patterns) {
+      delete leading_digits;
+      delete full_patterns;
+      return NULL;
+    }
+    return new Automata(leading_digits, full_patterns);
+  }
+
+  // Returns the index of the first format selected for national_number, which
+  // only contains ASCII digits, or -1 if there is none.
+  int ChooseFormat(const string& national_number) const {
+    const uint32 tags = leading_digits_->PrefixMatchTags(national_number) &
+                        patterns_->FullMatchTags(national_number);
+    if (!tags) {
+      return -1;
+    }
+    int index = 0;
+    while (!(tags & (1U << index))) {
+      ++index;
+    }
+    return index;
+  }
+
+ private:
+  // Takes ownership of the automata.
+  Automata(const DigitAutomaton* leading_digits,
+           const DigitAutomaton* patterns)
+      : leading_digits_(leading_digits), patterns_(patterns) {}
+
+  const scoped_ptr<const DigitAutomaton> leading_digits_;
+  const scoped_ptr<const DigitAutomaton> patterns_;
+
+  DISALLOW_COPY_AND_ASSIGN(Automata);
+};
+
+NumberFormatSelector::NumberFormatSelector()
+    : cache_impl_(new CacheImpl(256)) {}
+
+NumberFormatSelector::~NumberFormatSelector() {}
+
+bool NumberFormatSelector::ChooseFormat(
+    const RepeatedPtrField<NumberFormat>& formats,
+    const string& national_number,
+    const NumberFormat** format) const {
+  DCHECK(format);
+  const Automata* const automata = GetAutomata(formats);
+  if (!automata || !IsAsciiDigitString(national_number)) {
+    return false;
+  }
+  const int index = automata->ChooseFormat(national_number);
+  *format = index < 0 ? NULL : &formats.Get(index);
+  return true;
+}
+
+const NumberFormatSelector::Automata* NumberFormatSelector::GetAutomata(
+    const RepeatedPtrField<NumberFormat>& formats) const {
+  const Automata* automata;
+  if (cache_impl_->Find(&formats, &automata)) {
+    return automata;
+  }
+  // The lists of formats whose automata can't be compiled are cached as well,
+  // so that the compilation is only attempted once.
+  return cache_impl_->Insert(&formats, Automata::Create(formats));
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
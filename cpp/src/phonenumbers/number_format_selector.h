@@ -0,0 +1,77 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef I18N_PHONENUMBERS_NUMBER_FORMAT_SELECTOR_H_
+#define I18N_PHONENUMBERS_NUMBER_FORMAT_SELECTOR_H_
+
+#include <string>
+
+#include <google/protobuf/repeated_field.h>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/base/memory/scoped_ptr.h"
+#include "phonenumbers/read_mostly_cache.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using google::protobuf::RepeatedPtrField;
+using std::string;
+
+class NumberFormat;
+
+// Chooses the format of a national number among the formats of a region
+// without running any regular expression. The last leading digits pattern of
+// every format is compiled into a single automaton, whose accepting states
+// carry the set of formats they select, and so is the pattern of every format.
+// The formats whose leading digits start the number, and the ones whose
+// pattern matches it, are then found in a single scan of the number each.
+//
+// Lists of formats whose patterns can't be compiled into automata, and numbers
+// containing characters other than ASCII digits, are left to the regular
+// expressions of the caller.
+class NumberFormatSelector {
+ public:
+  NumberFormatSelector();
+  ~NumberFormatSelector();
+
+  // Sets format to the first of formats whose last leading digits pattern, if
+  // it has any, matches a prefix of national_number, and whose pattern matches
+  // national_number in its entirety, or to NULL if there is none, and returns
+  // true. Returns false if the formats can't be compiled into automata or if
+  // national_number contains characters other than ASCII digits. The formats
+  // must outlive this instance, since the automata compiled for them are
+  // cached.
+  bool ChooseFormat(const RepeatedPtrField<NumberFormat>& formats,
+                    const string& national_number,
+                    const NumberFormat** format) const;
+
+ private:
+  class Automata;
+  typedef ReadMostlyCache<const RepeatedPtrField<NumberFormat>*, Automata>
+      CacheImpl;
+
+  // Returns the automata of formats, or NULL if they can't be compiled.
+  const Automata* GetAutomata(
+      const RepeatedPtrField<NumberFormat>& formats) const;
+
+  const scoped_ptr<CacheImpl> cache_impl_;
+
+  DISALLOW_COPY_AND_ASSIGN(NumberFormatSelector);
+};
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_NUMBER_FORMAT_SELECTOR_H_
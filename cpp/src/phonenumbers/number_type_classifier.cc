@@ -0,0 +1,126 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/number_type_classifier.h"
+
+#include <vector>
+
+#include "phonenumbers/base/logging.h"
+#include "phonenumbers/digit_automaton.h"
+#include "phonenumbers/matcher_api.h"
+#include "phonenumbers/phonemetadata.pb.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::vector;
+
+namespace {
+
+// In the automaton of a region, the national number pattern of the description
+// of type t is tagged with the bit (1 << 2t), and its possible number pattern
+// with the bit (1 << 2t + 1).
+uint32 NationalNumberTag(int desc_type) {
+  return 1U << (2 * desc_type);
+}
+
+uint32 PossibleNumberTag(int desc_type) {
+  return 1U << (2 * desc_type + 1);
+}
+
+}  // namespace
+
+NumberTypeClassifier::NumberTypeClassifier(const MatcherApi& fallback_matcher)
+    : fallback_matcher_(fallback_matcher),
+      cache_impl_(new CacheImpl(256)) {
+  DCHECK(2 * NUM_DESC_TYPES <= DigitAutomaton::kMaxTags);
+}
+
+NumberTypeClassifier::~NumberTypeClassifier() {}
+
+uint32 NumberTypeClassifier::GetMatchingDescs(
+    const string& national_number, const PhoneMetadata& metadata) const {
+  uint32 matching_descs = 0;
+  const DigitAutomaton* automaton = GetAutomaton(metadata);
+  if (automaton && IsAsciiDigitString(national_number)) {
+    const uint32 tags = automaton->FullMatchTags(national_number);
+    for (int desc_type = 0; desc_type < NUM_DESC_TYPES; ++desc_type) {
+      const uint32 desc_tags =
+          NationalNumberTag(desc_type) | PossibleNumberTag(desc_type);
+      if ((tags & desc_tags) == desc_tags) {
+        matching_descs |= 1U << desc_type;
+      }
+    }
+    return matching_descs;
+  }
+  for (int desc_type = 0; desc_type < NUM_DESC_TYPES; ++desc_type) {
+    const PhoneNumberDesc& desc =
+        GetDesc(metadata, static_cast<DescType>(desc_type));
+    if (fallback_matcher_.MatchesPossibleNumber(national_number, desc) &&
+        fallback_matcher_.MatchesNationalNumber(national_number, desc,
+                                                false)) {
+      matching_descs |= 1U << desc_type;
+    }
+  }
+  return matching_descs;
+}
+
+// static
+const PhoneNumberDesc& NumberTypeClassifier::GetDesc(
+    const PhoneMetadata& metadata, DescType desc_type) {
+  switch (desc_type) {
+    case PREMIUM_RATE:
+      return metadata.premium_rate();
+    case TOLL_FREE:
+      return metadata.toll_free();
+    case SHARED_COST:
+      return metadata.shared_cost();
+    case VOIP:
+      return metadata.voip();
+    case PERSONAL_NUMBER:
+      return metadata.personal_number();
+    case PAGER:
+      return metadata.pager();
+    case UAN:
+      return metadata.uan();
+    case VOICEMAIL:
+      return metadata.voicemail();
+    case FIXED_LINE:
+      return metadata.fixed_line();
+    case MOBILE:
+      return metadata.mobile();
+    default:
+      return metadata.general_desc();
+  }
+}
+
+const DigitAutomaton* NumberTypeClassifier::GetAutomaton(
+    const PhoneMetadata& metadata) const {
+  const DigitAutomaton* automaton;
+  if (cache_impl_->Find(&metadata, &automaton)) return automaton;
+
+  vector<string> patterns(2 * NUM_DESC_TYPES);
+  for (int desc_type = 0; desc_type < NUM_DESC_TYPES; ++desc_type) {
+    const PhoneNumberDesc& desc =
+        GetDesc(metadata, static_cast<DescType>(desc_type));
+    patterns[2 * desc_type] = desc.national_number_pattern();
+    patterns[2 * desc_type + 1] = desc.possible_number_pattern();
+  }
+  // Regions whose automaton can't be compiled are cached as well, so that the
+  // compilation is only attempted once.
+  return cache_impl_->Insert(&metadata, DigitAutomaton::Create(patterns));
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -0,0 +1,95 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef I18N_PHONENUMBERS_NUMBER_TYPE_CLASSIFIER_H_
+#define I18N_PHONENUMBERS_NUMBER_TYPE_CLASSIFIER_H_
+
+#include <string>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/base/memory/scoped_ptr.h"
+#include "phonenumbers/read_mostly_cache.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+
+class DigitAutomaton;
+class MatcherApi;
+class PhoneMetadata;
+class PhoneNumberDesc;
+
+// Matches a national number against all the PhoneNumberDesc messages of the
+// metadata of a region at once. The national and possible number patterns of
+// every description are compiled into a single automaton per region, whose
+// accepting states carry the set of patterns they match, so that the number is
+// scanned only once whatever the number of descriptions.
+//
+// Regions whose patterns can't be compiled into an automaton, and numbers
+// containing characters other than ASCII digits, are matched description by
+// description with the fallback matcher.
+class NumberTypeClassifier {
+ public:
+  // The descriptions of a region, in the order they are tested by
+  // PhoneNumberUtil when determining the type of a number.
+  enum DescType {
+    GENERAL_DESC,
+    PREMIUM_RATE,
+    TOLL_FREE,
+    SHARED_COST,
+    VOIP,
+    PERSONAL_NUMBER,
+    PAGER,
+    UAN,
+    VOICEMAIL,
+    FIXED_LINE,
+    MOBILE,
+    NUM_DESC_TYPES
+  };
+
+  // The fallback matcher must outlive this instance.
+  explicit NumberTypeClassifier(const MatcherApi& fallback_matcher);
+  ~NumberTypeClassifier();
+
+  // Returns the set of descriptions of the metadata matched by the national
+  // number, as a bitmask with the bit (1 << desc_type) set for every matching
+  // description. A description is matched if both its possible number pattern
+  // and its national number pattern match the whole number. The metadata must
+  // outlive this instance, since the automaton compiled for it is cached.
+  uint32 GetMatchingDescs(const string& national_number,
+                          const PhoneMetadata& metadata) const;
+
+  // Returns the description of the metadata corresponding to desc_type.
+  static const PhoneNumberDesc& GetDesc(const PhoneMetadata& metadata,
+                                        DescType desc_type);
+
+ private:
+  typedef ReadMostlyCache<const PhoneMetadata*, DigitAutomaton> CacheImpl;
+
+  // Returns the automaton of the metadata, or NULL if its patterns can't be
+  // compiled into an automaton.
+  const DigitAutomaton* GetAutomaton(const PhoneMetadata& metadata) const;
+
+  const MatcherApi& fallback_matcher_;
+
+  const scoped_ptr<CacheImpl> cache_impl_;
+
+  DISALLOW_COPY_AND_ASSIGN(NumberTypeClassifier);
+};
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_NUMBER_TYPE_CLASSIFIER_H_
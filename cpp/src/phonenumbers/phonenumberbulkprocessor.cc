@@ -0,0 +1,204 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/phonenumberbulkprocessor.h"
+
+#include <algorithm>
+
+#include "phonenumbers/base/logging.h"
+#include "phonenumbers/base/synchronization/lock.h"
+#include "phonenumbers/base/threading/simple_thread.h"
+#include "phonenumbers/stl_util.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::max;
+using std::min;
+
+namespace {
+
+// The number of numbers a thread takes from its queue at once. It is large
+// enough for the locking of the queue to be negligible, and small enough for
+// the threads to finish at about the same time.
+const size_t kChunkSize = 64;
+
+// The range of the indices of the numbers which remain to be processed by a
+// thread. The owner of the queue takes them by chunks from the front, while
+// the other threads steal them from the back.
+class WorkQueue {
+ public:
+  WorkQueue(size_t begin, size_t end) : lock_(), begin_(begin), end_(end) {}
+
+  // Takes the next chunk of numbers, and returns false if there are none left.
+  bool TakeChunk(size_t* begin, size_t* end) {
+    AutoLock l(lock_);
+    if (begin_ == end_) {
+      return false;
+    }
+    *begin = begin_;
+    begin_ = min(end_, begin_ + kChunkSize);
+    *end = begin_;
+    return true;
+  }
+
+  // Takes the second half of the remaining numbers, and returns false if
+  // there are none left.
+  bool StealHalf(size_t* begin, size_t* end) {
+    AutoLock l(lock_);
+    if (begin_ == end_) {
+      return false;
+    }
+    *end = end_;
+    end_ -= (end_ - begin_ + 1) / 2;
+    *begin = end_;
+    return true;
+  }
+
+  void Reset(size_t begin, size_t end) {
+    AutoLock l(lock_);
+    DCHECK_EQ(begin_, end_);
+    begin_ = begin;
+    end_ = end;
+  }
+
+ private:
+  Lock lock_;
+  size_t begin_;
+  size_t end_;
+
+  DISALLOW_COPY_AND_ASSIGN(WorkQueue);
+};
+
+void ProcessNumber(const PhoneNumberUtil& phone_util,
+                   const string& number_to_parse,
+                   const string& default_region,
+                   BulkProcessingResult* result) {
+  result->error =
+      phone_util.Parse(number_to_parse, default_region, &result->number);
+  if (result->error != PhoneNumberUtil::NO_PARSING_ERROR) {
+    result->number.Clear();
+    result->is_valid = false;
+    result->type = PhoneNumberUtil::UNKNOWN;
+    result->e164_number.clear();
+    return;
+  }
+  // The region of the number is derived from its country calling code, so the
+  // number is valid if and only if its type is known, see IsValidNumber().
+  result->type = phone_util.GetNumberType(result->number);
+  result->is_valid = result->type != PhoneNumberUtil::UNKNOWN;
+  phone_util.Format(result->number, PhoneNumberUtil::E164,
+                    &result->e164_number);
+}
+
+class Worker : public SimpleThread::Delegate {
+ public:
+  Worker(const vector<string>& numbers_to_parse,
+         const string& default_region,
+         const vector<WorkQueue*>& queues,
+         size_t index,
+         vector<BulkProcessingResult>* results)
+      : phone_util_(*PhoneNumberUtil::GetInstance()),
+        numbers_to_parse_(numbers_to_parse),
+        default_region_(default_region),
+        queues_(queues),
+        index_(index),
+        results_(results) {}
+
+  virtual void Run() {
+    WorkQueue* const queue = queues_[index_];
+    size_t begin = 0;
+    size_t end = 0;
+    do {
+      while (queue->TakeChunk(&begin, &end)) {
+        for (size_t i = begin; i < end; ++i) {
+          ProcessNumber(phone_util_, numbers_to_parse_[i], default_region_,
+                        &(*results_)[i]);
+        }
+      }
+    } while (StealWork());
+  }
+
+ private:
+  // Moves half of the work left to another thread to the queue of this one,
+  // and returns false if there is no work left.
+  bool StealWork() {
+    size_t begin = 0;
+    size_t end = 0;
+    for (size_t i = 1; i < queues_.size(); ++i) {
+      if (queues_[(index_ + i) % queues_.size()]->StealHalf(&begin, &end)) {
+        queues_[index_]->Reset(begin, end);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  const PhoneNumberUtil& phone_util_;
+  const vector<string>& numbers_to_parse_;
+  const string& default_region_;
+  const vector<WorkQueue*>& queues_;
+  const size_t index_;
+  vector<BulkProcessingResult>* const results_;
+
+  DISALLOW_COPY_AND_ASSIGN(Worker);
+};
+
+}  // namespace
+
+PhoneNumberBulkProcessor::PhoneNumberBulkProcessor(int num_threads)
+    : num_threads_(num_threads) {
+  DCHECK_GE(num_threads, 1);
+}
+
+void PhoneNumberBulkProcessor::Process(
+    const vector<string>& numbers_to_parse,
+    const string& default_region,
+    vector<BulkProcessingResult>* results) const {
+  DCHECK(results);
+  const size_t num_numbers = numbers_to_parse.size();
+  // The existing results are overwritten rather than cleared, so that the
+  // memory of their strings is reused.
+  results->resize(num_numbers);
+  // There is no point in having threads without a chunk of their own.
+  const size_t num_chunks = (num_numbers + kChunkSize - 1) / kChunkSize;
+  const size_t num_workers =
+      max<size_t>(1, min<size_t>(num_threads_, num_chunks));
+
+  vector<WorkQueue*> queues;
+  vector<Worker*> workers;
+  for (size_t i = 0; i < num_workers; ++i) {
+    queues.push_back(new WorkQueue(num_numbers * i / num_workers,
+                                   num_numbers * (i + 1) / num_workers));
+    workers.push_back(new Worker(numbers_to_parse, default_region, queues, i,
+                                 results));
+  }
+  // The calling thread runs the first worker.
+  vector<SimpleThread*> threads;
+  for (size_t i = 1; i < num_workers; ++i) {
+    threads.push_back(new SimpleThread(workers[i]));
+    threads.back()->Start();
+  }
+  workers[0]->Run();
+  for (vector<SimpleThread*>::const_iterator it = threads.begin();
+       it != threads.end(); ++it) {
+    (*it)->Join();
+  }
+  STLDeleteElements(&threads);
+  STLDeleteElements(&workers);
+  STLDeleteElements(&queues);
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -0,0 +1,88 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Processes large sets of phone numbers on several threads: each number is
+// parsed, validated, classified and formatted in E164, and the results are
+// returned in the order of the input.
+//
+// The input is split evenly between the threads, which process their share by
+// chunks and steal half of the remaining share of another thread once they
+// are done with theirs, so that the threads stay busy until the end even when
+// some numbers are much more expensive to parse than others.
+
+#ifndef I18N_PHONENUMBERS_PHONENUMBERBULKPROCESSOR_H_
+#define I18N_PHONENUMBERS_PHONENUMBERBULKPROCESSOR_H_
+
+#include <string>
+#include <vector>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/phonenumber.pb.h"
+#include "phonenumbers/phonenumberutil.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+using std::vector;
+
+// The result of the processing of a single number.
+struct BulkProcessingResult {
+  BulkProcessingResult()
+      : error(PhoneNumberUtil::NO_PARSING_ERROR),
+        number(),
+        is_valid(false),
+        type(PhoneNumberUtil::UNKNOWN),
+        e164_number() {}
+
+  // The error returned by PhoneNumberUtil::Parse(). The other fields are only
+  // set when it is NO_PARSING_ERROR.
+  PhoneNumberUtil::ErrorType error;
+  PhoneNumber number;
+  // The results of PhoneNumberUtil::IsValidNumber() and
+  // PhoneNumberUtil::GetNumberType().
+  bool is_valid;
+  PhoneNumberUtil::PhoneNumberType type;
+  // The number formatted in PhoneNumberUtil::E164.
+  string e164_number;
+};
+
+class PhoneNumberBulkProcessor {
+ public:
+  // Creates a processor running on num_threads threads, including the thread
+  // calling Process(). num_threads must be positive.
+  explicit PhoneNumberBulkProcessor(int num_threads);
+
+  // Processes numbers_to_parse, parsed with default_region as in
+  // PhoneNumberUtil::Parse(). results is resized to the size of the input and
+  // its i-th element is set to the result of the i-th number. This method is
+  // thread-safe.
+  void Process(const vector<string>& numbers_to_parse,
+               const string& default_region,
+               vector<BulkProcessingResult>* results) const;
+
+  int num_threads() const {
+    return num_threads_;
+  }
+
+ private:
+  const int num_threads_;
+
+  DISALLOW_COPY_AND_ASSIGN(PhoneNumberBulkProcessor);
+};
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_PHONENUMBERBULKPROCESSOR_H_
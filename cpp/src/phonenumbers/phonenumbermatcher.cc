@@ -27,20 +27,25 @@
 
 #include <ctype.h>
 #include <stddef.h>
+#include <algorithm>
 #include <limits>
 #include <map>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <unicode/regex.h>
 #include <unicode/uchar.h>
+#include <unicode/unistr.h>
 
 #include "phonenumbers/alternate_format.h"
 #include "phonenumbers/base/logging.h"
 #include "phonenumbers/base/memory/scoped_ptr.h"
 #include "phonenumbers/base/memory/singleton.h"
 #include "phonenumbers/callback.h"
+#include "phonenumbers/decoded_text.h"
 #include "phonenumbers/default_logger.h"
+#include "phonenumbers/digit_block_splitter.h"
 #include "phonenumbers/encoding_utils.h"
 #include "phonenumbers/normalize_utf8.h"
 #include "phonenumbers/phonemetadata.pb.h"
@@ -55,7 +60,11 @@
 #include "phonenumbers/regexp_adapter_re2.h"
 #endif  // I18N_PHONENUMBERS_USE_RE2_AND_ICU
 
+using icu::RegexMatcher;
+using icu::RegexPattern;
+using icu::UnicodeString;
 using std::make_pair;
+using std::max;
 using std::map;
 using std::numeric_limits;
 using std::string;
@@ -65,6 +74,24 @@ namespace i18n {
 namespace phonenumbers {
 
 namespace {
+// The number of bytes a candidate must end before the end of a partial text for
+// the rest of the text not to change it. The pattern can match as soon as it
+// reaches the first digit, so a search attempt which read the end of the text
+// without matching started at most the length of the leading punctuation
+// before it. The checks of a candidate also look at the character after it.
+const int kMaxLookaheadLength = 64;
+
+// The maximum numbers of opening punctuation characters, and of punctuation
+// characters following each of them, before the first digit of a candidate.
+const int kLeadLimit = 2;
+const int kPunctuationLimit = 4;
+
+// The maximum number of UTF-16 code units of a candidate before its first
+// digit, since the leading punctuation characters are all in the BMP.
+const int kMaxLeadLength = kLeadLimit * (1 + kPunctuationLimit);
+
+const char kAsciiDigits[] = "0123456789";
+
 // Returns a regular expression quantifier with an upper and lower limit.
 string Limit(int lower, int upper) {
   DCHECK_GE(lower, 0);
@@ -118,7 +145,7 @@ bool AllNumberGroupsRemainGrouped(
     const PhoneNumberUtil& util,
     const PhoneNumber& number,
     const string& normalized_candidate,
-    const vector<string>& formatted_number_groups) {
+    const vector<StringPiece>& formatted_number_groups) {
   size_t from_index = 0;
   if (number.country_code_source() != PhoneNumber::FROM_DEFAULT_COUNTRY) {
     // First skip the country code if the normalized candidate contained it.
@@ -130,13 +157,14 @@ bool AllNumberGroupsRemainGrouped(
   for (size_t i = 0; i < formatted_number_groups.size(); ++i) {
     // Fails if the substring of normalized_candidate starting from from_index
     // doesn't contain the consecutive digits in formatted_number_groups.at(i).
-    from_index = normalized_candidate.find(formatted_number_groups.at(i),
-                                           from_index);
+    const StringPiece& group = formatted_number_groups.at(i);
+    from_index = normalized_candidate.find(group.data(), from_index,
+                                           group.length());
     if (from_index == string::npos) {
       return false;
     }
     // Moves from_index forward.
-    from_index += formatted_number_groups.at(i).length();
+    from_index += group.length();
     if (i == 0 && from_index < normalized_candidate.length()) {
       // We are at the position right after the NDC. We get the region used for
       // formatting information based on the country code in the phone number,
@@ -158,7 +186,7 @@ bool AllNumberGroupsRemainGrouped(
         string national_significant_number;
         util.GetNationalSignificantNumber(number, &national_significant_number);
         return HasPrefixString(normalized_candidate.substr(
-            from_index - formatted_number_groups.at(i).length()),
+            from_index - group.length()),
             national_significant_number);
         }
       }
@@ -226,10 +254,11 @@ class PhoneNumberMatcherRegExps : public Singleton<PhoneNumberMatcherRegExps> {
   string optional_extn_pattern_;
 
  public:
-  // We use two different reg-ex factories here for performance reasons. RE2 is
-  // much faster for smaller reg-ex patterns, but the main pattern cannot be
-  // handled by RE2 in an efficient way.
-  scoped_ptr<const AbstractRegExpFactory> regexp_factory_for_pattern_;
+  // RE2 is much faster than ICU for smaller reg-ex patterns, but the main
+  // pattern cannot be handled by RE2 in an efficient way. The main pattern is
+  // therefore always run by ICU, which is used directly rather than through
+  // the RegExp adapter so that the text can be decoded once for all the
+  // searches, see CandidateScanner.
   scoped_ptr<const AbstractRegExpFactory> regexp_factory_;
 
   // Matches strings that look like publication pages. Example:
@@ -261,11 +290,13 @@ class PhoneNumberMatcherRegExps : public Singleton<PhoneNumberMatcherRegExps> {
   // the first match as well.
   scoped_ptr<vector<const RegExp*> > inner_matches_;
   scoped_ptr<const RegExp> capture_up_to_second_number_start_pattern_;
-  scoped_ptr<const RegExp> capturing_ascii_digits_pattern_;
   // Compiled reg-ex representing lead_class_;
   scoped_ptr<const RegExp> lead_class_pattern_;
   // Phone number pattern allowing optional punctuation.
-  scoped_ptr<const RegExp> pattern_;
+  scoped_ptr<const RegexPattern> pattern_;
+  // Splits the national numbers into the groups of digits the grouping checks
+  // compare with the candidates.
+  scoped_ptr<const DigitBlockSplitter> digit_block_splitter_;
 
   PhoneNumberMatcherRegExps()
       : opening_parens_("(\\[\xEF\xBC\x88\xEF\xBC\xBB" /* "(\\[（［" */),
@@ -278,8 +309,8 @@ class PhoneNumberMatcherRegExps : public Singleton<PhoneNumberMatcherRegExps> {
         bracket_pairs_(StrCat(
             "(?:[", opening_parens_, "]", non_parens_, "+",
             "[", closing_parens_, "])", bracket_pair_limit_)),
-        lead_limit_(Limit(0, 2)),
-        punctuation_limit_(Limit(0, 4)),
+        lead_limit_(Limit(0, kLeadLimit)),
+        punctuation_limit_(Limit(0, kPunctuationLimit)),
         digit_block_limit_(PhoneNumberUtil::kMaxLengthForNsn +
                            PhoneNumberUtil::kMaxLengthCountryCode),
         block_limit_(Limit(0, digit_block_limit_)),
@@ -293,7 +324,6 @@ class PhoneNumberMatcherRegExps : public Singleton<PhoneNumberMatcherRegExps> {
             "(?i)(?:",
             PhoneNumberUtil::GetInstance()->GetExtnPatternsForMatching(),
             ")?")),
-        regexp_factory_for_pattern_(new ICURegExpFactory()),
 #ifdef I18N_PHONENUMBERS_USE_RE2
         regexp_factory_(new RE2RegExpFactory()),
 #else
@@ -314,13 +344,12 @@ class PhoneNumberMatcherRegExps : public Singleton<PhoneNumberMatcherRegExps> {
         capture_up_to_second_number_start_pattern_(
             regexp_factory_->CreateRegExp(
                 PhoneNumberUtil::kCaptureUpToSecondNumberStart)),
-        capturing_ascii_digits_pattern_(
-            regexp_factory_->CreateRegExp("(\\d+)")),
         lead_class_pattern_(regexp_factory_->CreateRegExp(lead_class_)),
-        pattern_(regexp_factory_for_pattern_->CreateRegExp(
+        pattern_(CompilePattern(
             StrCat("(", opening_punctuation_, lead_limit_,
                    digit_sequence_, "(?:", punctuation_, digit_sequence_, ")",
-                   block_limit_, optional_extn_pattern_, ")"))) {
+                   block_limit_, optional_extn_pattern_, ")"))),
+        digit_block_splitter_(new DigitBlockSplitter()) {
     inner_matches_->push_back(
         // Breaks on the slash - e.g. "651-234-2345/332-445-1234"
         regexp_factory_->CreateRegExp("/+(.*)"));
@@ -351,9 +380,109 @@ class PhoneNumberMatcherRegExps : public Singleton<PhoneNumberMatcherRegExps> {
   }
 
  private:
+  static const RegexPattern* CompilePattern(const string& pattern) {
+    UParseError parse_error;
+    UErrorCode status = U_ZERO_ERROR;
+    RegexPattern* const compiled_pattern = RegexPattern::compile(
+        UnicodeString::fromUTF8(pattern), 0, parse_error, status);
+    if (U_FAILURE(status)) {
+      // The pattern should compile correctly.
+      LOG(ERROR) << "Error compiling regular expression: " << pattern;
+      delete compiled_pattern;
+      return NULL;
+    }
+    return compiled_pattern;
+  }
+
   DISALLOW_COPY_AND_ASSIGN(PhoneNumberMatcherRegExps);
 };
 
+// Finds the candidates matching the phone number pattern in a text, which is
+// decoded to UTF-16 once for all the searches. The candidates are searched
+// with a single ICU matcher, from a position which is only converted between
+// the UTF-8 and UTF-16 offsets of the text around the candidates, so that
+// scanning the whole text takes linear time.
+//
+// Every candidate contains a digit, and the pattern can't match more than
+// kMaxLeadLength code units before it, so the searches start there, and the
+// regular expression doesn't run over the text without digits, such as prose.
+// This skipping can be turned off with skip_text_without_digits, to compare
+// the matches and the time with and without it.
+class CandidateScanner {
+ public:
+  CandidateScanner(const RegexPattern* pattern,
+                   const string& text,
+                   bool skip_text_without_digits)
+      : decoded_text_(text),
+        matcher_(NULL),
+        skip_text_without_digits_(skip_text_without_digits),
+        position_(0),
+        found_no_digit_(false) {
+    if (!pattern) {
+      return;
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    matcher_.reset(pattern->matcher(decoded_text_.utf16_text(), status));
+    if (U_FAILURE(status)) {
+      matcher_.reset(NULL);
+    }
+  }
+
+  // Moves the search to the UTF-8 offset of a character of the text.
+  void Seek(int offset) {
+    position_ = decoded_text_.ToUtf16Index(offset);
+  }
+
+  // Returns true if the last search read the end of the text, in which case
+  // more text could have changed its result.
+  bool HitEnd() const {
+    return !matcher_.get() || found_no_digit_ || matcher_->hitEnd();
+  }
+
+  // Finds the next candidate, sets its UTF-8 start and end offsets, and moves
+  // the search to the end of the candidate. Returns false if there is none.
+  bool FindNext(int* start, int* end) {
+    DCHECK(start);
+    DCHECK(end);
+    if (!matcher_.get()) {
+      return false;
+    }
+    int search_start = position_;
+    if (skip_text_without_digits_) {
+      const int digit_index = decoded_text_.FindDigit(position_);
+      // The end of the text could also be the lead of a candidate.
+      found_no_digit_ = digit_index == decoded_text_.utf16_text().length();
+      if (found_no_digit_) {
+        return false;
+      }
+      search_start = max(position_, digit_index - kMaxLeadLength);
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    if (!matcher_->find(search_start, status) || U_FAILURE(status)) {
+      return false;
+    }
+    const int utf16_start = matcher_->start(status);
+    position_ = matcher_->end(status);
+    if (U_FAILURE(status)) {
+      return false;
+    }
+    *start = decoded_text_.ToUtf8Offset(utf16_start);
+    *end = decoded_text_.ToUtf8Offset(position_);
+    return true;
+  }
+
+ private:
+  DecodedText decoded_text_;
+  scoped_ptr<RegexMatcher> matcher_;
+  const bool skip_text_without_digits_;
+  // The UTF-16 index the next search starts at.
+  int position_;
+  // Whether the last search found no digit after its start.
+  bool found_no_digit_;
+
+  DISALLOW_COPY_AND_ASSIGN(CandidateScanner);
+};
+
 class AlternateFormats : public Singleton<AlternateFormats> {
  public:
   PhoneMetadataCollection format_data_;
@@ -404,7 +533,12 @@ PhoneNumberMatcher::PhoneNumberMatcher(const PhoneNumberUtil& util,
       max_tries_(max_tries),
       state_(NOT_READY),
       last_match_(NULL),
-      search_index_(0) {
+      search_index_(0),
+      scanner_(NULL),
+      skip_text_without_digits_(true),
+      is_partial_text_(false),
+      pending_index_(0),
+      search_indices_(NULL) {
 }
 
 PhoneNumberMatcher::PhoneNumberMatcher(const string& text,
@@ -418,7 +552,36 @@ PhoneNumberMatcher::PhoneNumberMatcher(const string& text,
       max_tries_(numeric_limits<int>::max()),
       state_(NOT_READY),
       last_match_(NULL),
-      search_index_(0) {
+      search_index_(0),
+      scanner_(NULL),
+      skip_text_without_digits_(true),
+      is_partial_text_(false),
+      pending_index_(0),
+      search_indices_(NULL) {
+}
+
+PhoneNumberMatcher::PhoneNumberMatcher(const PhoneNumberUtil& util,
+                                       const string& text,
+                                       const string& region_code,
+                                       PhoneNumberMatcher::Leniency leniency,
+                                       int max_tries,
+                                       int search_index,
+                                       bool is_partial_text)
+    : reg_exps_(PhoneNumberMatcherRegExps::GetInstance()),
+      alternate_formats_(AlternateFormats::GetInstance()),
+      phone_util_(util),
+      text_(text),
+      preferred_region_(region_code),
+      leniency_(leniency),
+      max_tries_(max_tries),
+      state_(NOT_READY),
+      last_match_(NULL),
+      search_index_(search_index),
+      scanner_(NULL),
+      skip_text_without_digits_(true),
+      is_partial_text_(is_partial_text),
+      pending_index_(search_index),
+      search_indices_(NULL) {
 }
 
 PhoneNumberMatcher::~PhoneNumberMatcher() {
@@ -557,12 +720,10 @@ bool PhoneNumberMatcher::VerifyAccordingToLeniency(
           !IsNationalPrefixPresentIfRequired(number)) {
         return false;
       }
-      ResultCallback4<bool, const PhoneNumberUtil&, const PhoneNumber&,
-                      const string&, const vector<string>&>* callback =
-          NewPermanentCallback(&AllNumberGroupsRemainGrouped);
-      bool is_valid = CheckNumberGroupingIsValid(number, candidate, callback);
-      delete(callback);
-      return is_valid;
+      FunctionCallback4<bool, const PhoneNumberUtil&, const PhoneNumber&,
+                        const string&, const vector<StringPiece>&>
+          checker(&AllNumberGroupsRemainGrouped);
+      return CheckNumberGroupingIsValid(number, candidate, &checker);
     }
     case PhoneNumberMatcher::EXACT_GROUPING: {
       if (!phone_util_.IsValidNumber(number) ||
@@ -572,13 +733,11 @@ bool PhoneNumberMatcher::VerifyAccordingToLeniency(
           !IsNationalPrefixPresentIfRequired(number)) {
         return false;
       }
-      ResultCallback4<bool, const PhoneNumberUtil&, const PhoneNumber&,
-                      const string&, const vector<string>&>* callback =
-          NewPermanentCallback(
-              this, &PhoneNumberMatcher::AllNumberGroupsAreExactlyPresent);
-      bool is_valid = CheckNumberGroupingIsValid(number, candidate, callback);
-      delete(callback);
-      return is_valid;
+      ConstMethodCallback4<PhoneNumberMatcher, bool, const PhoneNumberUtil&,
+                           const PhoneNumber&, const string&,
+                           const vector<StringPiece>&>
+          checker(this, &PhoneNumberMatcher::AllNumberGroupsAreExactlyPresent);
+      return CheckNumberGroupingIsValid(number, candidate, &checker);
     }
     default:
       LOG(ERROR) << "No implementation defined for verification for leniency "
@@ -633,9 +792,11 @@ bool PhoneNumberMatcher::ExtractMatch(const string& candidate, int offset,
 
   // Skip potential time-stamps.
   if (reg_exps_->time_stamps_->PartialMatch(candidate)) {
+    // The suffix of a time-stamp is 3 ASCII characters long, so there is no
+    // need to look any further.
     scoped_ptr<RegExpInput> following_text(
         reg_exps_->regexp_factory_->CreateInput(
-            text_.substr(offset + candidate.size())));
+            text_.substr(offset + candidate.size(), 3)));
     if (reg_exps_->time_stamps_suffix_->Consume(following_text.get())) {
       return false;
     }
@@ -682,12 +843,31 @@ bool PhoneNumberMatcher::Next(PhoneNumberMatch* match) {
 bool PhoneNumberMatcher::Find(int index, PhoneNumberMatch* match) {
   DCHECK(match);
 
-  scoped_ptr<RegExpInput> text(
-      reg_exps_->regexp_factory_for_pattern_->CreateInput(text_.substr(index)));
+  if (!scanner_.get()) {
+    scanner_.reset(new CandidateScanner(reg_exps_->pattern_.get(), text_,
+                                        skip_text_without_digits_));
+  }
+  scanner_->Seek(index);
+  int start = 0;
+  int end = 0;
   string candidate;
-  while ((max_tries_ > 0) &&
-         reg_exps_->pattern_->FindAndConsume(text.get(), &candidate)) {
-    int start = text_.length() - text->ToString().length() - candidate.length();
+  while (max_tries_ > 0) {
+    if (search_indices_) {
+      search_indices_->push_back(index);
+    }
+    const bool found = scanner_->FindNext(&start, &end);
+    if (is_partial_text_ &&
+        (scanner_->HitEnd() || !found ||
+         end + kMaxLookaheadLength > static_cast<int>(text_.length()))) {
+      // The rest of the text could extend the candidate or let another one
+      // start before it.
+      pending_index_ = index;
+      return false;
+    }
+    if (!found) {
+      return false;
+    }
+    candidate.assign(text_, start, end - start);
     // Check for extra numbers at the end.
     reg_exps_->capture_up_to_second_number_start_pattern_->
         PartialMatch(candidate, &candidate);
@@ -695,7 +875,7 @@ bool PhoneNumberMatcher::Find(int index, PhoneNumberMatch* match) {
       return true;
     }
 
-    index = start + candidate.length();
+    index = end;
     --max_tries_;
   }
   return false;
@@ -705,15 +885,22 @@ bool PhoneNumberMatcher::CheckNumberGroupingIsValid(
     const PhoneNumber& phone_number,
     const string& candidate,
     ResultCallback4<bool, const PhoneNumberUtil&, const PhoneNumber&,
-                    const string&, const vector<string>&>* checker) const {
+                    const string&, const vector<StringPiece>&>* checker) const {
   DCHECK(checker);
   // TODO: Evaluate how this works for other locales (testing has been limited
   // to NANPA regions) and optimise if necessary.
   string normalized_candidate =
       NormalizeUTF8::NormalizeDecimalDigits(candidate);
-  vector<string> formatted_number_groups;
-  GetNationalNumberGroups(phone_number, NULL,  // Use default formatting pattern
-                          &formatted_number_groups);
+  string national_significant_number;
+  phone_util_.GetNationalSignificantNumber(phone_number,
+                                           &national_significant_number);
+  // The groups point to national_significant_number, or to formatted_number
+  // for the formats whose layout is not known.
+  string formatted_number;
+  vector<StringPiece> formatted_number_groups;
+  GetNationalNumberGroups(phone_number, national_significant_number,
+                          NULL,  // Use default formatting pattern
+                          &formatted_number, &formatted_number_groups);
   if (checker->Run(phone_util_, phone_number, normalized_candidate,
                    formatted_number_groups)) {
     return true;
@@ -728,7 +915,8 @@ bool PhoneNumberMatcher::CheckNumberGroupingIsValid(
              alternate_formats->number_format().begin();
          it != alternate_formats->number_format().end(); ++it) {
       formatted_number_groups.clear();
-      GetNationalNumberGroups(phone_number, &*it, &formatted_number_groups);
+      GetNationalNumberGroups(phone_number, national_significant_number, &*it,
+                              &formatted_number, &formatted_number_groups);
       if (checker->Run(phone_util_, phone_number, normalized_candidate,
                        formatted_number_groups)) {
         return true;
@@ -743,34 +931,60 @@ bool PhoneNumberMatcher::CheckNumberGroupingIsValid(
 // formatted together.
 void PhoneNumberMatcher::GetNationalNumberGroups(
     const PhoneNumber& number,
+    const string& national_significant_number,
     const NumberFormat* formatting_pattern,
-    vector<string>* digit_blocks) const {
-  string rfc3966_format;
+    string* formatted_number,
+    vector<StringPiece>* digit_blocks) const {
   if (!formatting_pattern) {
-    // This will be in the format +CC-DG;ext=EXT where DG represents groups of
-    // digits.
-    phone_util_.Format(number, PhoneNumberUtil::RFC3966, &rfc3966_format);
-    // We remove the extension part from the formatted string before splitting
-    // it into different groups.
-    size_t end_index = rfc3966_format.find(';');
-    if (end_index == string::npos) {
-      end_index = rfc3966_format.length();
-    }
-    // The country-code will have a '-' following it.
-    size_t start_index = rfc3966_format.find('-') + 1;
-    SplitStringUsing(rfc3966_format.substr(start_index,
-                                           end_index - start_index),
-                     "-", digit_blocks);
-  } else {
-    // We format the NSN only, and split that according to the separator.
-    string national_significant_number;
-    phone_util_.GetNationalSignificantNumber(number,
-                                             &national_significant_number);
-    phone_util_.FormatNsnUsingPattern(national_significant_number,
-                                      *formatting_pattern,
-                                      PhoneNumberUtil::RFC3966,
-                                      &rfc3966_format);
-    SplitStringUsing(rfc3966_format, "-", digit_blocks);
+    // This is the pattern the national number is formatted with in the
+    // RFC3966 format of the number, i.e. +CC-DG;ext=EXT where DG represents
+    // groups of digits. It is chosen among the international formats of the
+    // region of the country calling code when it has some.
+    const int country_calling_code = number.country_code();
+    string region_code;
+    phone_util_.GetRegionCodeForCountryCode(country_calling_code,
+                                            &region_code);
+    const PhoneMetadata* metadata =
+        phone_util_.GetMetadataForRegionOrCallingCode(country_calling_code,
+                                                      region_code);
+    if (metadata) {
+      formatting_pattern = phone_util_.ChooseFormattingPatternForNumber(
+          metadata->intl_number_format_size() == 0
+              ? metadata->number_format()
+              : metadata->intl_number_format(),
+          national_significant_number);
+    }
+    if (!formatting_pattern) {
+      // The national number is not formatted at all.
+      if (!national_significant_number.empty()) {
+        digit_blocks->push_back(StringPiece(national_significant_number));
+      }
+      return;
+    }
+  }
+  if (reg_exps_->digit_block_splitter_->Split(national_significant_number,
+                                              *formatting_pattern,
+                                              digit_blocks)) {
+    return;
+  }
+  // We format the NSN only, and split that according to the separator.
+  formatted_number->clear();
+  phone_util_.FormatNsnUsingPattern(national_significant_number,
+                                    *formatting_pattern,
+                                    PhoneNumberUtil::RFC3966,
+                                    formatted_number);
+  size_t block_start = 0;
+  while (block_start < formatted_number->length()) {
+    size_t block_end = formatted_number->find('-', block_start);
+    if (block_end == string::npos) {
+      block_end = formatted_number->length();
+    }
+    if (block_end > block_start) {
+      digit_blocks->push_back(StringPiece(formatted_number->data() +
+                                              block_start,
+                                          block_end - block_start));
+    }
+    block_start = block_end + 1;
   }
 }
 
@@ -825,15 +1039,21 @@ bool PhoneNumberMatcher::AllNumberGroupsAreExactlyPresent(
     const PhoneNumberUtil& util,
     const PhoneNumber& phone_number,
     const string& normalized_candidate,
-    const vector<string>& formatted_number_groups) const {
-  const scoped_ptr<RegExpInput> candidate_number(
-      reg_exps_->regexp_factory_->CreateInput(normalized_candidate));
-  vector<string> candidate_groups;
-  string digit_block;
-  while (reg_exps_->capturing_ascii_digits_pattern_->FindAndConsume(
-             candidate_number.get(),
-             &digit_block)) {
-    candidate_groups.push_back(digit_block);
+    const vector<StringPiece>& formatted_number_groups) const {
+  // The groups of consecutive digits of the candidate, which are all ASCII
+  // digits once normalized.
+  vector<StringPiece> candidate_groups;
+  size_t group_start = 0;
+  while ((group_start = normalized_candidate.find_first_of(
+              kAsciiDigits, group_start)) != string::npos) {
+    size_t group_end =
+        normalized_candidate.find_first_not_of(kAsciiDigits, group_start);
+    if (group_end == string::npos) {
+      group_end = normalized_candidate.length();
+    }
+    candidate_groups.push_back(StringPiece(
+        normalized_candidate.data() + group_start, group_end - group_start));
+    group_start = group_end;
   }
 
   // Set this to the last group, skipping it if the number has an extension.
@@ -868,8 +1088,8 @@ bool PhoneNumberMatcher::AllNumberGroupsAreExactlyPresent(
   // we only check that the candidate group ends with the formatted number
   // group.
   return (candidate_number_group_index >= 0 &&
-          HasSuffixString(candidate_groups.at(candidate_number_group_index),
-                          formatted_number_groups.at(0)));
+          candidate_groups.at(candidate_number_group_index).ends_with(
+              formatted_number_groups.at(0)));
 }
 
 // static
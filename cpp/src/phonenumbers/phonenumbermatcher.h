@@ -40,14 +40,19 @@ using std::string;
 using std::vector;
 
 class AlternateFormats;
+class CandidateScanner;
 class NumberFormat;
 class PhoneNumber;
 class PhoneNumberMatch;
 class PhoneNumberMatcherRegExps;
 class PhoneNumberUtil;
+class StringPiece;
 
 class PhoneNumberMatcher {
+  friend class ParallelMatcherSegment;
+  friend class PhoneNumberMatcherBenchmark;
   friend class PhoneNumberMatcherTest;
+  friend class PhoneNumberStreamMatcher;
  public:
   // Leniency when finding potential phone numbers in text segments. The levels
   // here are ordered in increasing strictness.
@@ -101,6 +106,19 @@ class PhoneNumberMatcher {
     DONE,
   };
 
+  // Constructs a phone number matcher starting the search at search_index, for
+  // PhoneNumberStreamMatcher. If is_partial_text is true, the text is only the
+  // beginning of a longer one, and the search stops before the first candidate
+  // which the rest of the text could change. It should then resume at
+  // pending_index_ once the rest of the text is available.
+  PhoneNumberMatcher(const PhoneNumberUtil& util,
+                     const string& text,
+                     const string& region_code,
+                     Leniency leniency,
+                     int max_tries,
+                     int search_index,
+                     bool is_partial_text);
+
   // Attempts to extract a match from a candidate string. Returns true if a
   // match is found, otherwise returns false. The value "offset" refers to the
   // start index of the candidate string within the overall text.
@@ -133,18 +151,25 @@ class PhoneNumberMatcher {
     const PhoneNumber& phone_number,
     const string& candidate,
     ResultCallback4<bool, const PhoneNumberUtil&, const PhoneNumber&,
-                    const string&, const vector<string>&>* checker) const;
+                    const string&, const vector<StringPiece>&>* checker) const;
 
+  // Appends to digit_blocks the groups of digits of the national significant
+  // number of number, formatted with formatting_pattern, or with the pattern
+  // of its RFC3966 format if it is NULL. The groups point to
+  // national_significant_number, or to formatted_number when the number has to
+  // be formatted to split it.
   void GetNationalNumberGroups(
       const PhoneNumber& number,
+      const string& national_significant_number,
       const NumberFormat* formatting_pattern,
-      vector<string>* digit_blocks) const;
+      string* formatted_number,
+      vector<StringPiece>* digit_blocks) const;
 
   bool AllNumberGroupsAreExactlyPresent(
       const PhoneNumberUtil& util,
       const PhoneNumber& phone_number,
       const string& normalized_candidate,
-      const vector<string>& formatted_number_groups) const;
+      const vector<StringPiece>& formatted_number_groups) const;
 
   bool VerifyAccordingToLeniency(Leniency leniency, const PhoneNumber& number,
                                  const string& candidate) const;
@@ -192,6 +217,26 @@ class PhoneNumberMatcher {
   // The next index to start searching at. Undefined in State.DONE.
   int search_index_;
 
+  // The scanner of the candidates in text_, created on the first search.
+  scoped_ptr<CandidateScanner> scanner_;
+
+  // Whether the scanner skips the text without digits, true unless it is
+  // turned off by the benchmarks to measure what the skipping saves.
+  bool skip_text_without_digits_;
+
+  // Whether text_ is followed by more text which is not available yet.
+  const bool is_partial_text_;
+
+  // The index to resume the search at once more text is available. Undefined
+  // unless text_ is partial and in State.DONE.
+  int pending_index_;
+
+  // If not NULL, the indices the searches for candidates start at are appended
+  // to it, for PhoneNumberParallelMatcher. Since the matches found after an
+  // index only depend on it, two matchers of the same text starting at the
+  // same index find the same matches afterwards.
+  vector<int>* search_indices_;
+
   DISALLOW_COPY_AND_ASSIGN(PhoneNumberMatcher);
 };
 
@@ -0,0 +1,296 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/phonenumberparallelmatcher.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "phonenumbers/base/logging.h"
+#include "phonenumbers/base/synchronization/lock.h"
+#include "phonenumbers/base/threading/simple_thread.h"
+#include "phonenumbers/encoding_utils.h"
+#include "phonenumbers/phonenumbermatch.h"
+#include "phonenumbers/stl_util.h"
+#include "phonenumbers/utf/unilib.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::min;
+using std::numeric_limits;
+
+namespace {
+
+// The length of a segment when the tests don't change it. The searches of
+// the segments are long enough for the cost of the overlaps to be small, and
+// short enough for the threads to finish at about the same time.
+const int kDefaultSegmentLength = 256 * 1024;
+
+// The number of bytes the search of a segment goes into the next one. The
+// searches of both segments share an index after the first candidate which
+// doesn't cross the boundary between them, so this only needs to be larger
+// than the longest candidates.
+const int kOverlapLength = 4096;
+
+// Returns the index of the first character of text starting at or after index.
+int ToCharacterBoundary(const string& text, int index) {
+  while (index < static_cast<int>(text.length()) &&
+         UniLib::IsTrailByte(text[index])) {
+    ++index;
+  }
+  return index;
+}
+
+}  // namespace
+
+// A segment of the text, searched by a PhoneNumberMatcher of its own.
+class ParallelMatcherSegment {
+ public:
+  // The search starts at begin and goes on until kOverlapLength bytes after
+  // end, both being indices of characters of the text.
+  ParallelMatcherSegment(int begin, int end)
+      : begin_(begin),
+        end_(end),
+        matches_(),
+        leading_search_indices_(),
+        trailing_search_indices_(),
+        pending_index_(end) {}
+
+  ~ParallelMatcherSegment() {
+    STLDeleteElements(&matches_);
+  }
+
+  void Search(const PhoneNumberUtil& util, const string& region_code,
+              PhoneNumberMatcher::Leniency leniency, const string& text) {
+    const int text_length = static_cast<int>(text.length());
+    const int search_end =
+        ToCharacterBoundary(text, min(text_length, end_ + kOverlapLength));
+    // The character before the segment is kept, since the checks of the
+    // candidates look at it.
+    const int text_begin = static_cast<int>(
+        EncodingUtils::BackUpOneUTF8Character(
+            text.data(), text.data() + begin_) - text.data());
+    const bool is_partial_text = search_end < text_length;
+    PhoneNumberMatcher matcher(util,
+                               text.substr(text_begin,
+                                           search_end - text_begin),
+                               region_code, leniency,
+                               numeric_limits<int>::max(),
+                               begin_ - text_begin, is_partial_text);
+    vector<int> search_indices;
+    matcher.search_indices_ = &search_indices;
+    PhoneNumberMatch match;
+    while (matcher.Next(&match)) {
+      matches_.push_back(new PhoneNumberMatch(text_begin + match.start(),
+                                              match.raw_string(),
+                                              match.number()));
+    }
+    for (vector<int>::const_iterator it = search_indices.begin();
+         it != search_indices.end(); ++it) {
+      const int index = text_begin + *it;
+      if (index < begin_ + kOverlapLength) {
+        leading_search_indices_.push_back(index);
+      }
+      if (index >= end_) {
+        trailing_search_indices_.push_back(index);
+      }
+    }
+    pending_index_ =
+        is_partial_text ? text_begin + matcher.pending_index_ : text_length;
+  }
+
+  // Returns the first index, not before min_index, at which the searches of
+  // this segment and of the next one looked for a candidate, or -1 if there is
+  // none.
+  int FindCommonSearchIndex(const ParallelMatcherSegment& next,
+                            int min_index) const {
+    vector<int>::const_iterator it = trailing_search_indices_.begin();
+    vector<int>::const_iterator next_it =
+        next.leading_search_indices_.begin();
+    while (it != trailing_search_indices_.end() &&
+           next_it != next.leading_search_indices_.end()) {
+      if (*it < *next_it || *it < min_index) {
+        ++it;
+      } else if (*next_it < *it) {
+        ++next_it;
+      } else {
+        return *it;
+      }
+    }
+    return -1;
+  }
+
+  // Moves the matches starting at or after begin and before end to matches.
+  void MoveMatches(int begin, int end, vector<PhoneNumberMatch*>* matches) {
+    for (vector<PhoneNumberMatch*>::iterator it = matches_.begin();
+         it != matches_.end(); ++it) {
+      if ((*it)->start() >= begin && (*it)->start() < end) {
+        matches->push_back(*it);
+        *it = NULL;
+      }
+    }
+  }
+
+  int end() const {
+    return end_;
+  }
+
+  // Returns the index at which the search stopped, since the rest of the text
+  // could have changed the next candidate, or the length of the text.
+  int pending_index() const {
+    return pending_index_;
+  }
+
+ private:
+  const int begin_;
+  const int end_;
+  vector<PhoneNumberMatch*> matches_;
+  // The indices the searches for candidates started at in the first
+  // kOverlapLength bytes of the segment.
+  vector<int> leading_search_indices_;
+  // The indices the searches for candidates started at after the end of the
+  // segment.
+  vector<int> trailing_search_indices_;
+  int pending_index_;
+
+  DISALLOW_COPY_AND_ASSIGN(ParallelMatcherSegment);
+};
+
+namespace {
+
+class Worker : public SimpleThread::Delegate {
+ public:
+  Worker(const PhoneNumberUtil& util,
+         const string& region_code,
+         PhoneNumberMatcher::Leniency leniency,
+         const string& text,
+         const vector<ParallelMatcherSegment*>& segments,
+         Lock* lock,
+         size_t* next_segment)
+      : phone_util_(util),
+        region_code_(region_code),
+        leniency_(leniency),
+        text_(text),
+        segments_(segments),
+        lock_(lock),
+        next_segment_(next_segment) {}
+
+  virtual void Run() {
+    size_t segment = 0;
+    while (TakeSegment(&segment)) {
+      segments_[segment]->Search(phone_util_, region_code_, leniency_, text_);
+    }
+  }
+
+ private:
+  // Takes the next segment to search, and returns false if there is none left.
+  bool TakeSegment(size_t* segment) {
+    AutoLock l(*lock_);
+    if (*next_segment_ == segments_.size()) {
+      return false;
+    }
+    *segment = (*next_segment_)++;
+    return true;
+  }
+
+  const PhoneNumberUtil& phone_util_;
+  const string& region_code_;
+  const PhoneNumberMatcher::Leniency leniency_;
+  const string& text_;
+  const vector<ParallelMatcherSegment*>& segments_;
+  Lock* const lock_;
+  size_t* const next_segment_;
+
+  DISALLOW_COPY_AND_ASSIGN(Worker);
+};
+
+}  // namespace
+
+PhoneNumberParallelMatcher::PhoneNumberParallelMatcher(
+    const PhoneNumberUtil& util,
+    const string& region_code,
+    PhoneNumberMatcher::Leniency leniency,
+    int num_threads)
+    : phone_util_(util),
+      preferred_region_(region_code),
+      leniency_(leniency),
+      num_threads_(num_threads),
+      segment_length_(kDefaultSegmentLength) {
+  DCHECK_GE(num_threads, 1);
+}
+
+void PhoneNumberParallelMatcher::FindNumbers(
+    const string& text,
+    vector<PhoneNumberMatch*>* matches) const {
+  DCHECK(matches);
+  const int text_length = static_cast<int>(text.length());
+  vector<ParallelMatcherSegment*> segments;
+  int begin = 0;
+  do {
+    const int end = ToCharacterBoundary(text, begin + segment_length_);
+    segments.push_back(new ParallelMatcherSegment(begin, end));
+    begin = end;
+  } while (begin < text_length);
+
+  const size_t num_workers =
+      min(static_cast<size_t>(num_threads_), segments.size());
+  Lock lock;
+  size_t next_segment = 0;
+  vector<Worker*> workers;
+  for (size_t i = 0; i < num_workers; ++i) {
+    workers.push_back(new Worker(phone_util_, preferred_region_, leniency_,
+                                 text, segments, &lock, &next_segment));
+  }
+  // The calling thread runs the first worker.
+  vector<SimpleThread*> threads;
+  for (size_t i = 1; i < num_workers; ++i) {
+    threads.push_back(new SimpleThread(workers[i]));
+    threads.back()->Start();
+  }
+  workers[0]->Run();
+  for (vector<SimpleThread*>::const_iterator it = threads.begin();
+       it != threads.end(); ++it) {
+    (*it)->Join();
+  }
+  STLDeleteElements(&threads);
+  STLDeleteElements(&workers);
+
+  // The matches of a segment are the ones found between the index its search
+  // shares with the search of the previous segment, and the index it shares
+  // with the search of the next one.
+  int merged_index = 0;
+  for (size_t i = 1; i < segments.size(); ++i) {
+    int common_index =
+        segments[i - 1]->FindCommonSearchIndex(*segments[i], merged_index);
+    if (common_index < 0) {
+      // Searches the segment again from the index the search of the previous
+      // one stopped at.
+      common_index = segments[i - 1]->pending_index();
+      ParallelMatcherSegment* const segment =
+          new ParallelMatcherSegment(common_index, segments[i]->end());
+      segment->Search(phone_util_, preferred_region_, leniency_, text);
+      delete segments[i];
+      segments[i] = segment;
+    }
+    segments[i - 1]->MoveMatches(merged_index, common_index, matches);
+    merged_index = common_index;
+  }
+  segments.back()->MoveMatches(merged_index, numeric_limits<int>::max(),
+                               matches);
+  STLDeleteElements(&segments);
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
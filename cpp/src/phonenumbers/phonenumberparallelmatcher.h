@@ -0,0 +1,90 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Finds the phone numbers of a long text on several threads. The matches are
+// the same as the ones a PhoneNumberMatcher with no limit on the number of
+// retries finds in the whole text.
+//
+// The text is split into segments, which the threads search independently
+// with a PhoneNumberMatcher each. The search of a segment goes on a few KB
+// into the next one, until it reaches an index at which the search of the next
+// segment also looked for a candidate: both searches find the same matches
+// after this index, so the matches of the first one before it are merged with
+// the matches of the second one after it. In the unlikely case where no such
+// index is found, because a single sequence of digits and punctuation covers
+// the whole overlap, the next segment is searched again from the end of the
+// previous one.
+
+#ifndef I18N_PHONENUMBERS_PHONENUMBERPARALLELMATCHER_H_
+#define I18N_PHONENUMBERS_PHONENUMBERPARALLELMATCHER_H_
+
+#include <string>
+#include <vector>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/phonenumbermatcher.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+using std::vector;
+
+class PhoneNumberMatch;
+class PhoneNumberUtil;
+
+class PhoneNumberParallelMatcher {
+  friend class PhoneNumberParallelMatcherTest;
+ public:
+  // Creates a matcher running on num_threads threads, including the thread
+  // calling FindNumbers(), with the same arguments as PhoneNumberMatcher.
+  // num_threads must be positive.
+  PhoneNumberParallelMatcher(const PhoneNumberUtil& util,
+                             const string& region_code,
+                             PhoneNumberMatcher::Leniency leniency,
+                             int num_threads);
+
+  // Finds the phone numbers of text, and appends them to matches in the order
+  // of the text. The caller takes ownership of the matches. This method is
+  // thread-safe.
+  void FindNumbers(const string& text,
+                   vector<PhoneNumberMatch*>* matches) const;
+
+  int num_threads() const {
+    return num_threads_;
+  }
+
+ private:
+  const PhoneNumberUtil& phone_util_;
+
+  // The region(country) to assume for phone numbers without an international
+  // prefix.
+  const string preferred_region_;
+
+  // The degree of validation requested.
+  const PhoneNumberMatcher::Leniency leniency_;
+
+  const int num_threads_;
+
+  // The length in bytes of the segments the text is split into. It is only
+  // changed by the tests.
+  int segment_length_;
+
+  DISALLOW_COPY_AND_ASSIGN(PhoneNumberParallelMatcher);
+};
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_PHONENUMBERPARALLELMATCHER_H_
@@ -0,0 +1,164 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/phonenumberstreammatcher.h"
+
+#include <algorithm>
+#include <limits>
+#include <list>
+#include <string>
+
+#include "phonenumbers/base/logging.h"
+#include "phonenumbers/base/memory/scoped_ptr.h"
+#include "phonenumbers/encoding_utils.h"
+#include "phonenumbers/phonenumbermatch.h"
+#include "phonenumbers/phonenumberutil.h"
+#include "phonenumbers/stl_util.h"
+#include "phonenumbers/utf/unilib.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::max;
+using std::min;
+using std::numeric_limits;
+
+namespace {
+
+// The maximum number of bytes kept after the last searched candidate, which
+// bounds the length of the candidates the chunks can split.
+const int kMaxPendingLength = 2048;
+
+// The number of bytes searched at once. Each search also searches the pending
+// text again, so this makes its cost small compared to the new text's.
+const int kScanLength = 8 * kMaxPendingLength;
+
+}  // namespace
+
+PhoneNumberStreamMatcher::PhoneNumberStreamMatcher(
+    const PhoneNumberUtil& util,
+    const string& region_code,
+    PhoneNumberMatcher::Leniency leniency,
+    int max_tries)
+    : phone_util_(util),
+      preferred_region_(region_code),
+      leniency_(leniency),
+      max_tries_(max_tries),
+      buffer_(),
+      buffer_offset_(0),
+      search_index_(0),
+      finished_(false),
+      matches_() {
+}
+
+PhoneNumberStreamMatcher::PhoneNumberStreamMatcher(const string& region_code)
+    : phone_util_(*PhoneNumberUtil::GetInstance()),
+      preferred_region_(region_code),
+      leniency_(PhoneNumberMatcher::VALID),
+      max_tries_(numeric_limits<int>::max()),
+      buffer_(),
+      buffer_offset_(0),
+      search_index_(0),
+      finished_(false),
+      matches_() {
+}
+
+PhoneNumberStreamMatcher::~PhoneNumberStreamMatcher() {
+  STLDeleteElements(&matches_);
+}
+
+void PhoneNumberStreamMatcher::Feed(const string& chunk) {
+  // Text fed after its end is ignored.
+  DCHECK(!finished_);
+  if (finished_) {
+    return;
+  }
+  size_t position = 0;
+  while (max_tries_ > 0 && position < chunk.length()) {
+    // The text which wasn't searched yet is always shorter than kScanLength
+    // bytes, so that long chunks are searched in several parts.
+    const int unsearched_length =
+        static_cast<int>(buffer_.length()) - search_index_;
+    DCHECK_LT(unsearched_length, kScanLength);
+    const size_t length = min(chunk.length() - position,
+                              static_cast<size_t>(kScanLength -
+                                                  unsearched_length));
+    buffer_.append(chunk, position, length);
+    position += length;
+    if (unsearched_length + static_cast<int>(length) == kScanLength) {
+      Scan();
+    }
+  }
+}
+
+void PhoneNumberStreamMatcher::Finish() {
+  if (finished_) {
+    return;
+  }
+  finished_ = true;
+  if (max_tries_ > 0) {
+    Scan();
+  }
+}
+
+bool PhoneNumberStreamMatcher::HasNext() const {
+  return !matches_.empty();
+}
+
+bool PhoneNumberStreamMatcher::Next(PhoneNumberMatch* match) {
+  DCHECK(match);
+  if (matches_.empty()) {
+    return false;
+  }
+  const scoped_ptr<PhoneNumberMatch> next_match(matches_.front());
+  matches_.pop_front();
+  match->CopyFrom(*next_match);
+  return true;
+}
+
+void PhoneNumberStreamMatcher::Scan() {
+  PhoneNumberMatcher matcher(phone_util_, buffer_, preferred_region_,
+                             leniency_, max_tries_, search_index_,
+                             !finished_);
+  PhoneNumberMatch match;
+  while (matcher.Next(&match)) {
+    matches_.push_back(new PhoneNumberMatch(buffer_offset_ + match.start(),
+                                            match.raw_string(),
+                                            match.number()));
+  }
+  max_tries_ = matcher.max_tries_;
+  if (finished_ || max_tries_ <= 0) {
+    // No more numbers will be found.
+    buffer_.clear();
+    search_index_ = 0;
+    return;
+  }
+  const int length = static_cast<int>(buffer_.length());
+  int pending_index = max(matcher.pending_index_, length - kMaxPendingLength);
+  while (pending_index < length &&
+         UniLib::IsTrailByte(buffer_[pending_index])) {
+    ++pending_index;
+  }
+  // The character before the pending text is kept, since the checks of the
+  // candidates look at it.
+  const int kept_index = static_cast<int>(
+      EncodingUtils::BackUpOneUTF8Character(
+          buffer_.data(), buffer_.data() + pending_index) - buffer_.data());
+  buffer_.erase(0, kept_index);
+  buffer_offset_ += kept_index;
+  search_index_ = pending_index - kept_index;
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -0,0 +1,137 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Finds the phone numbers of a text which is provided in chunks, for instance
+// as it is read from a file or received from the network. The matches are the
+// same as the ones a PhoneNumberMatcher finds in the whole text, with their
+// offsets in the whole text:
+//
+// PhoneNumberStreamMatcher matcher(util, "US", PhoneNumberMatcher::VALID,
+//                                  max_tries);
+// PhoneNumberMatch match;
+// while (ReadChunk(&chunk)) {
+//   matcher.Feed(chunk);
+//   while (matcher.Next(&match)) {
+//     ...
+//   }
+// }
+// matcher.Finish();
+// while (matcher.Next(&match)) {
+//   ...
+// }
+//
+// Only the end of the text which could still be part of a phone number is kept
+// between the chunks, so the memory used doesn't depend on the length of the
+// text, as long as the matches are consumed as they are found. The exception is
+// a candidate longer than 2KB, which takes unusually long runs of digits and
+// punctuation, and of which only the end may be searched for phone numbers.
+// The text is searched by parts of a few KB, so the matches of a chunk may only
+// be found once more text is fed.
+//
+// The offsets of the matches are ints, like the ones of PhoneNumberMatcher, and
+// overflow after 2GB of text.
+
+#ifndef I18N_PHONENUMBERS_PHONENUMBERSTREAMMATCHER_H_
+#define I18N_PHONENUMBERS_PHONENUMBERSTREAMMATCHER_H_
+
+#include <list>
+#include <string>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/phonenumbermatcher.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::list;
+using std::string;
+
+class PhoneNumberMatch;
+class PhoneNumberUtil;
+
+class PhoneNumberStreamMatcher {
+  friend class PhoneNumberStreamMatcherTest;
+ public:
+  // Constructs a phone number matcher of a stream, with the same arguments as
+  // PhoneNumberMatcher. The number of retries is limited over the whole text.
+  PhoneNumberStreamMatcher(const PhoneNumberUtil& util,
+                           const string& region_code,
+                           PhoneNumberMatcher::Leniency leniency,
+                           int max_tries);
+
+  // Wrapper to construct a phone number matcher of a stream, with no
+  // limitation on the number of retries and VALID leniency.
+  explicit PhoneNumberStreamMatcher(const string& region_code);
+
+  ~PhoneNumberStreamMatcher();
+
+  // Appends a chunk to the text. The chunks don't need to end on character
+  // boundaries.
+  void Feed(const string& chunk);
+
+  // Signals the end of the text, so that the numbers at its end can be found.
+  // No chunk can be fed afterwards.
+  void Finish();
+
+  // Returns true if a match was found in the text fed so far and not returned
+  // by Next() yet.
+  bool HasNext() const;
+
+  // Gets the next match found in the text fed so far. Returns false if there is
+  // none, in which case more text or the end of the text is needed to find the
+  // next one.
+  bool Next(PhoneNumberMatch* match);
+
+ private:
+  // Searches the buffered text for phone numbers, and drops the text which the
+  // next searches don't need.
+  void Scan();
+
+  const PhoneNumberUtil& phone_util_;
+
+  // The region(country) to assume for phone numbers without an international
+  // prefix.
+  const string preferred_region_;
+
+  // The degree of validation requested.
+  const PhoneNumberMatcher::Leniency leniency_;
+
+  // The maximum number of retries after matching an invalid number, for the
+  // rest of the text.
+  int max_tries_;
+
+  // The part of the text which is still needed: the text which wasn't searched
+  // yet, or which the rest of the text could make part of a phone number, and
+  // the character before it.
+  string buffer_;
+
+  // The offset of buffer_ in the whole text.
+  int buffer_offset_;
+
+  // The index in buffer_ to resume the search at.
+  int search_index_;
+
+  // Whether the end of the text was signalled.
+  bool finished_;
+
+  // The matches found and not returned by Next() yet, in the order of the text.
+  list<PhoneNumberMatch*> matches_;
+
+  DISALLOW_COPY_AND_ASSIGN(PhoneNumberStreamMatcher);
+};
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_PHONENUMBERSTREAMMATCHER_H_
@@ -29,23 +29,37 @@
 #include <unicode/uchar.h>
 #include <unicode/utf8.h>
 
+#include "phonenumbers/as_you_type_pattern_store.h"
 #include "phonenumbers/asyoutypeformatter.h"
 #include "phonenumbers/base/basictypes.h"
 #include "phonenumbers/base/logging.h"
 #include "phonenumbers/base/memory/singleton.h"
+#include "phonenumbers/base/process/process_metrics.h"
+#include "phonenumbers/base/threading/simple_thread.h"
+#include "phonenumbers/base/time/time.h"
+#include "phonenumbers/compactphonenumber.h"
 #include "phonenumbers/default_logger.h"
+#include "phonenumbers/dfa_based_matcher.h"
+#include "phonenumbers/digit_automaton.h"
 #include "phonenumbers/encoding_utils.h"
+#include "phonenumbers/lazy_metadata_collection.h"
+#include "phonenumbers/matcher_api.h"
 #include "phonenumbers/metadata.h"
-#include "phonenumbers/normalize_utf8.h"
+#include "phonenumbers/normalize_digits.h"
+#include "phonenumbers/number_format_selector.h"
+#include "phonenumbers/number_type_classifier.h"
 #include "phonenumbers/phonemetadata.pb.h"
-#include "phonenumbers/phonenumber.h"
 #include "phonenumbers/phonenumber.pb.h"
+#include "phonenumbers/preparedphonenumber.h"
+#include "phonenumbers/read_mostly_cache.h"
 #include "phonenumbers/regexp_adapter.h"
 #include "phonenumbers/regexp_cache.h"
 #include "phonenumbers/regexp_factory.h"
+#include "phonenumbers/region_index.h"
 #include "phonenumbers/region_code.h"
 #include "phonenumbers/stl_util.h"
 #include "phonenumbers/stringutil.h"
+#include "phonenumbers/template_formatter.h"
 #include "phonenumbers/utf/unicodetext.h"
 #include "phonenumbers/utf/utf.h"
 
@@ -115,8 +129,8 @@ const char kDefaultExtnPrefix[] = " ext. ";
 const char kSingleExtnSymbolsForMatching[] =
     "x\xEF\xBD\x98#\xEF\xBC\x83~\xEF\xBD\x9E";
 
-bool LoadCompiledInMetadata(PhoneMetadataCollection* metadata) {
-  if (!metadata->ParseFromArray(metadata_get(), metadata_size())) {
+bool LoadCompiledInMetadata(LazyMetadataCollection* metadata) {
+  if (!metadata->Init(metadata_get(), metadata_size())) {
     LOG(ERROR) << "Could not parse binary data.";
     return false;
   }
@@ -155,6 +169,21 @@ const PhoneNumberDesc* GetNumberDescByType(
   }
 }
 
+// Compiles the patterns of the formats which are used when formatting.
+void PrecompileFormatPatterns(const RepeatedPtrField<NumberFormat>& formats,
+                              RegExpCache* regexp_cache) {
+  for (RepeatedPtrField<NumberFormat>::const_iterator it = formats.begin();
+       it != formats.end(); ++it) {
+    regexp_cache->GetRegExp(it->pattern());
+    // Only the last leading digits pattern is used, as it is the most
+    // detailed.
+    if (it->leading_digits_pattern_size() > 0) {
+      regexp_cache->GetRegExp(
+          it->leading_digits_pattern(it->leading_digits_pattern_size() - 1));
+    }
+  }
+}
+
 // A helper function that is used by Format and FormatByPattern.
 void PrefixNumberWithCountryCallingCode(
     int country_calling_code,
@@ -178,19 +207,105 @@ void PrefixNumberWithCountryCallingCode(
   }
 }
 
+// Appends to formatted_number the prefix which
+// PrefixNumberWithCountryCallingCode() inserts, for the numbers which are
+// formatted from left to right.
+void AppendCountryCallingCodePrefix(
+    int country_calling_code,
+    PhoneNumberUtil::PhoneNumberFormat number_format,
+    string* formatted_number) {
+  switch (number_format) {
+    case PhoneNumberUtil::E164:
+      formatted_number->append(kPlusSign);
+      StrAppendDecimal(formatted_number, country_calling_code);
+      return;
+    case PhoneNumberUtil::INTERNATIONAL:
+      formatted_number->append(kPlusSign);
+      StrAppendDecimal(formatted_number, country_calling_code);
+      formatted_number->push_back(' ');
+      return;
+    case PhoneNumberUtil::RFC3966:
+      formatted_number->append(kRfc3966Prefix);
+      formatted_number->append(kPlusSign);
+      StrAppendDecimal(formatted_number, country_calling_code);
+      formatted_number->push_back('-');
+      return;
+    case PhoneNumberUtil::NATIONAL:
+    default:
+      // Do nothing.
+      return;
+  }
+}
+
+// The ASCII characters of PhoneNumberUtil::kValidPunctuation.
+const char kAsciiPunctuation[] = "-x ().[]/~";
+
+// Does to the end of formatted_number from start what
+// FormatNsnUsingPatternWithCarrier() does to the numbers formatted in RFC3966
+// with the separator pattern: the leading separators are removed and every
+// other run of separators is replaced by a single '-'. The end of
+// formatted_number must only contain ASCII characters.
+void ReplaceAsciiSeparatorsForRfc3966(size_t start, string* formatted_number) {
+  string& number = *formatted_number;
+  size_t i = start;
+  while (i < number.length() && number[i] != '\0' &&
+         strchr(kAsciiPunctuation, number[i])) {
+    ++i;
+  }
+  size_t length = start;
+  bool after_separator = false;
+  for (; i < number.length(); ++i) {
+    if (number[i] != '\0' && strchr(kAsciiPunctuation, number[i])) {
+      after_separator = true;
+      continue;
+    }
+    if (after_separator) {
+      number[length++] = '-';
+      after_separator = false;
+    }
+    number[length++] = number[i];
+  }
+  if (after_separator) {
+    number[length++] = '-';
+  }
+  number.resize(length);
+}
+
+// Returns true if the decimal representation of suffix is a suffix of the one
+// of number, or if both are equal.
+bool IsDecimalSuffix(uint64 suffix, uint64 number) {
+  do {
+    if (suffix % 10 != number % 10) {
+      return false;
+    }
+    suffix /= 10;
+    number /= 10;
+  } while (suffix > 0);
+  return true;
+}
+
 // Returns true when one national number is the suffix of the other or both are
 // the same.
-bool IsNationalNumberSuffixOfTheOther(const PhoneNumber& first_number,
-                                      const PhoneNumber& second_number) {
-  const string& first_number_national_number =
-    SimpleItoa(static_cast<uint64>(first_number.national_number()));
-  const string& second_number_national_number =
-    SimpleItoa(static_cast<uint64>(second_number.national_number()));
-  // Note that HasSuffixString returns true if the numbers are equal.
-  return HasSuffixString(first_number_national_number,
-                         second_number_national_number) ||
-         HasSuffixString(second_number_national_number,
-                         first_number_national_number);
+bool IsNationalNumberSuffixOfTheOther(uint64 first_national_number,
+                                      uint64 second_national_number) {
+  return IsDecimalSuffix(first_national_number, second_national_number) ||
+         IsDecimalSuffix(second_national_number, first_national_number);
+}
+
+// Returns true if ExactlySameAs() would be true for the numbers once their
+// country calling codes are made the same and the fields ignored by
+// IsNumberMatch() are cleared, i.e. their raw input, country code source,
+// preferred domestic carrier code and empty extension.
+bool HasSameNationalNumberAs(const PhoneNumber& first_number,
+                             const PhoneNumber& second_number) {
+  return first_number.has_national_number() ==
+             second_number.has_national_number() &&
+         first_number.national_number() == second_number.national_number() &&
+         first_number.extension() == second_number.extension() &&
+         first_number.has_italian_leading_zero() ==
+             second_number.has_italian_leading_zero() &&
+         first_number.italian_leading_zero() ==
+             second_number.italian_leading_zero();
 }
 
 char32 ToUnicodeCodepoint(const char* unicode_char) {
@@ -510,8 +625,6 @@ class PhoneNumberRegExpsAndMappings {
 
   scoped_ptr<const RegExp> carrier_code_pattern_;
 
-  scoped_ptr<const RegExp> plus_chars_pattern_;
-
   PhoneNumberRegExpsAndMappings()
       : punctuation_and_star_sign_(StrCat(PhoneNumberUtil::kValidPunctuation,
                                           kStarSign)),
@@ -568,10 +681,7 @@ class PhoneNumberRegExpsAndMappings {
         // used in the pattern will be matched.
         first_group_capturing_pattern_(
             regexp_factory_->CreateRegExp("(\\$\\d)")),
-        carrier_code_pattern_(regexp_factory_->CreateRegExp("\\$CC")),
-        plus_chars_pattern_(
-            regexp_factory_->CreateRegExp(
-                StrCat("[", PhoneNumberUtil::kPlusChars, "]+"))) {
+        carrier_code_pattern_(regexp_factory_->CreateRegExp("\\$CC")) {
     InitializeMapsAndSets();
   }
 
@@ -583,81 +693,69 @@ class PhoneNumberRegExpsAndMappings {
 PhoneNumberUtil::PhoneNumberUtil()
     : logger_(Logger::set_logger_impl(new NullLogger())),
       reg_exps_(new PhoneNumberRegExpsAndMappings),
-      country_calling_code_to_region_code_map_(new vector<IntRegionsPair>()),
-      nanpa_regions_(new set<string>()),
-      region_to_metadata_map_(new map<string, PhoneMetadata>()),
-      country_code_to_non_geographical_metadata_map_(
-          new map<int, PhoneMetadata>) {
+      matcher_api_(new DfaBasedMatcher()),
+      number_type_classifier_(new NumberTypeClassifier(*matcher_api_)),
+      number_format_selector_(new NumberFormatSelector()),
+      template_formatter_(new TemplateFormatter()),
+      national_prefix_for_parsing_automata_(
+          new ReadMostlyCache<const PhoneMetadata*, DigitAutomaton>(256)),
+      as_you_type_pattern_store_(new AsYouTypePatternStore(*this)),
+      metadata_collection_(new LazyMetadataCollection()),
+      region_index_(new RegionIndex()) {
   Logger::set_logger_impl(logger_.get());
   // TODO: Update the java version to put the contents of the init
   // method inside the constructor as well to keep both in sync.
-  PhoneMetadataCollection metadata_collection;
-  if (!LoadCompiledInMetadata(&metadata_collection)) {
+  // Only the keys of the metadata entries are read here, the entries
+  // themselves are parsed the first time they are requested.
+  if (!LoadCompiledInMetadata(metadata_collection_.get())) {
     LOG(DFATAL) << "Could not parse compiled-in metadata.";
     return;
   }
   // Storing data in a temporary map to make it easier to find other regions
   // that share a country calling code when inserting data.
-  map<int, list<string>* > country_calling_code_to_region_map;
-  for (RepeatedPtrField<PhoneMetadata>::const_iterator it =
-           metadata_collection.metadata().begin();
-       it != metadata_collection.metadata().end();
-       ++it) {
-    const string& region_code = it->id();
+  map<int, list<string> > country_calling_code_to_region_map;
+  for (int i = 0; i < metadata_collection_->size(); ++i) {
+    const string& region_code = metadata_collection_->id(i);
     if (region_code == RegionCode::GetUnknown()) {
       continue;
     }
 
-    int country_calling_code = it->country_code();
+    int country_calling_code = metadata_collection_->country_code(i);
+    if (country_calling_code < 0 ||
+        country_calling_code > RegionIndex::kMaxCountryCallingCode) {
+      LOG(DFATAL) << "Invalid country calling code (" << country_calling_code
+                  << ") for region " << region_code;
+      continue;
+    }
     if (kRegionCodeForNonGeoEntity == region_code) {
-      country_code_to_non_geographical_metadata_map_->insert(
-          make_pair(country_calling_code, *it));
+      region_index_->AddNonGeographicalEntity(country_calling_code, i);
+    } else if (RegionIndex::IsIndexableRegionCode(region_code)) {
+      region_index_->AddRegion(region_code, i);
     } else {
-      region_to_metadata_map_->insert(make_pair(region_code, *it));
+      LOG(DFATAL) << "Invalid region code: " << region_code;
+      continue;
     }
-    map<int, list<string>* >::iterator calling_code_in_map =
-        country_calling_code_to_region_map.find(country_calling_code);
-    if (calling_code_in_map != country_calling_code_to_region_map.end()) {
-      if (it->main_country_for_code()) {
-        calling_code_in_map->second->push_front(region_code);
-      } else {
-        calling_code_in_map->second->push_back(region_code);
-      }
+    list<string>& region_codes =
+        country_calling_code_to_region_map[country_calling_code];
+    if (metadata_collection_->main_country_for_code(i)) {
+      region_codes.push_front(region_code);
     } else {
-      // For most country calling codes, there will be only one region code.
-      list<string>* list_with_region_code = new list<string>();
-      list_with_region_code->push_back(region_code);
-      country_calling_code_to_region_map.insert(
-          make_pair(country_calling_code, list_with_region_code));
-    }
-    if (country_calling_code == kNanpaCountryCode) {
-        nanpa_regions_->insert(region_code);
+      region_codes.push_back(region_code);
     }
   }
 
-  country_calling_code_to_region_code_map_->insert(
-      country_calling_code_to_region_code_map_->begin(),
-      country_calling_code_to_region_map.begin(),
-      country_calling_code_to_region_map.end());
-  // Sort all the pairs in ascending order according to country calling code.
-  sort(country_calling_code_to_region_code_map_->begin(),
-       country_calling_code_to_region_code_map_->end(),
-       OrderByFirst());
+  for (map<int, list<string> >::const_iterator it =
+           country_calling_code_to_region_map.begin();
+       it != country_calling_code_to_region_map.end(); ++it) {
+    region_index_->SetRegionsForCountryCallingCode(it->first, it->second);
+  }
 }
 
-PhoneNumberUtil::~PhoneNumberUtil() {
-  STLDeleteContainerPairSecondPointers(
-      country_calling_code_to_region_code_map_->begin(),
-      country_calling_code_to_region_code_map_->end());
-}
+PhoneNumberUtil::~PhoneNumberUtil() {}
 
 void PhoneNumberUtil::GetSupportedRegions(set<string>* regions) const {
   DCHECK(regions);
-  for (map<string, PhoneMetadata>::const_iterator it =
-       region_to_metadata_map_->begin(); it != region_to_metadata_map_->end();
-       ++it) {
-    regions->insert(it->first);
-  }
+  region_index_->GetRegions(regions);
 }
 
 // Public wrapper function to get a PhoneNumberUtil instance with the default
@@ -673,9 +771,7 @@ const string& PhoneNumberUtil::GetExtnPatternsForMatching() const {
 
 bool PhoneNumberUtil::StartsWithPlusCharsPattern(const string& number)
     const {
-  const scoped_ptr<RegExpInput> number_string_piece(
-      reg_exps_->regexp_factory_->CreateInput(number));
-  return reg_exps_->plus_chars_pattern_->Consume(number_string_piece.get());
+  return GetLeadingPlusCharsLength(number) > 0;
 }
 
 bool PhoneNumberUtil::ContainsOnlyValidDigits(const string& s) const {
@@ -746,48 +842,44 @@ void PhoneNumberUtil::GetNddPrefixForRegion(const string& region_code,
 }
 
 bool PhoneNumberUtil::IsValidRegionCode(const string& region_code) const {
-  return (region_to_metadata_map_->find(region_code) !=
-          region_to_metadata_map_->end());
+  return region_index_->FindRegion(region_code) >= 0;
 }
 
 bool PhoneNumberUtil::HasValidCountryCallingCode(
     int country_calling_code) const {
-  // Create an IntRegionsPair with the country_code passed in, and use it to
-  // locate the pair with the same country_code in the sorted vector.
-  IntRegionsPair target_pair;
-  target_pair.first = country_calling_code;
-  return (binary_search(country_calling_code_to_region_code_map_->begin(),
-                        country_calling_code_to_region_code_map_->end(),
-                        target_pair, OrderByFirst()));
+  size_t num_region_codes;
+  region_index_->GetRegionsForCountryCallingCode(country_calling_code,
+                                                 &num_region_codes);
+  return num_region_codes > 0;
 }
 
 // Returns a pointer to the phone metadata for the appropriate region or NULL
 // if the region code is invalid or unknown.
 const PhoneMetadata* PhoneNumberUtil::GetMetadataForRegion(
     const string& region_code) const {
-  map<string, PhoneMetadata>::const_iterator it =
-      region_to_metadata_map_->find(region_code);
-  if (it != region_to_metadata_map_->end()) {
-    return &it->second;
-  }
-  return NULL;
+  const int index = region_index_->FindRegion(region_code);
+  return index >= 0 ? metadata_collection_->Get(index) : NULL;
 }
 
 const PhoneMetadata* PhoneNumberUtil::GetMetadataForNonGeographicalRegion(
     int country_calling_code) const {
-  map<int, PhoneMetadata>::const_iterator it =
-      country_code_to_non_geographical_metadata_map_->find(
-          country_calling_code);
-  if (it != country_code_to_non_geographical_metadata_map_->end()) {
-    return &it->second;
-  }
-  return NULL;
+  const int index =
+      region_index_->FindNonGeographicalEntity(country_calling_code);
+  return index >= 0 ? metadata_collection_->Get(index) : NULL;
 }
 
 void PhoneNumberUtil::Format(const PhoneNumber& number,
                              PhoneNumberFormat number_format,
                              string* formatted_number) const {
   DCHECK(formatted_number);
+  formatted_number->clear();
+  AppendFormattedNumber(number, number_format, formatted_number);
+}
+
+void PhoneNumberUtil::AppendFormattedNumber(const PhoneNumber& number,
+                                            PhoneNumberFormat number_format,
+                                            string* formatted_number) const {
+  DCHECK(formatted_number);
   if (number.national_number() == 0) {
     const string& raw_input = number.raw_input();
     if (!raw_input.empty()) {
@@ -796,24 +888,22 @@ void PhoneNumberUtil::Format(const PhoneNumber& number,
       // leading '+' symbol (but the original number wasn't parseable anyway).
       // TODO: Consider removing the 'if' above so that unparseable
       // strings without raw input format to the empty string instead of "+00".
-      formatted_number->assign(raw_input);
+      formatted_number->append(raw_input);
       return;
     }
   }
   int country_calling_code = number.country_code();
-  string national_significant_number;
-  GetNationalSignificantNumber(number, &national_significant_number);
   if (number_format == E164) {
     // Early exit for E164 case (even if the country calling code is invalid)
     // since no formatting of the national number needs to be applied.
     // Extensions are not formatted.
-    formatted_number->assign(national_significant_number);
-    PrefixNumberWithCountryCallingCode(country_calling_code, E164,
-                                       formatted_number);
+    AppendCountryCallingCodePrefix(country_calling_code, E164,
+                                   formatted_number);
+    GetNationalSignificantNumber(number, formatted_number);
     return;
   }
   if (!HasValidCountryCallingCode(country_calling_code)) {
-    formatted_number->assign(national_significant_number);
+    GetNationalSignificantNumber(number, formatted_number);
     return;
   }
   // Note here that all NANPA formatting rules are contained by US, so we use
@@ -827,12 +917,23 @@ void PhoneNumberUtil::Format(const PhoneNumber& number,
   // region codes).
   const PhoneMetadata* metadata =
       GetMetadataForRegionOrCallingCode(country_calling_code, region_code);
-  FormatNsn(national_significant_number, *metadata, number_format,
-            formatted_number);
+  string national_significant_number;
+  GetNationalSignificantNumber(number, &national_significant_number);
+  AppendCountryCallingCodePrefix(country_calling_code, number_format,
+                                 formatted_number);
+  AppendFormattedNsn(national_significant_number, *metadata, number_format, "",
+                     formatted_number);
   MaybeAppendFormattedExtension(number, *metadata, number_format,
                                 formatted_number);
-  PrefixNumberWithCountryCallingCode(country_calling_code, number_format,
-                                     formatted_number);
+}
+
+void PhoneNumberUtil::Format(const CompactPhoneNumber& number,
+                             PhoneNumberFormat number_format,
+                             string* formatted_number) const {
+  DCHECK(formatted_number);
+  PhoneNumber phone_number;
+  number.ToPhoneNumber(&phone_number);
+  Format(phone_number, number_format, formatted_number);
 }
 
 void PhoneNumberUtil::FormatByPattern(
@@ -858,8 +959,8 @@ void PhoneNumberUtil::FormatByPattern(
   const PhoneMetadata* metadata =
       GetMetadataForRegionOrCallingCode(country_calling_code, region_code);
   const NumberFormat* formatting_pattern =
-      ChooseFormattingPatternForNumber(user_defined_formats,
-                                       national_significant_number);
+      ChooseFormattingPatternUsingRegExps(user_defined_formats,
+                                          national_significant_number);
   if (!formatting_pattern) {
     // If no pattern above is matched, we format the number as a whole.
     formatted_number->assign(national_significant_number);
@@ -1382,6 +1483,18 @@ void PhoneNumberUtil::FormatOutOfCountryKeepingAlphaChars(
 const NumberFormat* PhoneNumberUtil::ChooseFormattingPatternForNumber(
     const RepeatedPtrField<NumberFormat>& available_formats,
     const string& national_number) const {
+  const NumberFormat* format;
+  if (number_format_selector_->ChooseFormat(available_formats, national_number,
+                                            &format)) {
+    return format;
+  }
+  return ChooseFormattingPatternUsingRegExps(available_formats,
+                                             national_number);
+}
+
+const NumberFormat* PhoneNumberUtil::ChooseFormattingPatternUsingRegExps(
+    const RepeatedPtrField<NumberFormat>& available_formats,
+    const string& national_number) const {
   for (RepeatedPtrField<NumberFormat>::const_iterator
        it = available_formats.begin(); it != available_formats.end(); ++it) {
     int size = it->leading_digits_pattern_size();
@@ -1476,31 +1589,60 @@ void PhoneNumberUtil::FormatNsn(const string& number,
   FormatNsnWithCarrier(number, metadata, number_format, "", formatted_number);
 }
 
-// Note in some regions, the national number can be written in two completely
-// different ways depending on whether it forms part of the NATIONAL format or
-// INTERNATIONAL format. The number_format parameter here is used to specify
-// which format to use for those cases. If a carrier_code is specified, this
-// will be inserted into the formatted string to replace $CC.
 void PhoneNumberUtil::FormatNsnWithCarrier(const string& number,
                                            const PhoneMetadata& metadata,
                                            PhoneNumberFormat number_format,
                                            const string& carrier_code,
                                            string* formatted_number) const {
   DCHECK(formatted_number);
+  formatted_number->clear();
+  AppendFormattedNsn(number, metadata, number_format, carrier_code,
+                     formatted_number);
+}
+
+// Note in some regions, the national number can be written in two completely
+// different ways depending on whether it forms part of the NATIONAL format or
+// INTERNATIONAL format. The number_format parameter here is used to specify
+// which format to use for those cases. If a carrier_code is specified, this
+// will be inserted into the formatted string to replace $CC.
+void PhoneNumberUtil::AppendFormattedNsn(const string& number,
+                                         const PhoneMetadata& metadata,
+                                         PhoneNumberFormat number_format,
+                                         const string& carrier_code,
+                                         string* formatted_number) const {
+  DCHECK(formatted_number);
   // When the intl_number_formats exists, we use that to format national number
   // for the INTERNATIONAL format instead of using the number_formats.
-  const RepeatedPtrField<NumberFormat> available_formats =
+  const RepeatedPtrField<NumberFormat>& available_formats =
       (metadata.intl_number_format_size() == 0 || number_format == NATIONAL)
       ? metadata.number_format()
       : metadata.intl_number_format();
   const NumberFormat* formatting_pattern =
       ChooseFormattingPatternForNumber(available_formats, number);
   if (!formatting_pattern) {
-    formatted_number->assign(number);
-  } else {
-    FormatNsnUsingPatternWithCarrier(number, *formatting_pattern, number_format,
-                                     carrier_code, formatted_number);
+    formatted_number->append(number);
+    return;
+  }
+  // The templates of the formats don't apply the carrier code formatting
+  // rules.
+  const bool uses_carrier_code =
+      number_format == NATIONAL && !carrier_code.empty() &&
+      !formatting_pattern->domestic_carrier_code_formatting_rule().empty();
+  const size_t start = formatted_number->length();
+  if (!uses_carrier_code &&
+      template_formatter_->Format(number, *formatting_pattern,
+                                  number_format == NATIONAL,
+                                  formatted_number)) {
+    if (number_format == RFC3966) {
+      // The templates only produce ASCII characters.
+      ReplaceAsciiSeparatorsForRfc3966(start, formatted_number);
+    }
+    return;
   }
+  string formatted_nsn;
+  FormatNsnUsingPatternWithCarrier(number, *formatting_pattern, number_format,
+                                   carrier_code, &formatted_nsn);
+  formatted_number->append(formatted_nsn);
 }
 
 // Appends the formatted extension of a phone number, if the phone number had an
@@ -1526,7 +1668,9 @@ void PhoneNumberUtil::MaybeAppendFormattedExtension(
 }
 
 bool PhoneNumberUtil::IsNANPACountry(const string& region_code) const {
-  return nanpa_regions_->find(region_code) != nanpa_regions_->end();
+  const int index = region_index_->FindRegion(region_code);
+  return index >= 0 &&
+      metadata_collection_->country_code(index) == kNanpaCountryCode;
 }
 
 // Returns the region codes that matches the specific country calling code. In
@@ -1535,20 +1679,11 @@ void PhoneNumberUtil::GetRegionCodesForCountryCallingCode(
     int country_calling_code,
     list<string>* region_codes) const {
   DCHECK(region_codes);
-  // Create a IntRegionsPair with the country_code passed in, and use it to
-  // locate the pair with the same country_code in the sorted vector.
-  IntRegionsPair target_pair;
-  target_pair.first = country_calling_code;
-  typedef vector<IntRegionsPair>::const_iterator ConstIterator;
-  pair<ConstIterator, ConstIterator> range = equal_range(
-      country_calling_code_to_region_code_map_->begin(),
-      country_calling_code_to_region_code_map_->end(),
-      target_pair, OrderByFirst());
-  if (range.first != range.second) {
-    region_codes->insert(region_codes->begin(),
-                         range.first->second->begin(),
-                         range.first->second->end());
-  }
+  size_t num_region_codes;
+  const string* const codes = region_index_->GetRegionsForCountryCallingCode(
+      country_calling_code, &num_region_codes);
+  region_codes->insert(region_codes->begin(), codes,
+                       codes + num_region_codes);
 }
 
 // Returns the region code that matches the specific country calling code. In
@@ -1558,43 +1693,52 @@ void PhoneNumberUtil::GetRegionCodeForCountryCode(
     int country_calling_code,
     string* region_code) const {
   DCHECK(region_code);
-  list<string> region_codes;
-
-  GetRegionCodesForCountryCallingCode(country_calling_code, &region_codes);
-  *region_code = (region_codes.size() > 0) ?
-      region_codes.front() : RegionCode::GetUnknown();
+  size_t num_region_codes;
+  const string* const region_codes =
+      region_index_->GetRegionsForCountryCallingCode(country_calling_code,
+                                                     &num_region_codes);
+  *region_code = (num_region_codes > 0) ?
+      region_codes[0] : RegionCode::GetUnknown();
 }
 
 void PhoneNumberUtil::GetRegionCodeForNumber(const PhoneNumber& number,
                                              string* region_code) const {
   DCHECK(region_code);
-  int country_calling_code = number.country_code();
-  list<string> region_codes;
-  GetRegionCodesForCountryCallingCode(country_calling_code, &region_codes);
-  if (region_codes.size() == 0) {
-    string number_string;
-    GetNationalSignificantNumber(number, &number_string);
+  string national_number;
+  GetNationalSignificantNumber(number, &national_number);
+  GetRegionCodeForNationalNumber(number.country_code(), national_number,
+                                 region_code);
+}
+
+void PhoneNumberUtil::GetRegionCodeForNationalNumber(
+    int country_calling_code, const string& national_number,
+    string* region_code) const {
+  DCHECK(region_code);
+  size_t num_region_codes;
+  const string* const region_codes =
+      region_index_->GetRegionsForCountryCallingCode(country_calling_code,
+                                                     &num_region_codes);
+  if (num_region_codes == 0) {
     LOG(WARNING) << "Missing/invalid country calling code ("
                  << country_calling_code
-                 << ") for number " << number_string;
+                 << ") for number " << national_number;
     *region_code = RegionCode::GetUnknown();
     return;
   }
-  if (region_codes.size() == 1) {
-    *region_code = region_codes.front();
+  if (num_region_codes == 1) {
+    *region_code = region_codes[0];
   } else {
-    GetRegionCodeForNumberFromRegionList(number, region_codes, region_code);
+    GetRegionCodeForNumberFromRegionList(national_number, region_codes,
+                                         num_region_codes, region_code);
   }
 }
 
 void PhoneNumberUtil::GetRegionCodeForNumberFromRegionList(
-    const PhoneNumber& number, const list<string>& region_codes,
-    string* region_code) const {
+    const string& national_number, const string* region_codes,
+    size_t num_region_codes, string* region_code) const {
   DCHECK(region_code);
-  string national_number;
-  GetNationalSignificantNumber(number, &national_number);
-  for (list<string>::const_iterator it = region_codes.begin();
-       it != region_codes.end(); ++it) {
+  for (const string* it = region_codes;
+       it != region_codes + num_region_codes; ++it) {
     // Metadata cannot be NULL because the region codes come from the country
     // calling code map.
     const PhoneMetadata* metadata = GetMetadataForRegion(*it);
@@ -1625,8 +1769,8 @@ int PhoneNumberUtil::GetCountryCodeForRegion(const string& region_code) const {
 
 int PhoneNumberUtil::GetCountryCodeForValidRegion(
     const string& region_code) const {
-  const PhoneMetadata* metadata = GetMetadataForRegion(region_code);
-  return metadata->country_code();
+  return metadata_collection_->country_code(
+      region_index_->FindRegion(region_code));
 }
 
 // Gets a valid fixed-line number for the specified region_code. Returns false
@@ -1695,9 +1839,59 @@ PhoneNumberUtil::ErrorType PhoneNumberUtil::Parse(const string& number_to_parse,
                                                   const string& default_region,
                                                   PhoneNumber* number) const {
   DCHECK(number);
+  if (MaybeParseE164Number(number_to_parse, default_region, number)) {
+    return NO_PARSING_ERROR;
+  }
   return ParseHelper(number_to_parse, default_region, false, true, number);
 }
 
+void PhoneNumberUtil::ParseBatch(const string* numbers_to_parse,
+                                 const string* default_regions,
+                                 size_t num_numbers,
+                                 PhoneNumber* numbers,
+                                 ErrorType* errors) const {
+  ParseBatchHelper(numbers_to_parse, default_regions, 1, num_numbers, numbers,
+                   errors);
+}
+
+void PhoneNumberUtil::ParseBatch(const string* numbers_to_parse,
+                                 const string& default_region,
+                                 size_t num_numbers,
+                                 PhoneNumber* numbers,
+                                 ErrorType* errors) const {
+  ParseBatchHelper(numbers_to_parse, &default_region, 0, num_numbers, numbers,
+                   errors);
+}
+
+void PhoneNumberUtil::ParseBatchHelper(const string* numbers_to_parse,
+                                       const string* default_regions,
+                                       size_t default_regions_stride,
+                                       size_t num_numbers,
+                                       PhoneNumber* numbers,
+                                       ErrorType* errors) const {
+  DCHECK(num_numbers == 0 ||
+         (numbers_to_parse && default_regions && numbers && errors));
+  // The numbers in E.164 format, which are the bulk of most inputs, are parsed
+  // in a first pass so that the other ones don't evict the data of the fast
+  // path from the caches.
+  vector<size_t> remaining_numbers;
+  for (size_t i = 0; i < num_numbers; ++i) {
+    if (MaybeParseE164Number(numbers_to_parse[i],
+                             default_regions[i * default_regions_stride],
+                             &numbers[i])) {
+      errors[i] = NO_PARSING_ERROR;
+    } else {
+      remaining_numbers.push_back(i);
+    }
+  }
+  for (vector<size_t>::const_iterator it = remaining_numbers.begin();
+       it != remaining_numbers.end(); ++it) {
+    errors[*it] = ParseHelper(numbers_to_parse[*it],
+                              default_regions[*it * default_regions_stride],
+                              false, true, &numbers[*it]);
+  }
+}
+
 PhoneNumberUtil::ErrorType PhoneNumberUtil::ParseAndKeepRawInput(
     const string& number_to_parse,
     const string& default_region,
@@ -1714,9 +1908,7 @@ bool PhoneNumberUtil::CheckRegionForParsing(
     const string& number_to_parse,
     const string& default_region) const {
   if (!IsValidRegionCode(default_region) && !number_to_parse.empty()) {
-    const scoped_ptr<RegExpInput> number(
-        reg_exps_->regexp_factory_->CreateInput(number_to_parse));
-    if (!reg_exps_->plus_chars_pattern_->Consume(number.get())) {
+    if (GetLeadingPlusCharsLength(number_to_parse) == 0) {
       return false;
     }
   }
@@ -1821,11 +2013,11 @@ PhoneNumberUtil::ErrorType PhoneNumberUtil::ParseHelper(
       MaybeExtractCountryCode(country_metadata, keep_raw_input,
                               &normalized_national_number, &temp_number);
   if (country_code_error != NO_PARSING_ERROR) {
-     const scoped_ptr<RegExpInput> number_string_piece(
-        reg_exps_->regexp_factory_->CreateInput(national_number));
+    const size_t plus_chars_length = GetLeadingPlusCharsLength(national_number);
     if ((country_code_error == INVALID_COUNTRY_CODE_ERROR) &&
-        (reg_exps_->plus_chars_pattern_->Consume(number_string_piece.get()))) {
-      normalized_national_number.assign(number_string_piece->ToString());
+        plus_chars_length > 0) {
+      normalized_national_number.assign(national_number, plus_chars_length,
+                                        string::npos);
       // Strip the plus-char, and try again.
       MaybeExtractCountryCode(country_metadata,
                               keep_raw_input,
@@ -1894,6 +2086,95 @@ PhoneNumberUtil::ErrorType PhoneNumberUtil::ParseHelper(
   return NO_PARSING_ERROR;
 }
 
+// Each step below mirrors the outcome of ParseHelper() for such a number, and
+// bails out whenever it would do anything else.
+bool PhoneNumberUtil::MaybeParseE164Number(const string& number_to_parse,
+                                           const string& default_region,
+                                           PhoneNumber* phone_number) const {
+  // ParseHelper() requires more than kMinLengthForNsn digits after the plus
+  // sign, and the national number can't be longer than kMaxLengthForNsn.
+  const size_t length = number_to_parse.length();
+  if (length < 2 + kMinLengthForNsn ||
+      length > 1 + kMaxLengthCountryCode + kMaxLengthForNsn ||
+      number_to_parse[0] != kPlusSign[0]) {
+    return false;
+  }
+  const char* const digits = number_to_parse.data() + 1;
+  const size_t num_digits = length - 1;
+  for (size_t i = 0; i < num_digits; ++i) {
+    if (digits[i] < '0' || digits[i] > '9') {
+      return false;
+    }
+  }
+  // Same as ExtractCountryCode().
+  if (digits[0] == '0') {
+    return false;
+  }
+  int country_code = 0;
+  size_t country_code_length = 0;
+  const string* region_codes = NULL;
+  size_t num_region_codes = 0;
+  while (num_region_codes == 0 && country_code_length < kMaxLengthCountryCode) {
+    country_code = country_code * 10 + (digits[country_code_length++] - '0');
+    region_codes = region_index_->GetRegionsForCountryCallingCode(
+        country_code, &num_region_codes);
+  }
+  if (num_region_codes == 0) {
+    return false;
+  }
+  const char* const national_number = digits + country_code_length;
+  const size_t national_number_length = num_digits - country_code_length;
+  if (national_number_length < kMinLengthForNsn ||
+      national_number_length > kMaxLengthForNsn) {
+    return false;
+  }
+  // The metadata is chosen as in ParseHelper(). The number is left as is unless
+  // it starts with the national prefix for parsing of this metadata.
+  const string& region_code = region_codes[0];
+  const PhoneMetadata* const metadata = region_code == default_region
+      ? GetMetadataForRegion(default_region)
+      : GetMetadataForRegionOrCallingCode(country_code, region_code);
+  if (metadata && !metadata->national_prefix_for_parsing().empty()) {
+    const DigitAutomaton* const automaton =
+        GetNationalPrefixForParsingAutomaton(*metadata);
+    if (!automaton ||
+        automaton->PrefixMatch(national_number, national_number_length)) {
+      return false;
+    }
+  }
+  phone_number->Clear();
+  phone_number->set_country_code(country_code);
+  // Same as SetItalianLeadingZerosForPhoneNumber().
+  if (national_number[0] == '0') {
+    phone_number->set_italian_leading_zero(true);
+    size_t number_of_leading_zeros = 1;
+    while (number_of_leading_zeros < national_number_length - 1 &&
+           national_number[number_of_leading_zeros] == '0') {
+      ++number_of_leading_zeros;
+    }
+    if (number_of_leading_zeros != 1) {
+      phone_number->set_number_of_leading_zeros(number_of_leading_zeros);
+    }
+  }
+  uint64 number_as_int = 0;
+  for (size_t i = 0; i < national_number_length; ++i) {
+    number_as_int = number_as_int * 10 + (national_number[i] - '0');
+  }
+  phone_number->set_national_number(number_as_int);
+  return true;
+}
+
+const DigitAutomaton* PhoneNumberUtil::GetNationalPrefixForParsingAutomaton(
+    const PhoneMetadata& metadata) const {
+  const DigitAutomaton* automaton;
+  if (national_prefix_for_parsing_automata_->Find(&metadata, &automaton)) {
+    return automaton;
+  }
+  return national_prefix_for_parsing_automata_->Insert(
+      &metadata,
+      DigitAutomaton::Create(metadata.national_prefix_for_parsing()));
+}
+
 // Attempts to extract a possible number from the string passed in. This
 // currently strips all leading characters that could not be used to start a
 // phone number. Characters that can be used to start a phone number are
@@ -2002,27 +2283,64 @@ bool PhoneNumberUtil::TruncateTooLongNumber(PhoneNumber* number) const {
 
 PhoneNumberUtil::PhoneNumberType PhoneNumberUtil::GetNumberType(
     const PhoneNumber& number) const {
+  string national_significant_number;
+  GetNationalSignificantNumber(number, &national_significant_number);
+  return GetNumberTypeOfNationalNumber(number.country_code(),
+                                       national_significant_number);
+}
+
+PhoneNumberUtil::PhoneNumberType PhoneNumberUtil::GetNumberType(
+    const CompactPhoneNumber& number) const {
+  string national_significant_number;
+  GetNationalSignificantNumber(number, &national_significant_number);
+  return GetNumberTypeOfNationalNumber(number.country_code(),
+                                       national_significant_number);
+}
+
+PhoneNumberUtil::PhoneNumberType PhoneNumberUtil::GetNumberTypeOfNationalNumber(
+    int country_calling_code, const string& national_number) const {
   string region_code;
-  GetRegionCodeForNumber(number, &region_code);
+  GetRegionCodeForNationalNumber(country_calling_code, national_number,
+                                 &region_code);
   const PhoneMetadata* metadata =
-      GetMetadataForRegionOrCallingCode(number.country_code(), region_code);
+      GetMetadataForRegionOrCallingCode(country_calling_code, region_code);
   if (!metadata) {
     return UNKNOWN;
   }
+  return GetNumberTypeHelper(national_number, *metadata);
+}
+
+bool PhoneNumberUtil::IsValidNumber(const PhoneNumber& number) const {
   string national_significant_number;
   GetNationalSignificantNumber(number, &national_significant_number);
-  return GetNumberTypeHelper(national_significant_number, *metadata);
+  string region_code;
+  GetRegionCodeForNationalNumber(number.country_code(),
+                                 national_significant_number, &region_code);
+  return IsValidNationalNumberForRegion(
+      number.country_code(), national_significant_number, region_code);
 }
 
-bool PhoneNumberUtil::IsValidNumber(const PhoneNumber& number) const {
+bool PhoneNumberUtil::IsValidNumber(const CompactPhoneNumber& number) const {
+  string national_significant_number;
+  GetNationalSignificantNumber(number, &national_significant_number);
   string region_code;
-  GetRegionCodeForNumber(number, &region_code);
-  return IsValidNumberForRegion(number, region_code);
+  GetRegionCodeForNationalNumber(number.country_code(),
+                                 national_significant_number, &region_code);
+  return IsValidNationalNumberForRegion(
+      number.country_code(), national_significant_number, region_code);
 }
 
 bool PhoneNumberUtil::IsValidNumberForRegion(const PhoneNumber& number,
                                              const string& region_code) const {
-  int country_code = number.country_code();
+  string national_number;
+  GetNationalSignificantNumber(number, &national_number);
+  return IsValidNationalNumberForRegion(number.country_code(), national_number,
+                                        region_code);
+}
+
+bool PhoneNumberUtil::IsValidNationalNumberForRegion(
+    int country_code, const string& national_number,
+    const string& region_code) const {
   const PhoneMetadata* metadata =
       GetMetadataForRegionOrCallingCode(country_code, region_code);
   if (!metadata ||
@@ -2032,9 +2350,6 @@ bool PhoneNumberUtil::IsValidNumberForRegion(const PhoneNumber& number,
     // number does not match that of the region code.
     return false;
   }
-  string national_number;
-  GetNationalSignificantNumber(number, &national_number);
-
   return GetNumberTypeHelper(national_number, *metadata) != UNKNOWN;
 }
 
@@ -2077,67 +2392,69 @@ void PhoneNumberUtil::SetItalianLeadingZerosForPhoneNumber(
 
 bool PhoneNumberUtil::IsNumberPossibleForDesc(
     const string& national_number, const PhoneNumberDesc& number_desc) const {
-  return reg_exps_->regexp_cache_.get()->
-             GetRegExp(number_desc.possible_number_pattern())
-             .FullMatch(national_number);
+  return matcher_api_->MatchesPossibleNumber(national_number, number_desc);
 }
 
 bool PhoneNumberUtil::IsNumberMatchingDesc(
     const string& national_number, const PhoneNumberDesc& number_desc) const {
   return IsNumberPossibleForDesc(national_number, number_desc) &&
-         reg_exps_->regexp_cache_.get()->
-             GetRegExp(number_desc.national_number_pattern())
-             .FullMatch(national_number);
+         matcher_api_->MatchesNationalNumber(national_number, number_desc,
+                                             false);
 }
 
 PhoneNumberUtil::PhoneNumberType PhoneNumberUtil::GetNumberTypeHelper(
     const string& national_number, const PhoneMetadata& metadata) const {
-  if (!IsNumberMatchingDesc(national_number, metadata.general_desc())) {
+  // All the descriptions are matched in a single pass over the number.
+  const uint32 matching_descs =
+      number_type_classifier_->GetMatchingDescs(national_number, metadata);
+  if (!(matching_descs & (1 << NumberTypeClassifier::GENERAL_DESC))) {
     VLOG(4) << "Number type unknown - doesn't match general national number"
             << " pattern.";
     return PhoneNumberUtil::UNKNOWN;
   }
-  if (IsNumberMatchingDesc(national_number, metadata.premium_rate())) {
+  if (matching_descs & (1 << NumberTypeClassifier::PREMIUM_RATE)) {
     VLOG(4) << "Number is a premium number.";
     return PhoneNumberUtil::PREMIUM_RATE;
   }
-  if (IsNumberMatchingDesc(national_number, metadata.toll_free())) {
+  if (matching_descs & (1 << NumberTypeClassifier::TOLL_FREE)) {
     VLOG(4) << "Number is a toll-free number.";
     return PhoneNumberUtil::TOLL_FREE;
   }
-  if (IsNumberMatchingDesc(national_number, metadata.shared_cost())) {
+  if (matching_descs & (1 << NumberTypeClassifier::SHARED_COST)) {
     VLOG(4) << "Number is a shared cost number.";
     return PhoneNumberUtil::SHARED_COST;
   }
-  if (IsNumberMatchingDesc(national_number, metadata.voip())) {
+  if (matching_descs & (1 << NumberTypeClassifier::VOIP)) {
     VLOG(4) << "Number is a VOIP (Voice over IP) number.";
     return PhoneNumberUtil::VOIP;
   }
-  if (IsNumberMatchingDesc(national_number, metadata.personal_number())) {
+  if (matching_descs & (1 << NumberTypeClassifier::PERSONAL_NUMBER)) {
     VLOG(4) << "Number is a personal number.";
     return PhoneNumberUtil::PERSONAL_NUMBER;
   }
-  if (IsNumberMatchingDesc(national_number, metadata.pager())) {
+  if (matching_descs & (1 << NumberTypeClassifier::PAGER)) {
     VLOG(4) << "Number is a pager number.";
     return PhoneNumberUtil::PAGER;
   }
-  if (IsNumberMatchingDesc(national_number, metadata.uan())) {
+  if (matching_descs & (1 << NumberTypeClassifier::UAN)) {
     VLOG(4) << "Number is a UAN.";
     return PhoneNumberUtil::UAN;
   }
-  if (IsNumberMatchingDesc(national_number, metadata.voicemail())) {
+  if (matching_descs & (1 << NumberTypeClassifier::VOICEMAIL)) {
     VLOG(4) << "Number is a voicemail number.";
     return PhoneNumberUtil::VOICEMAIL;
   }
 
+  const bool is_mobile =
+      (matching_descs & (1 << NumberTypeClassifier::MOBILE)) != 0;
   bool is_fixed_line =
-      IsNumberMatchingDesc(national_number, metadata.fixed_line());
+      (matching_descs & (1 << NumberTypeClassifier::FIXED_LINE)) != 0;
   if (is_fixed_line) {
     if (metadata.same_mobile_and_fixed_line_pattern()) {
       VLOG(4) << "Fixed-line and mobile patterns equal, number is fixed-line"
               << " or mobile";
       return PhoneNumberUtil::FIXED_LINE_OR_MOBILE;
-    } else if (IsNumberMatchingDesc(national_number, metadata.mobile())) {
+    } else if (is_mobile) {
       VLOG(4) << "Fixed-line and mobile patterns differ, but number is "
               << "still fixed-line or mobile";
       return PhoneNumberUtil::FIXED_LINE_OR_MOBILE;
@@ -2147,8 +2464,7 @@ PhoneNumberUtil::PhoneNumberType PhoneNumberUtil::GetNumberTypeHelper(
   }
   // Otherwise, test to see if the number is mobile. Only do this if certain
   // that the patterns for mobile and fixed line aren't the same.
-  if (!metadata.same_mobile_and_fixed_line_pattern() &&
-      IsNumberMatchingDesc(national_number, metadata.mobile())) {
+  if (!metadata.same_mobile_and_fixed_line_pattern() && is_mobile) {
     VLOG(4) << "Number is a mobile number.";
     return PhoneNumberUtil::MOBILE;
   }
@@ -2163,9 +2479,20 @@ void PhoneNumberUtil::GetNationalSignificantNumber(
   DCHECK(national_number);
   // If leading zero(s) have been set, we prefix this now. Note this is not a
   // national prefix.
-  StrAppend(national_number, number.italian_leading_zero() ?
-      string(number.number_of_leading_zeros(), '0') : "");
-  StrAppend(national_number, number.national_number());
+  if (number.italian_leading_zero()) {
+    national_number->append(number.number_of_leading_zeros(), '0');
+  }
+  StrAppendDecimal(national_number, number.national_number());
+}
+
+void PhoneNumberUtil::GetNationalSignificantNumber(
+    const CompactPhoneNumber& number,
+    string* national_number) const {
+  DCHECK(national_number);
+  if (number.italian_leading_zero()) {
+    national_number->append(number.number_of_leading_zeros(), '0');
+  }
+  StrAppendDecimal(national_number, number.national_number());
 }
 
 int PhoneNumberUtil::GetLengthOfGeographicalAreaCode(
@@ -2248,12 +2575,9 @@ void PhoneNumberUtil::GetCountryMobileToken(int country_calling_code,
 
 void PhoneNumberUtil::NormalizeDigitsOnly(string* number) const {
   DCHECK(number);
-  const RegExp& non_digits_pattern = reg_exps_->regexp_cache_->GetRegExp(
-      StrCat("[^", kDigits, "]"));
-  // Delete everything that isn't valid digits.
-  non_digits_pattern.GlobalReplace(number, "");
-  // Normalize all decimal digits to ASCII digits.
-  number->assign(NormalizeUTF8::NormalizeDecimalDigits(*number));
+  // Delete everything that isn't valid digits, and normalize all decimal
+  // digits to ASCII digits.
+  StripNonDigitsAndNormalize(number);
 }
 
 void PhoneNumberUtil::NormalizeDiallableCharsOnly(string* number) const {
@@ -2293,7 +2617,13 @@ void PhoneNumberUtil::ConvertAlphaCharactersInNumber(string* number) const {
 //   - Spurious alpha characters are stripped.
 void PhoneNumberUtil::Normalize(string* number) const {
   DCHECK(number);
-  if (reg_exps_->valid_alpha_phone_pattern_->PartialMatch(*number)) {
+  // The pattern matches any string with three ASCII letters, and a few
+  // non-ASCII letters which are equal to ASCII ones when ignoring the case, so
+  // the regular expression is only needed for non-ASCII strings with fewer
+  // than three ASCII letters.
+  if (CountAsciiLetters(*number) >= 3 ||
+      (!IsAsciiString(*number) &&
+       reg_exps_->valid_alpha_phone_pattern_->PartialMatch(*number))) {
     NormalizeHelper(reg_exps_->alpha_phone_mappings_, true, number);
   }
   NormalizeDigitsOnly(number);
@@ -2356,10 +2686,9 @@ PhoneNumberUtil::MaybeStripInternationalPrefixAndNormalize(
   if (number->empty()) {
     return PhoneNumber::FROM_DEFAULT_COUNTRY;
   }
-  const scoped_ptr<RegExpInput> number_string_piece(
-      reg_exps_->regexp_factory_->CreateInput(*number));
-  if (reg_exps_->plus_chars_pattern_->Consume(number_string_piece.get())) {
-    number->assign(number_string_piece->ToString());
+  const size_t plus_chars_length = GetLeadingPlusCharsLength(*number);
+  if (plus_chars_length > 0) {
+    number->erase(0, plus_chars_length);
     // Can now normalize the rest of the number since we've consumed the "+"
     // sign at the start.
     Normalize(number);
@@ -2400,10 +2729,10 @@ bool PhoneNumberUtil::MaybeStripNationalPrefixAndCarrierCode(
       reg_exps_->regexp_factory_->CreateInput(*number));
   string number_string_copy(*number);
   string captured_part_of_prefix;
-  const RegExp& national_number_rule = reg_exps_->regexp_cache_->GetRegExp(
-      metadata.general_desc().national_number_pattern());
+  const PhoneNumberDesc& general_desc = metadata.general_desc();
   // Check if the original number is viable.
-  bool is_viable_original_number = national_number_rule.FullMatch(*number);
+  bool is_viable_original_number =
+      matcher_api_->MatchesNationalNumber(*number, general_desc, false);
   // Attempt to parse the first digits as a national prefix. We make a
   // copy so that we can revert to the original string if necessary.
   const string& transform_rule = metadata.national_prefix_transform_rule();
@@ -2422,7 +2751,8 @@ bool PhoneNumberUtil::MaybeStripNationalPrefixAndCarrierCode(
     possible_national_prefix_pattern.Replace(&number_string_copy,
                                              transform_rule);
     if (is_viable_original_number &&
-        !national_number_rule.FullMatch(number_string_copy)) {
+        !matcher_api_->MatchesNationalNumber(number_string_copy, general_desc,
+                                             false)) {
       return false;
     }
     number->assign(number_string_copy);
@@ -2440,7 +2770,8 @@ bool PhoneNumberUtil::MaybeStripNationalPrefixAndCarrierCode(
     const string number_copy_as_string =
         number_copy_without_transform->ToString();
     if (is_viable_original_number &&
-        !national_number_rule.FullMatch(number_copy_as_string)) {
+        !matcher_api_->MatchesNationalNumber(number_copy_as_string,
+                                             general_desc, false)) {
       return false;
     }
     number->assign(number_copy_as_string);
@@ -2587,9 +2918,6 @@ PhoneNumberUtil::ErrorType PhoneNumberUtil::MaybeExtractCountryCode(
                              &potential_national_number)) {
       const PhoneNumberDesc& general_num_desc =
           default_region_metadata->general_desc();
-      const RegExp& valid_number_pattern =
-          reg_exps_->regexp_cache_->GetRegExp(
-              general_num_desc.national_number_pattern());
       MaybeStripNationalPrefixAndCarrierCode(*default_region_metadata,
                                              &potential_national_number,
                                              NULL);
@@ -2601,8 +2929,10 @@ PhoneNumberUtil::ErrorType PhoneNumberUtil::MaybeExtractCountryCode(
       // If the number was not valid before but is valid now, or if it was too
       // long before, we consider the number with the country code stripped to
       // be a better result and keep that instead.
-      if ((!valid_number_pattern.FullMatch(*national_number) &&
-           valid_number_pattern.FullMatch(potential_national_number)) ||
+      if ((!matcher_api_->MatchesNationalNumber(*national_number,
+                                                general_num_desc, false) &&
+           matcher_api_->MatchesNationalNumber(potential_national_number,
+                                               general_num_desc, false)) ||
            TestNumberLengthAgainstPattern(possible_number_pattern,
                                           *national_number) == TOO_LONG) {
         national_number->assign(potential_national_number);
@@ -2621,40 +2951,29 @@ PhoneNumberUtil::ErrorType PhoneNumberUtil::MaybeExtractCountryCode(
 }
 
 PhoneNumberUtil::MatchType PhoneNumberUtil::IsNumberMatch(
-    const PhoneNumber& first_number_in,
-    const PhoneNumber& second_number_in) const {
-  // Make copies of the phone number so that the numbers passed in are not
-  // edited.
-  PhoneNumber first_number(first_number_in);
-  PhoneNumber second_number(second_number_in);
-  // First clear raw_input and country_code_source and
-  // preferred_domestic_carrier_code fields and any empty-string extensions so
-  // that we can use the proto-buffer equality method.
-  first_number.clear_raw_input();
-  first_number.clear_country_code_source();
-  first_number.clear_preferred_domestic_carrier_code();
-  second_number.clear_raw_input();
-  second_number.clear_country_code_source();
-  second_number.clear_preferred_domestic_carrier_code();
-  if (first_number.extension().empty()) {
-    first_number.clear_extension();
-  }
-  if (second_number.extension().empty()) {
-    second_number.clear_extension();
-  }
+    const PhoneNumber& first_number,
+    const PhoneNumber& second_number) const {
+  // The numbers are compared in place, ignoring their raw_input,
+  // country_code_source and preferred_domestic_carrier_code fields and their
+  // empty-string extensions.
+  const string& first_number_extension = first_number.extension();
+  const string& second_number_extension = second_number.extension();
   // Early exit if both had extensions and these are different.
-  if (first_number.has_extension() && second_number.has_extension() &&
-      first_number.extension() != second_number.extension()) {
+  if (!first_number_extension.empty() && !second_number_extension.empty() &&
+      first_number_extension != second_number_extension) {
     return NO_MATCH;
   }
   int first_number_country_code = first_number.country_code();
   int second_number_country_code = second_number.country_code();
   // Both had country calling code specified.
   if (first_number_country_code != 0 && second_number_country_code != 0) {
-    if (ExactlySameAs(first_number, second_number)) {
+    if (first_number_country_code == second_number_country_code &&
+        HasSameNationalNumberAs(first_number, second_number)) {
       return EXACT_MATCH;
     } else if (first_number_country_code == second_number_country_code &&
-               IsNationalNumberSuffixOfTheOther(first_number, second_number)) {
+               IsNationalNumberSuffixOfTheOther(
+                   first_number.national_number(),
+                   second_number.national_number())) {
       // A SHORT_NSN_MATCH occurs if there is a difference because of the
       // presence or absence of an 'Italian leading zero', the presence or
       // absence of an extension, or one NSN being a shorter variant of the
@@ -2664,15 +2983,50 @@ PhoneNumberUtil::MatchType PhoneNumberUtil::IsNumberMatch(
     // This is not a match.
     return NO_MATCH;
   }
-  // Checks cases where one or both country calling codes were not specified. To
-  // make equality checks easier, we first set the country_code fields to be
-  // equal.
-  first_number.set_country_code(second_number_country_code);
+  // Checks cases where one or both country calling codes were not specified.
+  // The numbers are compared as if the country_code field of the first one was
+  // set to the one of the second one, which then has to be set too.
   // If all else was the same, then this is an NSN_MATCH.
-  if (ExactlySameAs(first_number, second_number)) {
+  if (second_number.has_country_code() &&
+      HasSameNationalNumberAs(first_number, second_number)) {
     return NSN_MATCH;
   }
-  if (IsNationalNumberSuffixOfTheOther(first_number, second_number)) {
+  if (IsNationalNumberSuffixOfTheOther(first_number.national_number(),
+                                       second_number.national_number())) {
+    return SHORT_NSN_MATCH;
+  }
+  return NO_MATCH;
+}
+
+PhoneNumberUtil::MatchType PhoneNumberUtil::IsNumberMatch(
+    const CompactPhoneNumber& first_number,
+    const CompactPhoneNumber& second_number) const {
+  // Same as above on the compact fields, whose country calling code is always
+  // set. Like there, only the presence of the Italian leading zeros is
+  // compared, not their number.
+  if (first_number.has_extension() && second_number.has_extension() &&
+      !first_number.HasSameExtensionAs(second_number)) {
+    return NO_MATCH;
+  }
+  const bool same_national_number =
+      first_number.national_number() == second_number.national_number() &&
+      first_number.HasSameExtensionAs(second_number) &&
+      first_number.italian_leading_zero() ==
+          second_number.italian_leading_zero();
+  const int first_number_country_code = first_number.country_code();
+  const int second_number_country_code = second_number.country_code();
+  if (first_number_country_code != 0 && second_number_country_code != 0) {
+    if (first_number_country_code != second_number_country_code) {
+      return NO_MATCH;
+    }
+    if (same_national_number) {
+      return EXACT_MATCH;
+    }
+  } else if (same_national_number) {
+    return NSN_MATCH;
+  }
+  if (IsNationalNumberSuffixOfTheOther(first_number.national_number(),
+                                       second_number.national_number())) {
     return SHORT_NSN_MATCH;
   }
   return NO_MATCH;
@@ -2755,11 +3109,217 @@ PhoneNumberUtil::MatchType PhoneNumberUtil::IsNumberMatchWithOneString(
   return INVALID_NUMBER;
 }
 
+void PhoneNumberUtil::PrepareNumberForMatching(
+    const PhoneNumber& number,
+    PreparedPhoneNumber* prepared_number) const {
+  DCHECK(prepared_number);
+  prepared_number->text_.clear();
+  prepared_number->number_ = number;
+  prepared_number->parse_error_ = NO_PARSING_ERROR;
+  prepared_number->number_without_country_code_.Clear();
+  prepared_number->parse_without_country_code_error_ = NOT_A_NUMBER;
+  AutoLock l(prepared_number->lock_);
+  prepared_number->numbers_for_regions_.clear();
+}
+
+void PhoneNumberUtil::PrepareNumberForMatching(
+    const string& number,
+    PreparedPhoneNumber* prepared_number) const {
+  DCHECK(prepared_number);
+  prepared_number->text_ = number;
+  prepared_number->number_.Clear();
+  prepared_number->parse_error_ =
+      Parse(number, RegionCode::GetUnknown(), &prepared_number->number_);
+  prepared_number->number_without_country_code_.Clear();
+  prepared_number->parse_without_country_code_error_ = NOT_A_NUMBER;
+  if (prepared_number->parse_error_ == INVALID_COUNTRY_CODE_ERROR) {
+    prepared_number->parse_without_country_code_error_ =
+        ParseHelper(number, RegionCode::GetUnknown(), false, false,
+                    &prepared_number->number_without_country_code_);
+  }
+  AutoLock l(prepared_number->lock_);
+  prepared_number->numbers_for_regions_.clear();
+}
+
+PhoneNumberUtil::MatchType PhoneNumberUtil::IsNumberMatch(
+    const PreparedPhoneNumber& first_number,
+    const PreparedPhoneNumber& second_number) const {
+  // This follows IsNumberMatchWithTwoStrings(), a number prepared from a
+  // PhoneNumber being a string which was parsed successfully.
+  if (first_number.parse_error_ == NO_PARSING_ERROR) {
+    return IsNumberMatchWithPreparedNumber(first_number.number_,
+                                           second_number);
+  }
+  if (first_number.parse_error_ == INVALID_COUNTRY_CODE_ERROR) {
+    if (second_number.parse_error_ == NO_PARSING_ERROR) {
+      return IsNumberMatchWithPreparedNumber(second_number.number_,
+                                             first_number);
+    }
+    if (second_number.parse_error_ == INVALID_COUNTRY_CODE_ERROR &&
+        first_number.parse_without_country_code_error_ == NO_PARSING_ERROR &&
+        second_number.parse_without_country_code_error_ == NO_PARSING_ERROR) {
+      return IsNumberMatch(first_number.number_without_country_code_,
+                           second_number.number_without_country_code_);
+    }
+  }
+  // One or more of the phone numbers we are trying to match is not a viable
+  // phone number.
+  return INVALID_NUMBER;
+}
+
+PhoneNumberUtil::MatchType PhoneNumberUtil::IsNumberMatchWithPreparedNumber(
+    const PhoneNumber& first_number,
+    const PreparedPhoneNumber& second_number) const {
+  // This follows IsNumberMatchWithOneString().
+  if (second_number.parse_error_ == NO_PARSING_ERROR) {
+    return IsNumberMatch(first_number, second_number.number_);
+  }
+  if (second_number.parse_error_ == INVALID_COUNTRY_CODE_ERROR) {
+    string first_number_region;
+    GetRegionCodeForCountryCode(first_number.country_code(),
+                                &first_number_region);
+    if (first_number_region != RegionCode::GetUnknown()) {
+      const PhoneNumber* second_number_with_first_number_region;
+      {
+        AutoLock l(second_number.lock_);
+        map<string, PhoneNumber>::iterator it =
+            second_number.numbers_for_regions_.find(first_number_region);
+        if (it == second_number.numbers_for_regions_.end()) {
+          it = second_number.numbers_for_regions_.insert(
+              make_pair(first_number_region, PhoneNumber())).first;
+          Parse(second_number.text_, first_number_region, &it->second);
+        }
+        // The parsed numbers are never modified nor removed, except when the
+        // number is prepared again.
+        second_number_with_first_number_region = &it->second;
+      }
+      MatchType match = IsNumberMatch(first_number,
+                                      *second_number_with_first_number_region);
+      if (match == EXACT_MATCH) {
+        return NSN_MATCH;
+      }
+      return match;
+    } else if (second_number.parse_without_country_code_error_ ==
+               NO_PARSING_ERROR) {
+      return IsNumberMatch(first_number,
+                           second_number.number_without_country_code_);
+    }
+  }
+  // One or more of the phone numbers we are trying to match is not a viable
+  // phone number.
+  return INVALID_NUMBER;
+}
+
 AsYouTypeFormatter* PhoneNumberUtil::GetAsYouTypeFormatter(
     const string& region_code) const {
   return new AsYouTypeFormatter(region_code);
 }
 
+class PhoneNumberUtil::PatternPrecompiler : public SimpleThread::Delegate {
+ public:
+  // Compiles the patterns of the metadata at the indices first,
+  // first + stride, first + 2 * stride... of metadata_list. Interleaving the
+  // metadata spreads the large ones evenly across the threads.
+  PatternPrecompiler(const PhoneNumberUtil& util,
+                     const vector<const PhoneMetadata*>& metadata_list,
+                     size_t first, size_t stride)
+      : util_(util),
+        metadata_list_(metadata_list),
+        first_(first),
+        stride_(stride) {}
+
+  virtual void Run() {
+    for (size_t i = first_; i < metadata_list_.size(); i += stride_) {
+      util_.PrecompilePatternsForMetadata(*metadata_list_[i]);
+    }
+  }
+
+ private:
+  const PhoneNumberUtil& util_;
+  const vector<const PhoneMetadata*>& metadata_list_;
+  const size_t first_;
+  const size_t stride_;
+
+  DISALLOW_COPY_AND_ASSIGN(PatternPrecompiler);
+};
+
+void PhoneNumberUtil::PrecompilePatterns(
+    int num_threads, PatternPrecompilationStats* stats) const {
+  const int64 start_time = GetCurrentTimeMicroseconds();
+  const int64 start_heap_bytes = GetAllocatedHeapBytes();
+
+  vector<const PhoneMetadata*> metadata_list;
+  for (int i = 0; i < metadata_collection_->size(); ++i) {
+    if (metadata_collection_->id(i) == RegionCode::GetUnknown()) {
+      continue;
+    }
+    const PhoneMetadata* const metadata = metadata_collection_->Get(i);
+    if (metadata) {
+      metadata_list.push_back(metadata);
+    }
+  }
+
+  const size_t stride =
+      std::min(static_cast<size_t>(std::max(num_threads, 1)),
+               metadata_list.size());
+  if (stride <= 1) {
+    PatternPrecompiler(*this, metadata_list, 0, 1).Run();
+  } else {
+    vector<PatternPrecompiler*> precompilers;
+    vector<SimpleThread*> threads;
+    for (size_t i = 0; i < stride; ++i) {
+      precompilers.push_back(
+          new PatternPrecompiler(*this, metadata_list, i, stride));
+      threads.push_back(new SimpleThread(precompilers.back()));
+      threads.back()->Start();
+    }
+    for (size_t i = 0; i < stride; ++i) {
+      threads[i]->Join();
+    }
+    STLDeleteElements(&threads);
+    STLDeleteElements(&precompilers);
+  }
+
+  if (stats) {
+    stats->num_metadata = static_cast<int>(metadata_list.size());
+    stats->elapsed_microseconds = GetCurrentTimeMicroseconds() - start_time;
+    stats->allocated_bytes = start_heap_bytes < 0
+        ? -1
+        : GetAllocatedHeapBytes() - start_heap_bytes;
+  }
+}
+
+void PhoneNumberUtil::PrecompilePatternsForMetadata(
+    const PhoneMetadata& metadata) const {
+  // Matching the empty string compiles the patterns of the descriptions.
+  const string empty_number;
+  for (int desc_type = 0; desc_type < NumberTypeClassifier::NUM_DESC_TYPES;
+       ++desc_type) {
+    const PhoneNumberDesc& desc = NumberTypeClassifier::GetDesc(
+        metadata, static_cast<NumberTypeClassifier::DescType>(desc_type));
+    matcher_api_->MatchesPossibleNumber(empty_number, desc);
+    matcher_api_->MatchesNationalNumber(empty_number, desc, false);
+  }
+  matcher_api_->MatchesPossibleNumber(empty_number,
+                                      metadata.no_international_dialling());
+  matcher_api_->MatchesNationalNumber(
+      empty_number, metadata.no_international_dialling(), false);
+  number_type_classifier_->GetMatchingDescs(empty_number, metadata);
+
+  RegExpCache* const regexp_cache = reg_exps_->regexp_cache_.get();
+  regexp_cache->GetRegExp(StrCat(
+      "(", metadata.general_desc().possible_number_pattern(), ")"));
+  regexp_cache->GetRegExp(metadata.international_prefix());
+  if (metadata.has_national_prefix_for_parsing()) {
+    regexp_cache->GetRegExp(metadata.national_prefix_for_parsing());
+  }
+  if (metadata.has_leading_digits()) {
+    regexp_cache->GetRegExp(metadata.leading_digits());
+  }
+  PrecompileFormatPatterns(metadata.number_format(), regexp_cache);
+  PrecompileFormatPatterns(metadata.intl_number_format(), regexp_cache);
+}
+
 bool PhoneNumberUtil::IsShorterThanPossibleNormalNumber(
     const PhoneMetadata* country_metadata, const string& number) const {
   const RegExp& possible_number_pattern =
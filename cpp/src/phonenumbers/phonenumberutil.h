@@ -48,12 +48,23 @@ using std::vector;
 using google::protobuf::RepeatedPtrField;
 
 class AsYouTypeFormatter;
+class AsYouTypePatternStore;
+class CompactPhoneNumber;
+class DigitAutomaton;
+class LazyMetadataCollection;
 class Logger;
+class MatcherApi;
 class NumberFormat;
+class NumberFormatSelector;
+class NumberTypeClassifier;
 class PhoneMetadata;
 class PhoneNumberDesc;
 class PhoneNumberRegExpsAndMappings;
+class PreparedPhoneNumber;
 class RegExp;
+class RegionIndex;
+class TemplateFormatter;
+template <typename Key, typename Value> class ReadMostlyCache;
 
 // NOTE: A lot of methods in this class require Region Code strings. These must
 // be provided using ISO 3166-1 two-letter country-code format. The list of the
@@ -63,6 +74,8 @@ class RegExp;
 class PhoneNumberUtil : public Singleton<PhoneNumberUtil> {
  private:
   friend class AsYouTypeFormatter;
+  friend class AsYouTypePatternStore;
+  friend class DigitBlockSplitterTest;
   friend class PhoneNumberMatcher;
   friend class PhoneNumberMatcherRegExps;
   friend class PhoneNumberMatcherTest;
@@ -190,6 +203,8 @@ class PhoneNumberUtil : public Singleton<PhoneNumberUtil> {
   // significant number doesn't contain a national prefix or any formatting.
   void GetNationalSignificantNumber(const PhoneNumber& number,
                                     string* national_significant_num) const;
+  void GetNationalSignificantNumber(const CompactPhoneNumber& number,
+                                    string* national_significant_num) const;
 
   // Gets the length of the geographical area code from the PhoneNumber object
   // passed in, so that clients could use it to split a national significant
@@ -282,6 +297,22 @@ class PhoneNumberUtil : public Singleton<PhoneNumberUtil> {
               PhoneNumberFormat number_format,
               string* formatted_number) const;
 
+  // Same as Format(), but appends the formatted number to formatted_number
+  // instead of replacing its content. Once formatted_number has grown large
+  // enough, formatting numbers into it in any format doesn't allocate memory,
+  // unless their format can only be applied with regular expressions, such as
+  // the formats with carrier codes. This is meant for serializing many numbers
+  // into the same buffer, or into a buffer which is reused.
+  void AppendFormattedNumber(const PhoneNumber& number,
+                             PhoneNumberFormat number_format,
+                             string* formatted_number) const;
+
+  // Same as Format(const PhoneNumber&, ...), for a CompactPhoneNumber, which is
+  // converted to a PhoneNumber first.
+  void Format(const CompactPhoneNumber& number,
+              PhoneNumberFormat number_format,
+              string* formatted_number) const;
+
   // Formats a phone number in the specified format using client-defined
   // formatting rules.
   void FormatByPattern(
@@ -377,11 +408,13 @@ class PhoneNumberUtil : public Singleton<PhoneNumberUtil> {
 
   // Gets the type of a phone number.
   PhoneNumberType GetNumberType(const PhoneNumber& number) const;
+  PhoneNumberType GetNumberType(const CompactPhoneNumber& number) const;
 
   // Tests whether a phone number matches a valid pattern. Note this doesn't
   // verify the number is actually in use, which is impossible to tell by just
   // looking at a number itself.
   bool IsValidNumber(const PhoneNumber& number) const;
+  bool IsValidNumber(const CompactPhoneNumber& number) const;
 
   // Tests whether a phone number is valid for a certain region. Note this
   // doesn't verify the number is actually in use, which is impossible to tell
@@ -532,6 +565,23 @@ class PhoneNumberUtil : public Singleton<PhoneNumberUtil> {
                                  const string& default_region,
                                  PhoneNumber* number) const;
 
+  // Parses num_numbers strings at once, e.g. the numbers of an address book.
+  // The i-th string of numbers_to_parse is parsed as by Parse() with the i-th
+  // region of default_regions, and the result and the error returned by
+  // Parse() are stored in the i-th element of numbers and errors respectively.
+  // These arrays must have room for num_numbers elements.
+  void ParseBatch(const string* numbers_to_parse,
+                  const string* default_regions,
+                  size_t num_numbers,
+                  PhoneNumber* numbers,
+                  ErrorType* errors) const;
+  // Same as above, with the same default region for all the strings.
+  void ParseBatch(const string* numbers_to_parse,
+                  const string& default_region,
+                  size_t num_numbers,
+                  PhoneNumber* numbers,
+                  ErrorType* errors) const;
+
   // Takes two phone numbers and compares them for equality.
   //
   // Returns EXACT_MATCH if the country calling code, NSN, presence of a leading
@@ -547,6 +597,8 @@ class PhoneNumberUtil : public Singleton<PhoneNumberUtil> {
   // SHORT_NSN_MATCH. The numbers +1 345 657 1234 and 345 657 are a NO_MATCH.
   MatchType IsNumberMatch(const PhoneNumber& first_number,
                           const PhoneNumber& second_number) const;
+  MatchType IsNumberMatch(const CompactPhoneNumber& first_number,
+                          const CompactPhoneNumber& second_number) const;
 
   // Takes two phone numbers as strings and compares them for equality. This
   // is a convenience wrapper for IsNumberMatch(PhoneNumber firstNumber,
@@ -564,6 +616,21 @@ class PhoneNumberUtil : public Singleton<PhoneNumberUtil> {
   MatchType IsNumberMatchWithOneString(const PhoneNumber& first_number,
                                        const string& second_number) const;
 
+  // Prepares number to be compared with other prepared numbers by
+  // IsNumberMatch(const PreparedPhoneNumber&, const PreparedPhoneNumber&).
+  void PrepareNumberForMatching(const PhoneNumber& number,
+                                PreparedPhoneNumber* prepared_number) const;
+  // Same as above, for a number given as a string, which is parsed once.
+  void PrepareNumberForMatching(const string& number,
+                                PreparedPhoneNumber* prepared_number) const;
+
+  // Same as IsNumberMatch(), IsNumberMatchWithOneString() or
+  // IsNumberMatchWithTwoStrings(), depending on whether the numbers were
+  // prepared from PhoneNumber objects or strings, without parsing the strings
+  // again, except as explained in preparedphonenumber.h.
+  MatchType IsNumberMatch(const PreparedPhoneNumber& first_number,
+                          const PreparedPhoneNumber& second_number) const;
+
   // Overrides the default logging system. This takes ownership of the provided
   // logger.
   void SetLogger(Logger* logger);
@@ -575,6 +642,31 @@ class PhoneNumberUtil : public Singleton<PhoneNumberUtil> {
   // caller.
   AsYouTypeFormatter* GetAsYouTypeFormatter(const string& region_code) const;
 
+  // Statistics about the eager compilation of the patterns of the metadata.
+  struct PatternPrecompilationStats {
+    PatternPrecompilationStats()
+        : num_metadata(0), elapsed_microseconds(0), allocated_bytes(0) {}
+
+    // Number of regions and non-geographical entities whose patterns were
+    // compiled.
+    int num_metadata;
+    // Wall-clock time spent compiling the patterns.
+    int64 elapsed_microseconds;
+    // Growth of the heap while compiling the patterns, or -1 if it can't be
+    // measured on the platform. Allocations made concurrently by other threads
+    // of the process are counted as well.
+    int64 allocated_bytes;
+  };
+
+  // Compiles the patterns of the metadata of every region and non-geographical
+  // entity up front. By default, patterns are compiled the first time they are
+  // used, which makes the first requests for each region noticeably slower.
+  // This is meant to be called once, right after GetInstance(), e.g. when a
+  // server starts. The work is split across num_threads threads. stats can be
+  // NULL.
+  void PrecompilePatterns(int num_threads,
+                          PatternPrecompilationStats* stats) const;
+
   friend bool ConvertFromTelephoneNumberProto(
       const TelephoneNumber& proto_to_convert,
       PhoneNumber* new_proto);
@@ -596,10 +688,29 @@ class PhoneNumberUtil : public Singleton<PhoneNumberUtil> {
   PhoneNumberUtil::PhoneNumberType GetNumberTypeHelper(
       const string& national_number, const PhoneMetadata& metadata) const;
 
+  // Same as GetNumberType(), IsValidNumberForRegion() and
+  // GetRegionCodeForNumber(), for the number with the given country calling
+  // code and national significant number.
+  PhoneNumberType GetNumberTypeOfNationalNumber(
+      int country_calling_code, const string& national_number) const;
+
+  bool IsValidNationalNumberForRegion(int country_code,
+                                      const string& national_number,
+                                      const string& region_code) const;
+
+  void GetRegionCodeForNationalNumber(int country_calling_code,
+                                      const string& national_number,
+                                      string* region_code) const;
+
+  // Compiles all the patterns of the metadata which are used by this class.
+  void PrecompilePatternsForMetadata(const PhoneMetadata& metadata) const;
+
  private:
-  scoped_ptr<Logger> logger_;
+  // Compiles the patterns of a subset of the metadata, see
+  // PrecompilePatterns().
+  class PatternPrecompiler;
 
-  typedef pair<int, list<string>*> IntRegionsPair;
+  scoped_ptr<Logger> logger_;
 
   // The minimum and maximum length of the national significant number.
   static const size_t kMinLengthForNsn = 2;
@@ -631,27 +742,45 @@ class PhoneNumberUtil : public Singleton<PhoneNumberUtil> {
   // Helper class holding useful regular expressions and character mappings.
   scoped_ptr<PhoneNumberRegExpsAndMappings> reg_exps_;
 
-  // A mapping from a country calling code to a RegionCode object which denotes
-  // the region represented by that country calling code. Note regions under
-  // NANPA share the country calling code 1 and Russia and Kazakhstan share the
-  // country calling code 7. Under this map, 1 is mapped to region code "US" and
-  // 7 is mapped to region code "RU". This is implemented as a sorted vector to
-  // achieve better performance.
-  scoped_ptr<vector<IntRegionsPair> > country_calling_code_to_region_code_map_;
+  // Matcher used to test national numbers against the patterns of the
+  // PhoneNumberDesc messages of the metadata.
+  scoped_ptr<const MatcherApi> matcher_api_;
+
+  // Matches national numbers against all the descriptions of a region at once,
+  // to determine their type. Falls back to matcher_api_.
+  scoped_ptr<const NumberTypeClassifier> number_type_classifier_;
+
+  // Chooses the formats of the national numbers among the formats of the
+  // metadata without regular expressions.
+  scoped_ptr<const NumberFormatSelector> number_format_selector_;
+
+  // Formats the national numbers with the formats of the metadata without
+  // regular expressions.
+  scoped_ptr<const TemplateFormatter> template_formatter_;
+
+  // The automata compiled from the national prefixes for parsing, used by
+  // MaybeParseE164Number(). The patterns which can't be compiled are mapped to
+  // NULL.
+  scoped_ptr<ReadMostlyCache<const PhoneMetadata*, DigitAutomaton> >
+      national_prefix_for_parsing_automata_;
+
+  // The patterns compiled from the metadata by the AsYouTypeFormatter
+  // instances, shared by all of them.
+  scoped_ptr<const AsYouTypePatternStore> as_you_type_pattern_store_;
 
-  // The set of regions that share country calling code 1.
-  scoped_ptr<set<string> > nanpa_regions_;
   static const int kNanpaCountryCode = 1;
 
-  // A mapping from a region code to a PhoneMetadata for that region.
-  scoped_ptr<map<string, PhoneMetadata> > region_to_metadata_map_;
+  // The compiled-in metadata, whose entries are only parsed when first used.
+  scoped_ptr<LazyMetadataCollection> metadata_collection_;
 
-  // A mapping from a country calling code for a non-geographical entity to the
-  // PhoneMetadata for that country calling code. Examples of the country
-  // calling codes include 800 (International Toll Free Service) and 808
-  // (International Shared Cost Service).
-  scoped_ptr<map<int, PhoneMetadata> >
-      country_code_to_non_geographical_metadata_map_;
+  // Maps the region codes and the country calling codes of the
+  // non-geographical entities, such as 800 (International Toll Free Service),
+  // to the index of their metadata in metadata_collection_. Also maps each
+  // country calling code to the regions using it, the main region first. Note
+  // regions under NANPA share the country calling code 1 and Russia and
+  // Kazakhstan share the country calling code 7. In this case, 1 is mapped to
+  // region code "US" first and 7 is mapped to region code "RU" first.
+  scoped_ptr<RegionIndex> region_index_;
 
   PhoneNumberUtil();
 
@@ -706,10 +835,19 @@ class PhoneNumberUtil : public Singleton<PhoneNumberUtil> {
   // has already been checked.
   int GetCountryCodeForValidRegion(const string& region_code) const;
 
+  // Returns the first of available_formats which can format national_number,
+  // or NULL if there is none. The formats must be the ones of the metadata,
+  // since the automata selecting them are cached.
   const NumberFormat* ChooseFormattingPatternForNumber(
       const RepeatedPtrField<NumberFormat>& available_formats,
       const string& national_number) const;
 
+  // Same as ChooseFormattingPatternForNumber(), for any formats, using regular
+  // expressions.
+  const NumberFormat* ChooseFormattingPatternUsingRegExps(
+      const RepeatedPtrField<NumberFormat>& available_formats,
+      const string& national_number) const;
+
   void FormatNsnUsingPatternWithCarrier(
       const string& national_number,
       const NumberFormat& formatting_pattern,
@@ -737,6 +875,11 @@ class PhoneNumberUtil : public Singleton<PhoneNumberUtil> {
 
   bool HasFormattingPatternForNumber(const PhoneNumber& number) const;
 
+  // Same as IsNumberMatchWithOneString(), for a prepared second number.
+  MatchType IsNumberMatchWithPreparedNumber(
+      const PhoneNumber& first_number,
+      const PreparedPhoneNumber& second_number) const;
+
   // Simple wrapper of FormatNsnWithCarrier for the common case of
   // no carrier code.
   void FormatNsn(const string& number,
@@ -750,6 +893,14 @@ class PhoneNumberUtil : public Singleton<PhoneNumberUtil> {
                             const string& carrier_code,
                             string* formatted_number) const;
 
+  // Same as FormatNsnWithCarrier(), but appends the formatted number to
+  // formatted_number instead of replacing its content.
+  void AppendFormattedNsn(const string& number,
+                          const PhoneMetadata& metadata,
+                          PhoneNumberFormat number_format,
+                          const string& carrier_code,
+                          string* formatted_number) const;
+
   void MaybeAppendFormattedExtension(
       const PhoneNumber& number,
       const PhoneMetadata& metadata,
@@ -757,8 +908,9 @@ class PhoneNumberUtil : public Singleton<PhoneNumberUtil> {
       string* extension) const;
 
   void GetRegionCodeForNumberFromRegionList(
-      const PhoneNumber& number,
-      const list<string>& region_codes,
+      const string& national_number,
+      const string* region_codes,
+      size_t num_region_codes,
       string* region_code) const;
 
   // Strips the IDD from the start of the number if present. Helper function
@@ -800,6 +952,29 @@ class PhoneNumberUtil : public Singleton<PhoneNumberUtil> {
                         bool check_region,
                         PhoneNumber* phone_number) const;
 
+  // Fast path of Parse() for numbers made of a plus sign followed by ASCII
+  // digits, which doesn't use any regular expression nor allocate any memory.
+  // Returns false, leaving phone_number unmodified, if the number needs any
+  // processing other than extracting the country calling code, in which case
+  // it must be parsed by ParseHelper().
+  bool MaybeParseE164Number(const string& number_to_parse,
+                            const string& default_region,
+                            PhoneNumber* phone_number) const;
+
+  // Implementation of ParseBatch(), where the default region of the i-th
+  // number is default_regions[i * default_regions_stride].
+  void ParseBatchHelper(const string* numbers_to_parse,
+                        const string* default_regions,
+                        size_t default_regions_stride,
+                        size_t num_numbers,
+                        PhoneNumber* numbers,
+                        ErrorType* errors) const;
+
+  // Returns the automaton compiled from the national prefix for parsing of the
+  // metadata, or NULL if it can't be compiled.
+  const DigitAutomaton* GetNationalPrefixForParsingAutomaton(
+      const PhoneMetadata& metadata) const;
+
   void BuildNationalNumberForParsing(const string& number_to_parse,
                                      string* national_number) const;
 
@@ -0,0 +1,32 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/preparedphonenumber.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+PreparedPhoneNumber::PreparedPhoneNumber()
+    : text_(),
+      number_(),
+      parse_error_(PhoneNumberUtil::NOT_A_NUMBER),
+      number_without_country_code_(),
+      parse_without_country_code_error_(PhoneNumberUtil::NOT_A_NUMBER),
+      lock_(),
+      numbers_for_regions_() {}
+
+PreparedPhoneNumber::~PreparedPhoneNumber() {}
+
+}  // namespace phonenumbers
+}  // namespace i18n
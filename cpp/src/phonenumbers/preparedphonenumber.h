@@ -0,0 +1,74 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// A phone number prepared once by PhoneNumberUtil::PrepareNumberForMatching(),
+// from a PhoneNumber or from a string, to be compared with many other prepared
+// numbers by PhoneNumberUtil::IsNumberMatch(). A string is parsed when it is
+// prepared, the way IsNumberMatchWithTwoStrings() parses it, instead of every
+// time it is compared.
+//
+// A string without country calling code still has to be parsed again with the
+// region of the country calling code of the numbers it is compared with. These
+// parsings are cached in the prepared number, which is thread-safe.
+
+#ifndef I18N_PHONENUMBERS_PREPAREDPHONENUMBER_H_
+#define I18N_PHONENUMBERS_PREPAREDPHONENUMBER_H_
+
+#include <map>
+#include <string>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/base/synchronization/lock.h"
+#include "phonenumbers/phonenumber.pb.h"
+#include "phonenumbers/phonenumberutil.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::map;
+using std::string;
+
+class PreparedPhoneNumber {
+ public:
+  // Creates a number which doesn't match any number until it is prepared.
+  PreparedPhoneNumber();
+  ~PreparedPhoneNumber();
+
+ private:
+  friend class PhoneNumberUtil;
+
+  // The text of the number if it was prepared from a string.
+  string text_;
+  // The number if it was prepared from a PhoneNumber, or its text parsed
+  // without default region.
+  PhoneNumber number_;
+  PhoneNumberUtil::ErrorType parse_error_;
+  // If parse_error_ is INVALID_COUNTRY_CODE_ERROR, the text parsed without
+  // country calling code.
+  PhoneNumber number_without_country_code_;
+  PhoneNumberUtil::ErrorType parse_without_country_code_error_;
+
+  // Guards numbers_for_regions_.
+  mutable Lock lock_;
+  // The text parsed with the regions it was compared with, if parse_error_ is
+  // INVALID_COUNTRY_CODE_ERROR.
+  mutable map<string, PhoneNumber> numbers_for_regions_;
+
+  DISALLOW_COPY_AND_ASSIGN(PreparedPhoneNumber);
+};
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_PREPAREDPHONENUMBER_H_
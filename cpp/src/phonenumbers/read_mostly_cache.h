@@ -0,0 +1,205 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// ReadMostlyCache is a hash table mapping keys to immutable values, designed
+// for caches which are filled once and then read by many threads: looking up a
+// key never takes a lock, only insertions do.
+//
+// Entries are never removed nor modified once inserted. The table is an open
+// addressing hash table whose slots are published with release stores and read
+// with acquire loads. When it grows, the entries are copied to a new table
+// which replaces the old one, and the old table is kept alive until the cache
+// is destroyed since readers may still be probing it. A reader which misses an
+// entry in an outdated table simply retries under the lock.
+//
+// The cache owns its values, which are deleted when it is destroyed. NULL
+// values are allowed, e.g. to cache the failure to compute a value.
+//
+// ReadMostlyCache<string, RegExp> cache(128);
+// const RegExp* regexp;
+// if (!cache.Find(pattern, &regexp)) {
+//   regexp = cache.Insert(pattern, factory.CreateRegExp(pattern));
+// }
+
+#ifndef I18N_PHONENUMBERS_READ_MOSTLY_CACHE_H_
+#define I18N_PHONENUMBERS_READ_MOSTLY_CACHE_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/base/synchronization/atomicops.h"
+#include "phonenumbers/base/synchronization/lock.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+using std::vector;
+
+// Hash functions of the supported key types.
+inline size_t HashCacheKey(const string& key) {
+  // 32-bit FNV-1a.
+  uint32 hash = 2166136261U;
+  for (string::const_iterator it = key.begin(); it != key.end(); ++it) {
+    hash = (hash ^ static_cast<unsigned char>(*it)) * 16777619U;
+  }
+  return hash;
+}
+
+inline size_t HashCacheKey(const void* key) {
+  const size_t hash = reinterpret_cast<size_t>(key);
+  // The lowest bits of pointers are mostly zeros because of the alignment.
+  return hash ^ (hash >> 4) ^ (hash >> 12);
+}
+
+template <typename Key, typename Value>
+class ReadMostlyCache {
+ public:
+  // min_items is the number of entries the cache can hold before growing.
+  explicit ReadMostlyCache(size_t min_items)
+      : lock_(),
+        table_(NULL),
+        size_(0) {
+    size_t capacity = 16;
+    while (capacity < 2 * min_items) {
+      capacity *= 2;
+    }
+    table_ = new Table(capacity);
+    tables_.push_back(table_);
+  }
+
+  ~ReadMostlyCache() {
+    AutoLock l(lock_);
+    for (size_t i = 0; i <= table_->mask; ++i) {
+      const Entry* const entry = table_->slots[i];
+      if (entry) {
+        delete entry->value;
+        delete entry;
+      }
+    }
+    for (typename vector<Table*>::const_iterator it = tables_.begin();
+         it != tables_.end(); ++it) {
+      delete *it;
+    }
+  }
+
+  // Looks up key without taking any lock. Returns true and sets value if key
+  // is in the cache.
+  bool Find(const Key& key, const Value** value) const {
+    const Entry* const entry = FindEntry(*Acquire_Load(&table_), key);
+    if (!entry) {
+      return false;
+    }
+    *value = entry->value;
+    return true;
+  }
+
+  // Inserts value for key, taking ownership of it, and returns the value
+  // cached for key. If another thread inserted a value for key in the meantime,
+  // that value is returned and the provided one is deleted.
+  const Value* Insert(const Key& key, const Value* value) {
+    AutoLock l(lock_);
+    const Entry* const existing_entry = FindEntry(*table_, key);
+    if (existing_entry) {
+      delete value;
+      return existing_entry->value;
+    }
+    if (2 * (size_ + 1) > table_->mask + 1) {
+      Grow();
+    }
+    AddEntry(table_, new Entry(key, value));
+    ++size_;
+    return value;
+  }
+
+  // Returns the number of entries in the cache.
+  size_t size() const {
+    AutoLock l(lock_);
+    return size_;
+  }
+
+ private:
+  struct Entry {
+    Entry(const Key& k, const Value* v) : key(k), value(v) {}
+
+    const Key key;
+    const Value* const value;
+  };
+
+  struct Table {
+    explicit Table(size_t capacity)
+        : mask(capacity - 1),
+          slots(new const Entry*[capacity]()) {}
+
+    ~Table() {
+      delete[] slots;
+    }
+
+    const size_t mask;
+    const Entry** const slots;
+  };
+
+  static const Entry* FindEntry(const Table& table, const Key& key) {
+    // The table is never full, so the probing ends on an empty slot.
+    size_t i = HashCacheKey(key) & table.mask;
+    while (true) {
+      const Entry* const entry = Acquire_Load(&table.slots[i]);
+      if (!entry) {
+        return NULL;
+      }
+      if (entry->key == key) {
+        return entry;
+      }
+      i = (i + 1) & table.mask;
+    }
+  }
+
+  // Must be called with lock_ held.
+  static void AddEntry(Table* table, const Entry* entry) {
+    size_t i = HashCacheKey(entry->key) & table->mask;
+    while (table->slots[i]) {
+      i = (i + 1) & table->mask;
+    }
+    Release_Store(&table->slots[i], entry);
+  }
+
+  // Replaces the table by a table twice as large. Must be called with lock_
+  // held.
+  void Grow() {
+    Table* const table = new Table(2 * (table_->mask + 1));
+    for (size_t i = 0; i <= table_->mask; ++i) {
+      if (table_->slots[i]) {
+        AddEntry(table, table_->slots[i]);
+      }
+    }
+    tables_.push_back(table);
+    Release_Store(&table_, table);
+  }
+
+  mutable Lock lock_;  // serializes the writers
+  // The current table, read without lock_ held.
+  Table* table_;
+  // All the tables ever allocated, including the current one.
+  vector<Table*> tables_;  // protected by lock_
+  size_t size_;  // protected by lock_
+
+  DISALLOW_COPY_AND_ASSIGN(ReadMostlyCache);
+};
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_READ_MOSTLY_CACHE_H_
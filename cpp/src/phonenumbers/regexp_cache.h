@@ -14,12 +14,14 @@
 
 // Author: Fredrik Roubert
 
-// RegExpCache is a simple wrapper around hash_map<> to store RegExp objects.
+// RegExpCache is a simple wrapper around ReadMostlyCache<> to store RegExp
+// objects.
 //
 // To get a cached RegExp object for a regexp pattern string, call the
 // GetRegExp() method of the class RegExpCache providing the pattern string. If
 // a RegExp object corresponding to the pattern string doesn't already exist, it
-// will be created by the GetRegExp() method.
+// will be created by the GetRegExp() method. Getting a RegExp object which is
+// already cached doesn't take any lock.
 //
 // RegExpCache cache;
 // const RegExp& regexp = cache.GetRegExp("\d");
@@ -32,13 +34,7 @@
 
 #include "phonenumbers/base/basictypes.h"
 #include "phonenumbers/base/memory/scoped_ptr.h"
-#include "phonenumbers/base/synchronization/lock.h"
-
-#ifdef I18N_PHONENUMBERS_USE_TR1_UNORDERED_MAP
-#  include <tr1/unordered_map>
-#else
-#  include <map>
-#endif
+#include "phonenumbers/read_mostly_cache.h"
 
 namespace i18n {
 namespace phonenumbers {
@@ -50,11 +46,7 @@ class RegExp;
 
 class RegExpCache {
  private:
-#ifdef I18N_PHONENUMBERS_USE_TR1_UNORDERED_MAP
-  typedef std::tr1::unordered_map<string, const RegExp*> CacheImpl;
-#else
-  typedef std::map<string, const RegExp*> CacheImpl;
-#endif
+  typedef ReadMostlyCache<string, RegExp> CacheImpl;
 
  public:
   explicit RegExpCache(const AbstractRegExpFactory& regexp_factory,
@@ -65,8 +57,7 @@ class RegExpCache {
 
  private:
   const AbstractRegExpFactory& regexp_factory_;
-  Lock lock_;  // protects cache_impl_
-  scoped_ptr<CacheImpl> cache_impl_;  // protected by lock_
+  scoped_ptr<CacheImpl> cache_impl_;
   friend class RegExpCacheTest_CacheConstructor_Test;
   DISALLOW_COPY_AND_ASSIGN(RegExpCache);
 };
@@ -0,0 +1,69 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/region_index.h"
+
+#include "phonenumbers/base/logging.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+RegionIndex::RegionIndex()
+    : region_metadata_(kNumRegionKeys, -1),
+      country_calling_codes_(kMaxCountryCallingCode + 1),
+      region_codes_() {}
+
+void RegionIndex::AddRegion(const string& region_code, int metadata_index) {
+  DCHECK(IsIndexableRegionCode(region_code));
+  int& region_metadata = region_metadata_[RegionKey(region_code)];
+  if (region_metadata < 0) {
+    region_metadata = metadata_index;
+  }
+}
+
+void RegionIndex::AddNonGeographicalEntity(int country_calling_code,
+                                           int metadata_index) {
+  DCHECK(IsValidCountryCallingCode(country_calling_code));
+  int& non_geographical_metadata =
+      country_calling_codes_[country_calling_code].non_geographical_metadata;
+  if (non_geographical_metadata < 0) {
+    non_geographical_metadata = metadata_index;
+  }
+}
+
+void RegionIndex::SetRegionsForCountryCallingCode(
+    int country_calling_code, const list<string>& region_codes) {
+  DCHECK(IsValidCountryCallingCode(country_calling_code));
+  CountryCallingCodeEntry& entry = country_calling_codes_[country_calling_code];
+  DCHECK_EQ(0, entry.num_region_codes);
+  entry.first_region = static_cast<uint16>(region_codes_.size());
+  entry.num_region_codes = static_cast<uint16>(region_codes.size());
+  region_codes_.insert(region_codes_.end(), region_codes.begin(),
+                       region_codes.end());
+}
+
+void RegionIndex::GetRegions(set<string>* regions) const {
+  DCHECK(regions);
+  string region_code(2, 'A');
+  for (int key = 0; key < kNumRegionKeys; ++key) {
+    if (region_metadata_[key] >= 0) {
+      region_code[0] = static_cast<char>('A' + key / 26);
+      region_code[1] = static_cast<char>('A' + key % 26);
+      regions->insert(regions->end(), region_code);
+    }
+  }
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
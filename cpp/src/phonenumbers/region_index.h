@@ -0,0 +1,149 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// RegionIndex maps region codes and country calling codes to the metadata
+// they refer to, with constant-time lookups which don't compare any string.
+//
+// Region codes, which are made of two upper-case ASCII letters, are packed
+// into a 2-byte key indexing a table of 26 * 26 entries. Country calling codes
+// directly index a table of 1000 entries, each of them referring to a slice of
+// a single array holding the region codes of all the calling codes.
+//
+// The index is filled once, when the metadata is loaded, and is read-only
+// afterwards.
+
+#ifndef I18N_PHONENUMBERS_REGION_INDEX_H_
+#define I18N_PHONENUMBERS_REGION_INDEX_H_
+
+#include <list>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "phonenumbers/base/basictypes.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::list;
+using std::set;
+using std::string;
+using std::vector;
+
+class RegionIndex {
+ public:
+  // Country calling codes have at most three digits.
+  static const int kMaxCountryCallingCode = 999;
+
+  RegionIndex();
+
+  // Returns true if region_code is made of two upper-case ASCII letters, which
+  // is the case of all the region codes that can be added to the index.
+  static bool IsIndexableRegionCode(const string& region_code) {
+    return region_code.length() == 2 && IsUpperCaseLetter(region_code[0]) &&
+        IsUpperCaseLetter(region_code[1]);
+  }
+
+  // Associates the region with the metadata at metadata_index, unless the
+  // region is already in the index. region_code must be indexable.
+  void AddRegion(const string& region_code, int metadata_index);
+
+  // Returns the index of the metadata of the region, or -1 if the region is not
+  // in the index.
+  int FindRegion(const string& region_code) const {
+    return IsIndexableRegionCode(region_code)
+        ? region_metadata_[RegionKey(region_code)]
+        : -1;
+  }
+
+  // Associates the non-geographical entity using country_calling_code with the
+  // metadata at metadata_index, unless it is already in the index.
+  void AddNonGeographicalEntity(int country_calling_code, int metadata_index);
+
+  // Returns the index of the metadata of the non-geographical entity using
+  // country_calling_code, or -1 if there is none.
+  int FindNonGeographicalEntity(int country_calling_code) const {
+    return IsValidCountryCallingCode(country_calling_code)
+        ? country_calling_codes_[country_calling_code]
+              .non_geographical_metadata
+        : -1;
+  }
+
+  // Sets the region codes which use country_calling_code, the main region
+  // first. This can only be called once per country calling code.
+  void SetRegionsForCountryCallingCode(int country_calling_code,
+                                       const list<string>& region_codes);
+
+  // Returns the region codes which use country_calling_code, and sets
+  // num_region_codes to their number, which is 0 if the country calling code
+  // is not in the index.
+  const string* GetRegionsForCountryCallingCode(
+      int country_calling_code, size_t* num_region_codes) const {
+    if (!IsValidCountryCallingCode(country_calling_code)) {
+      *num_region_codes = 0;
+      return NULL;
+    }
+    const CountryCallingCodeEntry& entry =
+        country_calling_codes_[country_calling_code];
+    *num_region_codes = entry.num_region_codes;
+    return region_codes_.empty() ? NULL : &region_codes_[entry.first_region];
+  }
+
+  // Adds all the regions of the index to regions.
+  void GetRegions(set<string>* regions) const;
+
+ private:
+  // Number of entries of the region table.
+  static const int kNumRegionKeys = 26 * 26;
+
+  struct CountryCallingCodeEntry {
+    CountryCallingCodeEntry()
+        : first_region(0),
+          num_region_codes(0),
+          non_geographical_metadata(-1) {}
+
+    // The slice of region_codes_ holding the regions of the calling code.
+    uint16 first_region;
+    uint16 num_region_codes;
+    int non_geographical_metadata;
+  };
+
+  static bool IsUpperCaseLetter(char c) {
+    return c >= 'A' && c <= 'Z';
+  }
+
+  static bool IsValidCountryCallingCode(int country_calling_code) {
+    return country_calling_code >= 0 &&
+        country_calling_code <= kMaxCountryCallingCode;
+  }
+
+  // The key of an indexable region code.
+  static int RegionKey(const string& region_code) {
+    return (region_code[0] - 'A') * 26 + (region_code[1] - 'A');
+  }
+
+  // The metadata indices of the regions, indexed by RegionKey().
+  vector<int> region_metadata_;
+  // Indexed by country calling code.
+  vector<CountryCallingCodeEntry> country_calling_codes_;
+  // The region codes of all the country calling codes.
+  vector<string> region_codes_;
+
+  DISALLOW_COPY_AND_ASSIGN(RegionIndex);
+};
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_REGION_INDEX_H_
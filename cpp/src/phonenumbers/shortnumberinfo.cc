@@ -20,12 +20,14 @@
 #include <iterator>
 #include <map>
 
+#include "phonenumbers/base/logging.h"
 #include "phonenumbers/base/memory/scoped_ptr.h"
 #include "phonenumbers/default_logger.h"
+#include "phonenumbers/dfa_based_matcher.h"
+#include "phonenumbers/lazy_metadata_collection.h"
 #include "phonenumbers/matcher_api.h"
 #include "phonenumbers/phonemetadata.pb.h"
 #include "phonenumbers/phonenumberutil.h"
-#include "phonenumbers/regex_based_matcher.h"
 #include "phonenumbers/region_code.h"
 #include "phonenumbers/short_metadata.h"
 
@@ -36,8 +38,8 @@ using std::make_pair;
 using std::map;
 using std::string;
 
-bool LoadCompiledInMetadata(PhoneMetadataCollection* metadata) {
-  if (!metadata->ParseFromArray(short_metadata_get(), short_metadata_size())) {
+bool LoadCompiledInMetadata(LazyMetadataCollection* metadata) {
+  if (!metadata->Init(short_metadata_get(), short_metadata_size())) {
     LOG(ERROR) << "Could not parse binary data.";
     return false;
   }
@@ -46,20 +48,31 @@ bool LoadCompiledInMetadata(PhoneMetadataCollection* metadata) {
 
 ShortNumberInfo::ShortNumberInfo()
     : phone_util_(*PhoneNumberUtil::GetInstance()),
-      matcher_api_(new RegexBasedMatcher()),
-      region_to_short_metadata_map_(new map<string, PhoneMetadata>()),
+      matcher_api_(new DfaBasedMatcher()),
+      metadata_collection_(new LazyMetadataCollection()),
+      region_to_short_metadata_map_(new map<string, int>()),
       regions_where_emergency_numbers_must_be_exact_(new set<string>()) {
-  PhoneMetadataCollection metadata_collection;
-  if (!LoadCompiledInMetadata(&metadata_collection)) {
+  Init();
+}
+
+ShortNumberInfo::ShortNumberInfo(const MatcherApi* matcher_api)
+    : phone_util_(*PhoneNumberUtil::GetInstance()),
+      matcher_api_(matcher_api),
+      metadata_collection_(new LazyMetadataCollection()),
+      region_to_short_metadata_map_(new map<string, int>()),
+      regions_where_emergency_numbers_must_be_exact_(new set<string>()) {
+  DCHECK(matcher_api);
+  Init();
+}
+
+void ShortNumberInfo::Init() {
+  if (!LoadCompiledInMetadata(metadata_collection_.get())) {
     LOG(DFATAL) << "Could not parse compiled-in metadata.";
     return;
   }
-  for (RepeatedPtrField<PhoneMetadata>::const_iterator it =
-           metadata_collection.metadata().begin();
-       it != metadata_collection.metadata().end();
-       ++it) {
-    const string& region_code = it->id();
-    region_to_short_metadata_map_->insert(make_pair(region_code, *it));
+  for (int i = 0; i < metadata_collection_->size(); ++i) {
+    const string& region_code = metadata_collection_->id(i);
+    region_to_short_metadata_map_->insert(make_pair(region_code, i));
   }
   regions_where_emergency_numbers_must_be_exact_->insert("BR");
   regions_where_emergency_numbers_must_be_exact_->insert("CL");
@@ -72,10 +85,10 @@ ShortNumberInfo::~ShortNumberInfo() {}
 // if the region code is invalid or unknown.
 const PhoneMetadata* ShortNumberInfo::GetMetadataForRegion(
     const string& region_code) const {
-  map<string, PhoneMetadata>::const_iterator it =
+  map<string, int>::const_iterator it =
       region_to_short_metadata_map_->find(region_code);
   if (it != region_to_short_metadata_map_->end()) {
-    return &it->second;
+    return metadata_collection_->Get(it->second);
   }
   return NULL;
 }
@@ -35,6 +35,7 @@ using std::map;
 using std::set;
 using std::string;
 
+class LazyMetadataCollection;
 class MatcherApi;
 class PhoneMetadata;
 class PhoneNumber;
@@ -42,7 +43,11 @@ class PhoneNumberUtil;
 
 class ShortNumberInfo {
  public:
+  // Creates an instance matching numbers with a DfaBasedMatcher.
   ShortNumberInfo();
+  // Creates an instance matching numbers with the provided matcher. This takes
+  // ownership of the matcher.
+  explicit ShortNumberInfo(const MatcherApi* matcher_api);
   ~ShortNumberInfo();
 
   // Cost categories of short numbers.
@@ -204,15 +209,22 @@ class ShortNumberInfo {
   const PhoneNumberUtil& phone_util_;
   const scoped_ptr<const MatcherApi> matcher_api_;
 
-  // A mapping from a RegionCode to the PhoneMetadata for that region.
-  scoped_ptr<map<string, PhoneMetadata> >
-      region_to_short_metadata_map_;
+  // The compiled-in short number metadata, whose entries are only parsed when
+  // first used.
+  scoped_ptr<LazyMetadataCollection> metadata_collection_;
+
+  // A mapping from a RegionCode to the index in metadata_collection_ of the
+  // PhoneMetadata for that region.
+  scoped_ptr<map<string, int> > region_to_short_metadata_map_;
 
   // In these countries, if extra digits are added to an emergency number, it no
   // longer connects to the emergency service.
   scoped_ptr<set<string> >
       regions_where_emergency_numbers_must_be_exact_;
 
+  // Loads the compiled-in short number metadata. Used by the constructors.
+  void Init();
+
   const i18n::phonenumbers::PhoneMetadata* GetMetadataForRegion(
       const string& region_code) const;
 
@@ -0,0 +1,54 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Defines I18N_PHONENUMBERS_USE_SSE2 when the target supports SSE2, in which
+// case the scans of the text may process 16 bytes at a time.
+
+#ifndef I18N_PHONENUMBERS_SSE2_UTIL_H_
+#define I18N_PHONENUMBERS_SSE2_UTIL_H_
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define I18N_PHONENUMBERS_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "phonenumbers/base/basictypes.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+#if defined(I18N_PHONENUMBERS_USE_SSE2)
+
+// Returns the index of the lowest bit set in mask, which can't be 0.
+inline int CountTrailingZeros(uint32 mask) {
+#if defined(_MSC_VER)
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return static_cast<int>(index);
+#else
+  return __builtin_ctz(mask);
+#endif
+}
+
+#endif  // I18N_PHONENUMBERS_USE_SSE2
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_SSE2_UTIL_H_
@@ -444,5 +444,19 @@ void StrAppend(string* dest, const StringHolder& s1, const StringHolder& s2,
   *dest += s5;
 }
 
+void StrAppendDecimal(string* dest, uint64 n) {
+  assert(dest);
+
+  // The largest uint64 has 20 digits.
+  char digits[20];
+  char* const end = digits + sizeof(digits);
+  char* start = end;
+  do {
+    *--start = static_cast<char>('0' + n % 10);
+    n /= 10;
+  } while (n > 0);
+  dest->append(start, end - start);
+}
+
 }  // namespace phonenumbers
 }  // namespace i18n
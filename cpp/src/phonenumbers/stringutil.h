@@ -170,6 +170,10 @@ void StrAppend(string* dest, const StringHolder& s1, const StringHolder& s2,
                const StringHolder& s3, const StringHolder& s4,
                const StringHolder& s5);
 
+// Appends the decimal representation of n to dest. Unlike StrAppend(dest, n),
+// this doesn't create any temporary string.
+void StrAppendDecimal(string* dest, uint64 n);
+
 }  // namespace phonenumbers
 }  // namespace i18n
 
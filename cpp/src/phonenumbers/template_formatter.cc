@@ -0,0 +1,214 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/template_formatter.h"
+
+#include <vector>
+
+#include "phonenumbers/base/logging.h"
+#include "phonenumbers/digit_automaton.h"
+#include "phonenumbers/digit_group_pattern.h"
+#include "phonenumbers/phonemetadata.pb.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::vector;
+
+namespace {
+
+// Returns true if text only contains ASCII characters and no backslash, which
+// regular expressions would interpret in a replacement text.
+bool IsPlainReplacementText(const string& text) {
+  for (string::const_iterator it = text.begin(); it != text.end(); ++it) {
+    if (*it == '\\' || static_cast<unsigned char>(*it) >= 0x80) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Sets national_format to format with its first group reference, e.g. "$1",
+// replaced by the national prefix formatting rule, in which "$1" stands for
+// that group reference, e.g. "0$1". This is what PhoneNumberUtil does with
+// regular expressions. Returns false if the rule refers to other groups.
+bool ApplyNationalPrefixFormattingRule(const string& format,
+                                       const string& rule,
+                                       string* national_format) {
+  size_t first_group = 0;
+  while ((first_group = format.find('$', first_group)) != string::npos &&
+         (first_group + 1 == format.length() ||
+          format[first_group + 1] < '0' || format[first_group + 1] > '9')) {
+    ++first_group;
+  }
+  if (first_group == string::npos) {
+    national_format->assign(format);
+    return true;
+  }
+  national_format->assign(format, 0, first_group);
+  for (size_t i = 0; i < rule.length(); ++i) {
+    if (rule[i] != '$') {
+      national_format->push_back(rule[i]);
+    } else if (i + 1 < rule.length() && rule[i + 1] == '1') {
+      national_format->append(format, first_group, 2);
+      ++i;
+    } else {
+      return false;
+    }
+  }
+  national_format->append(format, first_group + 2, string::npos);
+  return true;
+}
+
+}  // namespace
+
+// The literal text and the group references of a format, e.g. "($1) $2-$3".
+class TemplateFormatter::Template {
+ public:
+  // Returns the template of format, or NULL if it refers to other groups than
+  // the num_groups groups of the pattern.
+  static Template* Create(const string& format, int num_groups) {
+    if (!IsPlainReplacementText(format)) {
+      return NULL;
+    }
+    Template* const format_template = new Template();
+    format_template->literals_.push_back(string());
+    for (size_t i = 0; i < format.length(); ++i) {
+      if (format[i] != '$') {
+        format_template->literals_.back().push_back(format[i]);
+        continue;
+      }
+      // A group number followed by another digit could be read as a larger
+      // group number by the regular expressions.
+      if (i + 1 == format.length() || format[i + 1] < '1' ||
+          format[i + 1] > static_cast<char>('0' + num_groups) ||
+          (i + 2 < format.length() && format[i + 2] >= '0' &&
+           format[i + 2] <= '9')) {
+        delete format_template;
+        return NULL;
+      }
+      format_template->groups_.push_back(format[i + 1] - '1');
+      format_template->literals_.push_back(string());
+      ++i;
+    }
+    return format_template;
+  }
+
+  // Appends the format of the match of the pattern in national_number, which
+  // starts at offset and whose groups end at group_ends.
+  void Append(const string& national_number, int offset,
+              const int* group_ends, string* formatted_number) const {
+    for (size_t i = 0; i < groups_.size(); ++i) {
+      formatted_number->append(literals_[i]);
+      const int group = groups_[i];
+      const int group_start = group == 0 ? offset : group_ends[group - 1];
+      formatted_number->append(national_number, group_start,
+                               group_ends[group] - group_start);
+    }
+    formatted_number->append(literals_.back());
+  }
+
+ private:
+  Template() : literals_(), groups_() {}
+
+  // The literal text preceding each group reference, and the one following
+  // the last one.
+  vector<string> literals_;
+  // The indices of the referenced groups, starting at 0.
+  vector<int> groups_;
+
+  DISALLOW_COPY_AND_ASSIGN(Template);
+};
+
+// The templates of a format in the NATIONAL and the INTERNATIONAL formats.
+class TemplateFormatter::Templates {
+ public:
+  // Returns the templates of format, or NULL if its pattern isn't made of
+  // groups of digits or if one of the templates can't be compiled.
+  static Templates* Create(const NumberFormat& format) {
+    Templates* const templates = new Templates();
+    string national_format(format.format());
+    if (!templates->pattern_.Parse(format.pattern()) ||
+        (!format.national_prefix_formatting_rule().empty() &&
+         !ApplyNationalPrefixFormattingRule(
+             format.format(), format.national_prefix_formatting_rule(),
+             &national_format))) {
+      delete templates;
+      return NULL;
+    }
+    const int num_groups = templates->pattern_.num_groups();
+    templates->template_.reset(Template::Create(format.format(), num_groups));
+    templates->national_template_.reset(
+        Template::Create(national_format, num_groups));
+    if (!templates->template_.get() || !templates->national_template_.get()) {
+      delete templates;
+      return NULL;
+    }
+    return templates;
+  }
+
+  void Format(const string& national_number, bool national,
+              string* formatted_number) const {
+    const Template& format_template =
+        national ? *national_template_ : *template_;
+    int group_ends[DigitGroupPattern::kMaxGroups];
+    int match_start;
+    int offset = 0;
+    // Like RegExp::GlobalReplace(), every match of the pattern is replaced,
+    // and the digits outside of the matches are kept as they are.
+    while (pattern_.Match(national_number, offset, &match_start,
+                          group_ends)) {
+      formatted_number->append(national_number, offset, match_start - offset);
+      format_template.Append(national_number, match_start, group_ends,
+                             formatted_number);
+      offset = group_ends[pattern_.num_groups() - 1];
+    }
+    formatted_number->append(national_number, offset, string::npos);
+  }
+
+ private:
+  Templates() : pattern_(), template_(), national_template_() {}
+
+  DigitGroupPattern pattern_;
+  scoped_ptr<const Template> template_;
+  scoped_ptr<const Template> national_template_;
+
+  DISALLOW_COPY_AND_ASSIGN(Templates);
+};
+
+TemplateFormatter::TemplateFormatter()
+    : cache_impl_(new CacheImpl(256)) {}
+
+TemplateFormatter::~TemplateFormatter() {}
+
+bool TemplateFormatter::Format(const string& national_number,
+                               const NumberFormat& format,
+                               bool national,
+                               string* formatted_number) const {
+  DCHECK(formatted_number);
+  const Templates* templates;
+  if (!cache_impl_->Find(&format, &templates)) {
+    // The formats without templates are cached as well, so that the
+    // compilation is only attempted once.
+    templates = cache_impl_->Insert(&format, Templates::Create(format));
+  }
+  if (!templates || !IsAsciiDigitString(national_number)) {
+    return false;
+  }
+  templates->Format(national_number, national, formatted_number);
+  return true;
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
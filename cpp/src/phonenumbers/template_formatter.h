@@ -0,0 +1,71 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Formats national numbers with the NumberFormat messages of the metadata
+// without running any regular expression. Each format is compiled once into a
+// template: the text of its format, with the national prefix formatting rule
+// applied for the national format, split into literal text and references to
+// the groups of its pattern. Formatting a number then only slices the number
+// at the ends of the groups and appends the slices and the literal text.
+//
+// Templates are only compiled for the patterns made of groups of digits, see
+// DigitGroupPattern, and for the format texts only referring to their groups.
+// The other formats, and numbers containing characters other than ASCII
+// digits, are left to the regular expressions of the caller.
+
+#ifndef I18N_PHONENUMBERS_TEMPLATE_FORMATTER_H_
+#define I18N_PHONENUMBERS_TEMPLATE_FORMATTER_H_
+
+#include <string>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/base/memory/scoped_ptr.h"
+#include "phonenumbers/read_mostly_cache.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+
+class NumberFormat;
+
+class TemplateFormatter {
+ public:
+  TemplateFormatter();
+  ~TemplateFormatter();
+
+  // Appends to formatted_number national_number formatted with format, after
+  // applying its national prefix formatting rule if national is true, the way
+  // PhoneNumberUtil::FormatNsnUsingPattern() does it in the NATIONAL or
+  // INTERNATIONAL formats, and returns true. Returns false if there is no
+  // template for format or if national_number contains characters other than
+  // ASCII digits. The format must outlive this instance, since its templates
+  // are cached.
+  bool Format(const string& national_number, const NumberFormat& format,
+              bool national, string* formatted_number) const;
+
+ private:
+  class Template;
+  class Templates;
+  typedef ReadMostlyCache<const NumberFormat*, Templates> CacheImpl;
+
+  const scoped_ptr<CacheImpl> cache_impl_;
+
+  DISALLOW_COPY_AND_ASSIGN(TemplateFormatter);
+};
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_TEMPLATE_FORMATTER_H_
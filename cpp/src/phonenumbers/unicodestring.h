@@ -99,8 +99,10 @@ class UnicodeString {
       int start,
       int length = std::numeric_limits<int>::max()) const;
 
+  // Copies the UTF-8 representation of the unicode string to out, reusing its
+  // buffer.
   inline void toUTF8String(string& out) const {
-    out = UnicodeTextToUTF8(text_);
+    out.assign(text_.utf8_data(), text_.utf8_length());
   }
 
   char32 operator[](int index) const;
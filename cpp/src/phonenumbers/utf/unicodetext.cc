@@ -135,10 +135,14 @@ void UnicodeText::Repr::resize(int new_size) {
   }
 }
 
-// This implementation of clear() deallocates the buffer if we're an owner.
-// That's not strictly necessary; we could just set size_ to 0.
+// This implementation of clear() keeps the buffer if we're an owner, so that
+// a text which is cleared and filled again, like the input accrued by
+// AsYouTypeFormatter, doesn't allocate once its buffer is large enough.
 void UnicodeText::Repr::clear() {
-  if (ours_) delete[] data_;
+  if (ours_) {
+    size_ = 0;
+    return;
+  }
   data_ = NULL;
   size_ = capacity_ = 0;
   ours_ = true;
@@ -0,0 +1,300 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/as_you_type_pattern_store.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "phonenumbers/base/memory/scoped_ptr.h"
+#include "phonenumbers/phonemetadata.pb.h"
+#include "phonenumbers/phonenumberutil.h"
+#include "phonenumbers/regexp_adapter.h"
+#include "phonenumbers/test_util.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+
+class AsYouTypePatternStoreTest : public testing::Test {
+ protected:
+  AsYouTypePatternStoreTest() : store_(*PhoneNumberUtil::GetInstance()) {}
+
+  // Returns the part of input consumed by pattern, or "?" if it doesn't match
+  // a prefix of input.
+  string Consume(const RegExp& pattern, const string& input) const {
+    const scoped_ptr<RegExpInput> regexp_input(
+        store_.regexp_factory().CreateInput(input));
+    if (!pattern.Consume(regexp_input.get())) {
+      return "?";
+    }
+    return input.substr(0, input.length() - regexp_input->ToString().length());
+  }
+
+  // Returns the length of the international prefix matched by the automaton
+  // of metadata, or "?" if there is no automaton.
+  string MatchInternationalPrefix(const PhoneMetadata& metadata,
+                                  const string& number) const {
+    int prefix_length;
+    if (!store_.MatchInternationalPrefix(metadata, number, &prefix_length)) {
+      return "?";
+    }
+    return prefix_length < 0 ? "-1" : string(1, '0' + prefix_length);
+  }
+
+  const AsYouTypePatternStore store_;
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(AsYouTypePatternStoreTest);
+};
+
+TEST_F(AsYouTypePatternStoreTest, FormatPatternsAreCompiledOnce) {
+  NumberFormat format = MakeFormat("(\\d{3})(\\d{4})", "$1 $2");
+  format.add_leading_digits_pattern("[2-4]");
+  format.add_leading_digits_pattern("[2-4]1");
+  const AsYouTypePatternStore::FormatPatterns& patterns =
+      store_.GetFormatPatterns(format);
+  EXPECT_EQ(&patterns, &store_.GetFormatPatterns(format));
+
+  ASSERT_EQ(2U, patterns.leading_digits_patterns.size());
+  EXPECT_EQ("3", Consume(*patterns.leading_digits_patterns[0], "3123"));
+  EXPECT_EQ("31", Consume(*patterns.leading_digits_patterns[1], "3123"));
+  EXPECT_EQ("?", Consume(*patterns.leading_digits_patterns[1], "3213"));
+  EXPECT_TRUE(patterns.pattern->FullMatch("1234567"));
+
+  // Formats using the same patterns share their compiled patterns.
+  NumberFormat same_format = MakeFormat("(\\d{3})(\\d{4})", "$1 $2");
+  same_format.add_leading_digits_pattern("[2-4]");
+  const AsYouTypePatternStore::FormatPatterns& same_patterns =
+      store_.GetFormatPatterns(same_format);
+  EXPECT_NE(&patterns, &same_patterns);
+  EXPECT_EQ(patterns.leading_digits_patterns[0],
+            same_patterns.leading_digits_patterns[0]);
+  EXPECT_EQ(patterns.pattern, same_patterns.pattern);
+}
+
+TEST_F(AsYouTypePatternStoreTest, FormattingTemplates) {
+  // The character classes and the standalone digits of the patterns match any
+  // digit, and the template is created for the longest number the pattern
+  // matches.
+  const NumberFormat format = MakeFormat("(2[0-4]1)(\\d{2,3})", "$1 $2");
+  const AsYouTypePatternStore::FormatPatterns& patterns =
+      store_.GetFormatPatterns(format);
+  EXPECT_EQ(6U, patterns.max_digits);
+  EXPECT_EQ("\xE2\x80\x88\xE2\x80\x88\xE2\x80\x88 "
+            "\xE2\x80\x88\xE2\x80\x88\xE2\x80\x88",
+            patterns.formatting_template);
+
+  NumberFormat punctuated_format =
+      MakeFormat("(\\d{2})(\\d{4})(\\d{4})", "$1 $2");
+  punctuated_format.set_format("($1) $2-$3");
+  const AsYouTypePatternStore::FormatPatterns& punctuated_patterns =
+      store_.GetFormatPatterns(punctuated_format);
+  EXPECT_EQ(10U, punctuated_patterns.max_digits);
+  EXPECT_EQ("(\xE2\x80\x88\xE2\x80\x88) "
+            "\xE2\x80\x88\xE2\x80\x88\xE2\x80\x88\xE2\x80\x88-"
+            "\xE2\x80\x88\xE2\x80\x88\xE2\x80\x88\xE2\x80\x88",
+            punctuated_patterns.formatting_template);
+
+  // No template can be created from patterns with alternatives.
+  const NumberFormat alternative_format = MakeFormat("(20|3)(\\d{4})", "$1 $2");
+  const AsYouTypePatternStore::FormatPatterns& alternative_patterns =
+      store_.GetFormatPatterns(alternative_format);
+  EXPECT_TRUE(alternative_patterns.pattern->FullMatch("201234"));
+  EXPECT_EQ("", alternative_patterns.formatting_template);
+}
+
+TEST_F(AsYouTypePatternStoreTest, SeparateNationalPrefix) {
+  // The patterns are cached by the address of the formats, which must then
+  // all be alive at the same time.
+  const NumberFormat no_rule = MakeFormat("(\\d)(\\d{4})", "$1 $2");
+  const NumberFormat attached = MakeFormat("(\\d)(\\d{4})", "$1 $2", "0$FG");
+  const NumberFormat space = MakeFormat("(\\d)(\\d{4})", "$1 $2", "0 $FG");
+  const NumberFormat dash = MakeFormat("(\\d)(\\d{4})", "$1 $2", "0-$FG");
+  EXPECT_FALSE(store_.GetFormatPatterns(no_rule).separate_national_prefix);
+  EXPECT_FALSE(store_.GetFormatPatterns(attached).separate_national_prefix);
+  EXPECT_TRUE(store_.GetFormatPatterns(space).separate_national_prefix);
+  EXPECT_TRUE(store_.GetFormatPatterns(dash).separate_national_prefix);
+}
+
+TEST_F(AsYouTypePatternStoreTest, FormatFlags) {
+  const NumberFormat format = MakeFormat("(\\d{3})(\\d{4})", "$1 $2", "($1)");
+  const AsYouTypePatternStore::FormatPatterns& patterns =
+      store_.GetFormatPatterns(format);
+  EXPECT_TRUE(patterns.eligible);
+  EXPECT_TRUE(patterns.national_prefix_rule_has_first_group_only);
+
+  NumberFormat star_format = MakeFormat("(\\d{4})", "$1 $2", "0$1");
+  star_format.set_format("*$1");
+  const AsYouTypePatternStore::FormatPatterns& star_patterns =
+      store_.GetFormatPatterns(star_format);
+  EXPECT_FALSE(star_patterns.eligible);
+  EXPECT_FALSE(star_patterns.national_prefix_rule_has_first_group_only);
+}
+
+TEST_F(AsYouTypePatternStoreTest, MatchLeadingDigits) {
+  PhoneMetadata metadata;
+  NumberFormat* const format = metadata.add_number_format();
+  format->set_pattern("(\\d{3})(\\d{4})");
+  format->add_leading_digits_pattern("[2-4]");
+  format->add_leading_digits_pattern("[2-4]1");
+  // Formats without leading digits patterns always match.
+  metadata.add_number_format()->set_pattern("(\\d{3})(\\d{3})");
+  NumberFormat* const other_format = metadata.add_number_format();
+  other_format->set_pattern("(\\d{2})(\\d{4})");
+  other_format->add_leading_digits_pattern("5|3[2-4]");
+
+  uint32 matching_formats = 0;
+  ASSERT_TRUE(store_.MatchLeadingDigits(metadata.number_format(), 0, "322",
+                                        &matching_formats));
+  EXPECT_EQ(7U, matching_formats);
+  ASSERT_TRUE(store_.MatchLeadingDigits(metadata.number_format(), 1, "322",
+                                        &matching_formats));
+  EXPECT_EQ(6U, matching_formats);
+  ASSERT_TRUE(store_.MatchLeadingDigits(metadata.number_format(), 1, "3123",
+                                        &matching_formats));
+  EXPECT_EQ(3U, matching_formats);
+  // The formats with fewer leading digits patterns use their last one.
+  ASSERT_TRUE(store_.MatchLeadingDigits(metadata.number_format(), 5, "3123",
+                                        &matching_formats));
+  EXPECT_EQ(3U, matching_formats);
+  ASSERT_TRUE(store_.MatchLeadingDigits(metadata.number_format(), 0, "512",
+                                        &matching_formats));
+  EXPECT_EQ(6U, matching_formats);
+
+  // Only ASCII digits are matched.
+  EXPECT_FALSE(store_.MatchLeadingDigits(metadata.number_format(), 0, "3a2",
+                                         &matching_formats));
+}
+
+TEST_F(AsYouTypePatternStoreTest, MatchLeadingDigitsWithoutAutomata) {
+  uint32 matching_formats = 0;
+  PhoneMetadata unsupported_metadata;
+  NumberFormat* const format = unsupported_metadata.add_number_format();
+  format->set_pattern("(\\d{3})(\\d{4})");
+  format->add_leading_digits_pattern("(?=1)2");
+  EXPECT_FALSE(store_.MatchLeadingDigits(unsupported_metadata.number_format(),
+                                         0, "123", &matching_formats));
+
+  PhoneMetadata large_metadata;
+  for (int i = 0; i <= AsYouTypePatternStore::kMaxFormats; ++i) {
+    large_metadata.add_number_format()->set_pattern("(\\d{3})(\\d{4})");
+  }
+  EXPECT_FALSE(store_.MatchLeadingDigits(large_metadata.number_format(), 0,
+                                         "123", &matching_formats));
+}
+
+TEST_F(AsYouTypePatternStoreTest, MatchPatterns) {
+  PhoneMetadata metadata;
+  metadata.add_number_format()->set_pattern("(\\d{3})(\\d{4})");
+  metadata.add_number_format()->set_pattern("(\\d{3})(\\d{3,4})");
+  metadata.add_number_format()->set_pattern("(2\\d)(\\d{4})");
+
+  uint32 matching_formats = 0;
+  ASSERT_TRUE(store_.MatchPatterns(metadata.number_format(), "1234567",
+                                   &matching_formats));
+  EXPECT_EQ(3U, matching_formats);
+  ASSERT_TRUE(store_.MatchPatterns(metadata.number_format(), "234567",
+                                   &matching_formats));
+  EXPECT_EQ(6U, matching_formats);
+  ASSERT_TRUE(store_.MatchPatterns(metadata.number_format(), "12345",
+                                   &matching_formats));
+  EXPECT_EQ(0U, matching_formats);
+  EXPECT_FALSE(store_.MatchPatterns(metadata.number_format(), "12345a",
+                                    &matching_formats));
+
+  PhoneMetadata unsupported_metadata;
+  unsupported_metadata.add_number_format()->set_pattern("(?=1)(\\d{4})");
+  EXPECT_FALSE(store_.MatchPatterns(unsupported_metadata.number_format(),
+                                    "1234", &matching_formats));
+}
+
+TEST_F(AsYouTypePatternStoreTest, MatchInternationalPrefix) {
+  PhoneMetadata metadata;
+  metadata.set_international_prefix("0(?:0|1[0-9])");
+  EXPECT_EQ("1", MatchInternationalPrefix(metadata, "+4412"));
+  EXPECT_EQ("2", MatchInternationalPrefix(metadata, "004412"));
+  EXPECT_EQ("3", MatchInternationalPrefix(metadata, "01544"));
+  EXPECT_EQ("-1", MatchInternationalPrefix(metadata, "1234"));
+  // The plus sign is matched whatever the digits following it.
+  EXPECT_EQ("1", MatchInternationalPrefix(metadata, "+\xEF\xBC\x94"));
+  EXPECT_EQ("?", MatchInternationalPrefix(metadata, "0\xEF\xBC\x90"));
+
+  // The automata of the prefixes which start other prefixes can't tell which
+  // one the regular expression consumes.
+  PhoneMetadata ambiguous_metadata;
+  ambiguous_metadata.set_international_prefix("00|0011");
+  EXPECT_EQ("1", MatchInternationalPrefix(ambiguous_metadata, "+4412"));
+  EXPECT_EQ("?", MatchInternationalPrefix(ambiguous_metadata, "004412"));
+}
+
+TEST_F(AsYouTypePatternStoreTest, MatchNationalPrefixForParsing) {
+  PhoneMetadata metadata;
+  metadata.set_international_prefix("00");
+  int prefix_length = 0;
+  EXPECT_FALSE(store_.MatchNationalPrefixForParsing(metadata, "0123",
+                                                    &prefix_length));
+
+  // The patterns are cached by metadata, so each prefix needs its own.
+  PhoneMetadata prefix_metadata;
+  prefix_metadata.set_international_prefix("00");
+  prefix_metadata.set_national_prefix_for_parsing("0|8");
+  ASSERT_TRUE(store_.MatchNationalPrefixForParsing(prefix_metadata, "0123",
+                                                   &prefix_length));
+  EXPECT_EQ(1, prefix_length);
+  ASSERT_TRUE(store_.MatchNationalPrefixForParsing(prefix_metadata, "123",
+                                                   &prefix_length));
+  EXPECT_EQ(-1, prefix_length);
+
+  PhoneMetadata optional_metadata;
+  optional_metadata.set_international_prefix("00");
+  optional_metadata.set_national_prefix_for_parsing("0?");
+  EXPECT_FALSE(store_.MatchNationalPrefixForParsing(optional_metadata, "0123",
+                                                    &prefix_length));
+}
+
+TEST_F(AsYouTypePatternStoreTest, RegionPatterns) {
+  PhoneMetadata metadata;
+  metadata.set_international_prefix("00");
+  const AsYouTypePatternStore::RegionPatterns& patterns =
+      store_.GetRegionPatterns(metadata);
+  EXPECT_EQ(&patterns, &store_.GetRegionPatterns(metadata));
+  EXPECT_EQ("+", Consume(*patterns.international_prefix, "+4412"));
+  EXPECT_EQ("00", Consume(*patterns.international_prefix, "004412"));
+  EXPECT_EQ("?", Consume(*patterns.international_prefix, "01234"));
+  EXPECT_TRUE(patterns.national_prefix_for_parsing == NULL);
+
+  PhoneMetadata metadata_with_national_prefix;
+  metadata_with_national_prefix.set_international_prefix("00");
+  metadata_with_national_prefix.set_national_prefix_for_parsing("0");
+  const AsYouTypePatternStore::RegionPatterns& national_prefix_patterns =
+      store_.GetRegionPatterns(metadata_with_national_prefix);
+  ASSERT_TRUE(national_prefix_patterns.national_prefix_for_parsing != NULL);
+  EXPECT_EQ("0",
+            Consume(*national_prefix_patterns.national_prefix_for_parsing,
+                    "01234"));
+}
+
+TEST_F(AsYouTypePatternStoreTest, EmptyMetadata) {
+  const PhoneMetadata& metadata = store_.empty_metadata();
+  EXPECT_EQ(&metadata, &store_.empty_metadata());
+  EXPECT_EQ("NA", metadata.international_prefix());
+  EXPECT_FALSE(metadata.has_national_prefix_for_parsing());
+  EXPECT_EQ(0, metadata.number_format_size());
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
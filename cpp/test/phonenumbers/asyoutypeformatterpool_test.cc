@@ -0,0 +1,128 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/asyoutypeformatterpool.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "phonenumbers/asyoutypeformatter.h"
+#include "phonenumbers/test_util.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+using std::vector;
+
+TEST(AsYouTypeFormatterPoolTest, ReleasedFormattersAreReused) {
+  AsYouTypeFormatterPool pool(2);
+  AsYouTypeFormatter* const formatter = pool.Acquire(RegionCode::US());
+  ASSERT_TRUE(formatter != NULL);
+  EXPECT_EQ(0U, pool.GetIdleFormatterCount(RegionCode::US()));
+  pool.Release(formatter);
+  EXPECT_EQ(1U, pool.GetIdleFormatterCount(RegionCode::US()));
+  EXPECT_EQ(formatter, pool.Acquire(RegionCode::US()));
+  EXPECT_EQ(0U, pool.GetIdleFormatterCount(RegionCode::US()));
+  pool.Release(formatter);
+}
+
+TEST(AsYouTypeFormatterPoolTest, ReleasedFormattersAreCleared) {
+  AsYouTypeFormatterPool pool(1);
+  string result;
+  AsYouTypeFormatter* formatter = pool.Acquire(RegionCode::US());
+  formatter->InputDigit('+', &result);
+  formatter->InputDigit('4', &result);
+  EXPECT_EQ("+48 ", formatter->InputDigit('8', &result));
+  pool.Release(formatter);
+
+  formatter = pool.Acquire(RegionCode::US());
+  EXPECT_EQ("6", formatter->InputDigit('6', &result));
+  EXPECT_EQ("65", formatter->InputDigit('5', &result));
+  EXPECT_EQ("650", formatter->InputDigit('0', &result));
+  EXPECT_EQ("650 2", formatter->InputDigit('2', &result));
+  pool.Release(formatter);
+}
+
+TEST(AsYouTypeFormatterPoolTest, FormattersAreKeyedByRegion) {
+  AsYouTypeFormatterPool pool(1);
+  AsYouTypeFormatter* const us_formatter = pool.Acquire(RegionCode::US());
+  pool.Release(us_formatter);
+  AsYouTypeFormatter* const de_formatter = pool.Acquire(RegionCode::DE());
+  EXPECT_NE(us_formatter, de_formatter);
+  EXPECT_EQ(1U, pool.GetIdleFormatterCount(RegionCode::US()));
+
+  string result;
+  de_formatter->InputDigit('0', &result);
+  de_formatter->InputDigit('3', &result);
+  de_formatter->InputDigit('0', &result);
+  EXPECT_EQ("030/1", de_formatter->InputDigit('1', &result));
+  pool.Release(de_formatter);
+  EXPECT_EQ(1U, pool.GetIdleFormatterCount(RegionCode::DE()));
+}
+
+TEST(AsYouTypeFormatterPoolTest, IdleFormattersAreLimited) {
+  AsYouTypeFormatterPool pool(1);
+  AsYouTypeFormatter* const formatter = pool.Acquire(RegionCode::US());
+  AsYouTypeFormatter* const other_formatter = pool.Acquire(RegionCode::US());
+  EXPECT_NE(formatter, other_formatter);
+  pool.Release(formatter);
+  // The formatter released beyond the limit is deleted.
+  pool.Release(other_formatter);
+  EXPECT_EQ(1U, pool.GetIdleFormatterCount(RegionCode::US()));
+  EXPECT_EQ(formatter, pool.Acquire(RegionCode::US()));
+  pool.Release(formatter);
+}
+
+TEST(AsYouTypeFormatterPoolTest, FormatAsTyped) {
+  AsYouTypeFormatterPool pool(1);
+  vector<string> steps;
+  string result;
+  pool.FormatAsTyped(RegionCode::US(), "6502532222", &steps, &result);
+  ASSERT_EQ(10U, steps.size());
+  EXPECT_EQ("6", steps[0]);
+  EXPECT_EQ("650 2", steps[3]);
+  EXPECT_EQ("650 2532", steps[6]);
+  EXPECT_EQ("650 253 2222", steps[9]);
+  EXPECT_EQ("650 253 2222", result);
+  EXPECT_EQ(1U, pool.GetIdleFormatterCount(RegionCode::US()));
+
+  // The steps of the previous number are replaced.
+  pool.FormatAsTyped(RegionCode::US(), "+48", &steps, &result);
+  ASSERT_EQ(3U, steps.size());
+  EXPECT_EQ("+", steps[0]);
+  EXPECT_EQ("+4", steps[1]);
+  EXPECT_EQ("+48 ", steps[2]);
+  EXPECT_EQ("+48 ", result);
+
+  pool.FormatAsTyped(RegionCode::US(), "", &steps, &result);
+  EXPECT_TRUE(steps.empty());
+  EXPECT_EQ("", result);
+}
+
+TEST(AsYouTypeFormatterPoolTest, FormatAsTypedWithoutSteps) {
+  AsYouTypeFormatterPool pool(1);
+  string result;
+  pool.FormatAsTyped(RegionCode::DE(), "0301", NULL, &result);
+  EXPECT_EQ("030/1", result);
+  pool.FormatAsTyped(RegionCode::US(),
+                     "\xEF\xBC\x96\xEF\xBC\x95\xEF\xBC\x90" /* "６５０" */,
+                     NULL, &result);
+  EXPECT_EQ("650", result);
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -0,0 +1,70 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/benchmarks/allocation_counter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+i18n::phonenumbers::int64 num_allocations = 0;
+
+}  // namespace
+
+// The replacements of operator new and operator delete below allocate with
+// malloc() and deallocate with free(), which GCC can't tell apart from a
+// mismatched deallocation.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(size_t size) {
+  ++num_allocations;
+  void* const p = malloc(size == 0 ? 1 : size);
+  if (!p) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* p) throw() {
+  free(p);
+}
+
+void operator delete[](void* p) throw() {
+  free(p);
+}
+
+void operator delete(void* p, size_t) throw() {
+  free(p);
+}
+
+void operator delete[](void* p, size_t) throw() {
+  free(p);
+}
+
+namespace i18n {
+namespace phonenumbers {
+
+int64 GetAllocationCount() {
+  return num_allocations;
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -0,0 +1,35 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Counts the heap allocations made by a benchmark, by replacing the global
+// operator new in allocation_counter.cc, which has to be linked into the
+// benchmarks using it. The count isn't synchronized, so these benchmarks must
+// remain single-threaded.
+
+#ifndef I18N_PHONENUMBERS_BENCHMARKS_ALLOCATION_COUNTER_H_
+#define I18N_PHONENUMBERS_BENCHMARKS_ALLOCATION_COUNTER_H_
+
+#include "phonenumbers/base/basictypes.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+// Returns the number of allocations made with operator new and operator new[]
+// since the start of the program.
+int64 GetAllocationCount();
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_BENCHMARKS_ALLOCATION_COUNTER_H_
@@ -0,0 +1,83 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks of AsYouTypeFormatter, which replay the keystrokes of the example
+// numbers of every supported region, typed in the national format and in the
+// E.164 format, into formatters of their regions.
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "phonenumbers/asyoutypeformatter.h"
+#include "phonenumbers/base/memory/scoped_ptr.h"
+#include "phonenumbers/benchmarks/typed_numbers.h"
+#include "phonenumbers/phonenumberutil.h"
+
+namespace i18n {
+namespace phonenumbers {
+namespace {
+
+using std::string;
+using std::vector;
+
+void BM_GetAsYouTypeFormatter(benchmark::State& state) {
+  const PhoneNumberUtil& phone_util = *PhoneNumberUtil::GetInstance();
+  const vector<TypedNumber>& typed_numbers = GetTypedNumbers();
+  size_t i = 0;
+  while (state.KeepRunning()) {
+    const scoped_ptr<AsYouTypeFormatter> formatter(
+        phone_util.GetAsYouTypeFormatter(typed_numbers[i].region_code));
+    benchmark::DoNotOptimize(formatter.get());
+    if (++i == typed_numbers.size()) i = 0;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GetAsYouTypeFormatter)->ThreadRange(1, 32)->UseRealTime();
+
+// Creates a formatter for every number and types it, the way a dialer does for
+// every input session.
+void BM_FormatAsYouType(benchmark::State& state) {
+  const PhoneNumberUtil& phone_util = *PhoneNumberUtil::GetInstance();
+  const vector<TypedNumber>& typed_numbers = GetTypedNumbers();
+  string result;
+  size_t i = 0;
+  int64 keystrokes = 0;
+  while (state.KeepRunning()) {
+    const TypedNumber& typed_number = typed_numbers[i];
+    const scoped_ptr<AsYouTypeFormatter> formatter(
+        phone_util.GetAsYouTypeFormatter(typed_number.region_code));
+    for (string::const_iterator it = typed_number.keystrokes.begin();
+         it != typed_number.keystrokes.end(); ++it) {
+      formatter->InputDigit(*it, &result);
+    }
+    keystrokes += typed_number.keystrokes.length();
+    if (++i == typed_numbers.size()) i = 0;
+  }
+  state.SetItemsProcessed(keystrokes);
+}
+BENCHMARK(BM_FormatAsYouType)->ThreadRange(1, 32)->UseRealTime();
+
+}  // namespace
+}  // namespace phonenumbers
+}  // namespace i18n
+
+int main(int argc, char** argv) {
+  // Loads the test data before any benchmark thread is started.
+  i18n::phonenumbers::GetTypedNumbers();
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,144 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks replaying the keystrokes of the example numbers of every supported
+// region, typed in the national format and in the E.164 format, into
+// formatters of their regions, reporting, besides the time, the number of heap
+// allocations made per keystroke. The allocations are counted without any
+// synchronization, so the benchmarks of this file must remain single-threaded.
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "phonenumbers/asyoutypeformatter.h"
+#include "phonenumbers/asyoutypeformatterpool.h"
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/base/memory/scoped_ptr.h"
+#include "phonenumbers/benchmarks/allocation_counter.h"
+#include "phonenumbers/benchmarks/typed_numbers.h"
+#include "phonenumbers/phonenumberutil.h"
+
+namespace i18n {
+namespace phonenumbers {
+namespace {
+
+using std::string;
+using std::vector;
+
+// Types typed_number into a formatter of the pool, and returns the number of
+// keystrokes.
+int64 TypeNumber(const TypedNumber& typed_number,
+                 AsYouTypeFormatterPool* pool,
+                 string* result) {
+  AsYouTypeFormatter* const formatter = pool->Acquire(typed_number.region_code);
+  for (string::const_iterator it = typed_number.keystrokes.begin();
+       it != typed_number.keystrokes.end(); ++it) {
+    formatter->InputDigit(*it, result);
+  }
+  pool->Release(formatter);
+  return typed_number.keystrokes.length();
+}
+
+// Replays the numbers into the formatters of a pool, which once warm are
+// expected not to allocate any memory.
+void BM_ReplayKeystrokesWithPool(benchmark::State& state) {
+  const vector<TypedNumber>& typed_numbers = GetTypedNumbers();
+  AsYouTypeFormatterPool pool(1);
+  string result;
+  // Warms up the pool, the formatters and the pattern store.
+  for (size_t i = 0; i < typed_numbers.size(); ++i) {
+    TypeNumber(typed_numbers[i], &pool, &result);
+  }
+  const int64 start_allocations = GetAllocationCount();
+  size_t i = 0;
+  int64 keystrokes = 0;
+  while (state.KeepRunning()) {
+    keystrokes += TypeNumber(typed_numbers[i], &pool, &result);
+    if (++i == typed_numbers.size()) {
+      i = 0;
+    }
+  }
+  state.counters["allocs_per_keystroke"] = benchmark::Counter(
+      static_cast<double>(GetAllocationCount() - start_allocations) / keystrokes);
+  state.SetItemsProcessed(keystrokes);
+}
+BENCHMARK(BM_ReplayKeystrokesWithPool);
+
+// Replays the numbers with FormatAsTyped(), keeping only the final outputs.
+void BM_FormatAsTyped(benchmark::State& state) {
+  const vector<TypedNumber>& typed_numbers = GetTypedNumbers();
+  AsYouTypeFormatterPool pool(1);
+  string result;
+  for (size_t i = 0; i < typed_numbers.size(); ++i) {
+    pool.FormatAsTyped(typed_numbers[i].region_code,
+                       typed_numbers[i].keystrokes, NULL, &result);
+  }
+  const int64 start_allocations = GetAllocationCount();
+  size_t i = 0;
+  int64 keystrokes = 0;
+  while (state.KeepRunning()) {
+    const TypedNumber& typed_number = typed_numbers[i];
+    pool.FormatAsTyped(typed_number.region_code, typed_number.keystrokes, NULL,
+                       &result);
+    keystrokes += typed_number.keystrokes.length();
+    if (++i == typed_numbers.size()) {
+      i = 0;
+    }
+  }
+  state.counters["allocs_per_keystroke"] = benchmark::Counter(
+      static_cast<double>(GetAllocationCount() - start_allocations) / keystrokes);
+  state.SetItemsProcessed(keystrokes);
+}
+BENCHMARK(BM_FormatAsTyped);
+
+// Replays the numbers into new formatters, for comparison.
+void BM_ReplayKeystrokesWithNewFormatters(benchmark::State& state) {
+  const PhoneNumberUtil& phone_util = *PhoneNumberUtil::GetInstance();
+  const vector<TypedNumber>& typed_numbers = GetTypedNumbers();
+  string result;
+  const int64 start_allocations = GetAllocationCount();
+  size_t i = 0;
+  int64 keystrokes = 0;
+  while (state.KeepRunning()) {
+    const TypedNumber& typed_number = typed_numbers[i];
+    const scoped_ptr<AsYouTypeFormatter> formatter(
+        phone_util.GetAsYouTypeFormatter(typed_number.region_code));
+    for (string::const_iterator it = typed_number.keystrokes.begin();
+         it != typed_number.keystrokes.end(); ++it) {
+      formatter->InputDigit(*it, &result);
+    }
+    keystrokes += typed_number.keystrokes.length();
+    if (++i == typed_numbers.size()) {
+      i = 0;
+    }
+  }
+  state.counters["allocs_per_keystroke"] = benchmark::Counter(
+      static_cast<double>(GetAllocationCount() - start_allocations) / keystrokes);
+  state.SetItemsProcessed(keystrokes);
+}
+BENCHMARK(BM_ReplayKeystrokesWithNewFormatters);
+
+}  // namespace
+}  // namespace phonenumbers
+}  // namespace i18n
+
+int main(int argc, char** argv) {
+  // Loads the test data before counting any allocation.
+  i18n::phonenumbers::GetTypedNumbers();
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
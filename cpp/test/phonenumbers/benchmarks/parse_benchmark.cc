@@ -0,0 +1,149 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks of PhoneNumberUtil::Parse() reporting, besides the time, the
+// number of heap allocations made per parsed number. The allocations are
+// counted without any synchronization, so the benchmarks of this file must
+// remain single-threaded.
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/benchmarks/allocation_counter.h"
+#include "phonenumbers/phonenumber.pb.h"
+#include "phonenumbers/phonenumberutil.h"
+
+namespace i18n {
+namespace phonenumbers {
+namespace {
+
+using std::set;
+using std::string;
+using std::vector;
+
+// Returns the example numbers of all the regions, formatted in number_format.
+const vector<string>& GetFormattedExampleNumbers(
+    PhoneNumberUtil::PhoneNumberFormat number_format) {
+  static vector<string>* formatted_numbers[PhoneNumberUtil::RFC3966 + 1];
+  if (!formatted_numbers[number_format]) {
+    formatted_numbers[number_format] = new vector<string>();
+    const PhoneNumberUtil& phone_util = *PhoneNumberUtil::GetInstance();
+    set<string> regions;
+    phone_util.GetSupportedRegions(&regions);
+    for (set<string>::const_iterator it = regions.begin();
+         it != regions.end(); ++it) {
+      PhoneNumber number;
+      if (phone_util.GetExampleNumberForType(*it, PhoneNumberUtil::MOBILE,
+                                             &number)) {
+        string formatted_number;
+        phone_util.Format(number, number_format, &formatted_number);
+        formatted_numbers[number_format]->push_back(formatted_number);
+      }
+    }
+  }
+  return *formatted_numbers[number_format];
+}
+
+void BM_ParseAllocations(benchmark::State& state,
+                         PhoneNumberUtil::PhoneNumberFormat number_format) {
+  const PhoneNumberUtil& phone_util = *PhoneNumberUtil::GetInstance();
+  const vector<string>& formatted_numbers =
+      GetFormattedExampleNumbers(number_format);
+  const string default_region("ZZ");
+  PhoneNumber number;
+  // Warms up the metadata and the pattern caches.
+  for (size_t i = 0; i < formatted_numbers.size(); ++i) {
+    phone_util.Parse(formatted_numbers[i], default_region, &number);
+  }
+  const int64 start_allocations = GetAllocationCount();
+  size_t i = 0;
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        phone_util.Parse(formatted_numbers[i], default_region, &number));
+    if (++i == formatted_numbers.size()) {
+      i = 0;
+    }
+  }
+  state.counters["allocs_per_parse"] = benchmark::Counter(
+      static_cast<double>(GetAllocationCount() - start_allocations) /
+      state.iterations());
+  state.SetItemsProcessed(state.iterations());
+}
+// "+41446681800", handled by the fast path of Parse().
+BENCHMARK_CAPTURE(BM_ParseAllocations, E164, PhoneNumberUtil::E164);
+// "+41 44 668 18 00", which goes through the whole parsing.
+BENCHMARK_CAPTURE(BM_ParseAllocations, International,
+                  PhoneNumberUtil::INTERNATIONAL);
+
+void BM_ParseBatchAllocations(
+    benchmark::State& state, PhoneNumberUtil::PhoneNumberFormat number_format) {
+  const PhoneNumberUtil& phone_util = *PhoneNumberUtil::GetInstance();
+  const vector<string>& formatted_numbers =
+      GetFormattedExampleNumbers(number_format);
+  const size_t num_numbers = formatted_numbers.size();
+  const string default_region("ZZ");
+  vector<PhoneNumber> numbers(num_numbers);
+  vector<PhoneNumberUtil::ErrorType> errors(num_numbers);
+  phone_util.ParseBatch(&formatted_numbers[0], default_region, num_numbers,
+                        &numbers[0], &errors[0]);
+  const int64 start_allocations = GetAllocationCount();
+  while (state.KeepRunning()) {
+    phone_util.ParseBatch(&formatted_numbers[0], default_region, num_numbers,
+                          &numbers[0], &errors[0]);
+    benchmark::DoNotOptimize(&errors[0]);
+  }
+  state.counters["allocs_per_parse"] = benchmark::Counter(
+      static_cast<double>(GetAllocationCount() - start_allocations) /
+      (state.iterations() * num_numbers));
+  state.SetItemsProcessed(state.iterations() * num_numbers);
+}
+BENCHMARK_CAPTURE(BM_ParseBatchAllocations, E164, PhoneNumberUtil::E164);
+BENCHMARK_CAPTURE(BM_ParseBatchAllocations, International,
+                  PhoneNumberUtil::INTERNATIONAL);
+
+void BM_NormalizeDigitsOnly(benchmark::State& state) {
+  const PhoneNumberUtil& phone_util = *PhoneNumberUtil::GetInstance();
+  const vector<string>& formatted_numbers =
+      GetFormattedExampleNumbers(PhoneNumberUtil::INTERNATIONAL);
+  string number;
+  size_t i = 0;
+  while (state.KeepRunning()) {
+    number = formatted_numbers[i];
+    phone_util.NormalizeDigitsOnly(&number);
+    benchmark::DoNotOptimize(number.data());
+    if (++i == formatted_numbers.size()) {
+      i = 0;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NormalizeDigitsOnly);
+
+}  // namespace
+}  // namespace phonenumbers
+}  // namespace i18n
+
+int main(int argc, char** argv) {
+  i18n::phonenumbers::GetFormattedExampleNumbers(
+      i18n::phonenumbers::PhoneNumberUtil::E164);
+  i18n::phonenumbers::GetFormattedExampleNumbers(
+      i18n::phonenumbers::PhoneNumberUtil::INTERNATIONAL);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
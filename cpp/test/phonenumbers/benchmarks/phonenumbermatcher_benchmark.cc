@@ -0,0 +1,268 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks of PhoneNumberMatcher on documents of increasing sizes, made of
+// prose interleaved with phone numbers. The time per byte should not depend on
+// the size of the document, and should decrease with the density of the
+// numbers, since the text without digits is skipped. Some benchmarks also run
+// with this skipping turned off, and report the number of matches, which must
+// be the same in both modes.
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "phonenumbers/phonenumbermatch.h"
+#include "phonenumbers/phonenumbermatcher.h"
+#include "phonenumbers/phonenumberparallelmatcher.h"
+#include "phonenumbers/phonenumberstreammatcher.h"
+#include "phonenumbers/phonenumberutil.h"
+#include "phonenumbers/stl_util.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+using std::vector;
+
+// Gives the benchmarks access to the switch of the matchers skipping the text
+// without digits.
+class PhoneNumberMatcherBenchmark {
+ public:
+  // Returns the number of numbers found in document, skipping the text without
+  // digits if skip_text_without_digits is true.
+  static int CountMatches(const string& document,
+                          bool skip_text_without_digits) {
+    PhoneNumberMatcher matcher(document, "US");
+    matcher.skip_text_without_digits_ = skip_text_without_digits;
+    PhoneNumberMatch match;
+    int num_matches = 0;
+    while (matcher.HasNext()) {
+      matcher.Next(&match);
+      ++num_matches;
+    }
+    return num_matches;
+  }
+};
+
+namespace {
+
+// Returns a document of size bytes with a phone number about every 250 bytes,
+// and some non-ASCII text.
+string MakeDocument(size_t size) {
+  static const char* const kParagraphs[] = {
+    "Please call our office at 650-253-0000 during business hours, or send "
+    "a fax to (650) 253-0001 if you prefer. We usually answer within a day. ",
+    "Unser B\xC3\xBCro in Z\xC3\xBCrich erreichen Sie unter +41 44 668 18 00; "
+    "die Rechnung Nr. 2011-3344 wurde am 3/10/2011 versandt. ",
+    "The meeting starts on 2012-01-02 08:00 in room 1234. Dial "
+    "+1 800 555 0199 ext. 42 to join, or 1-800-FLOWERS for the flowers. ",
+    "\xE9\x9B\xBB\xE8\xA9\xB1\xEF\xBC\x9A\xEF\xBC\x90\xEF\xBC\x93\xEF\xBC\x8D"
+    "\xEF\xBC\x93\xEF\xBC\x92\xEF\xBC\x91\xEF\xBC\x90\xEF\xBC\x8D\xEF\xBC\x95"
+    "\xEF\xBC\x96\xEF\xBC\x97\xEF\xBC\x98, nothing else to see here. ",
+  };
+  string document;
+  for (size_t i = 0; document.size() < size; ++i) {
+    document.append(kParagraphs[i % arraysize(kParagraphs)]);
+  }
+  // Cuts the document at a character boundary.
+  size_t end = size;
+  while (end > 0 && (document[end] & 0xC0) == 0x80) {
+    --end;
+  }
+  document.resize(end);
+  return document;
+}
+
+// Returns a document of size bytes made of prose in several scripts, without
+// digits, with a phone number every spacing bytes.
+string MakeProse(size_t size, size_t spacing) {
+  static const char* const kSentences[] = {
+    "It was the best of times, it was the worst of times, it was the age of "
+    "wisdom, it was the age of foolishness. ",
+    "Die Sonne schien auf das Meer, als w\xC3\xA4re nichts geschehen. ",
+    "\xD0\x92\xD1\x81\xD0\xB5 \xD1\x81\xD1\x87\xD0\xB0\xD1\x81\xD1"
+    "\x82\xD0\xBB\xD0\xB8\xD0\xB2\xD1\x8B\xD0\xB5 \xD1\x81\xD0\xB5"
+    "\xD0\xBC\xD1\x8C\xD0\xB8 \xD0\xBF\xD0\xBE\xD1\x85\xD0\xBE\xD0"
+    "\xB6\xD0\xB8 \xD0\xB4\xD1\x80\xD1\x83\xD0\xB3 \xD0\xBD\xD0\xB0 "
+    "\xD0\xB4\xD1\x80\xD1\x83\xD0\xB3\xD0\xB0. ",
+    "\xE5\xA4\xA9\xE4\xB8\x8B\xE5\xA4\xA7\xE5\x8A\xBF\xEF\xBC\x8C"
+    "\xE5\x88\x86\xE4\xB9\x85\xE5\xBF\x85\xE5\x90\x88\xEF\xBC\x8C"
+    "\xE5\x90\x88\xE4\xB9\x85\xE5\xBF\x85\xE5\x88\x86\xE3\x80\x82",
+    "\xE2\x80\x9CWhat (and why) \xE2\x80\x94 if anything \xE2\x80\x94 "
+    "should we do?\xE2\x80\x9D she asked; nobody answered. ",
+  };
+  string document;
+  size_t next_number = spacing;
+  for (size_t i = 0; document.size() < size; ++i) {
+    if (document.size() >= next_number) {
+      document.append("Call +1 650-253-0000 now. ");
+      next_number += spacing;
+    }
+    document.append(kSentences[i % arraysize(kSentences)]);
+  }
+  return document;
+}
+
+void BM_FindNumbers(benchmark::State& state) {
+  const string document = MakeDocument(state.range(0));
+  int num_matches = 0;
+  while (state.KeepRunning()) {
+    PhoneNumberMatcher matcher(document, "US");
+    PhoneNumberMatch match;
+    num_matches = 0;
+    while (matcher.HasNext()) {
+      matcher.Next(&match);
+      ++num_matches;
+    }
+  }
+  state.counters["matches"] = num_matches;
+  state.SetBytesProcessed(state.iterations() * document.size());
+}
+BENCHMARK(BM_FindNumbers)
+    ->Arg(1 << 10)
+    ->Arg(1 << 20)
+    ->Arg(100 << 20)
+    ->Unit(benchmark::kMillisecond);
+
+// A document of 1MB searched with the leniency range(0). The grouping checks
+// of STRICT_GROUPING and EXACT_GROUPING should not cost much more than VALID.
+void BM_FindNumbersWithLeniency(benchmark::State& state) {
+  const string document = MakeDocument(1 << 20);
+  const PhoneNumberMatcher::Leniency leniency =
+      static_cast<PhoneNumberMatcher::Leniency>(state.range(0));
+  int num_matches = 0;
+  while (state.KeepRunning()) {
+    PhoneNumberMatcher matcher(*PhoneNumberUtil::GetInstance(), document, "US",
+                               leniency, 65535);
+    PhoneNumberMatch match;
+    num_matches = 0;
+    while (matcher.HasNext()) {
+      matcher.Next(&match);
+      ++num_matches;
+    }
+  }
+  state.counters["matches"] = num_matches;
+  state.SetBytesProcessed(state.iterations() * document.size());
+}
+BENCHMARK(BM_FindNumbersWithLeniency)
+    ->Arg(PhoneNumberMatcher::POSSIBLE)
+    ->Arg(PhoneNumberMatcher::VALID)
+    ->Arg(PhoneNumberMatcher::STRICT_GROUPING)
+    ->Arg(PhoneNumberMatcher::EXACT_GROUPING)
+    ->Unit(benchmark::kMillisecond);
+
+// A document of 16MB of prose with a phone number every range(0) bytes,
+// searched skipping the text without digits if range(1) is 1, or without
+// skipping it if range(1) is 0.
+void BM_FindNumbersInProse(benchmark::State& state) {
+  const string document = MakeProse(16 << 20, state.range(0));
+  const bool skip_text_without_digits = state.range(1) != 0;
+  int num_matches = 0;
+  while (state.KeepRunning()) {
+    num_matches = PhoneNumberMatcherBenchmark::CountMatches(
+        document, skip_text_without_digits);
+  }
+  state.counters["matches"] = num_matches;
+  state.SetBytesProcessed(state.iterations() * document.size());
+}
+BENCHMARK(BM_FindNumbersInProse)
+    ->ArgPair(4 << 10, 0)
+    ->ArgPair(4 << 10, 1)
+    ->ArgPair(64 << 10, 0)
+    ->ArgPair(64 << 10, 1)
+    ->ArgPair(16 << 20, 0)
+    ->ArgPair(16 << 20, 1)
+    ->Unit(benchmark::kMillisecond);
+
+// A document of 1MB with a phone number about every 250 bytes, searched
+// skipping the text without digits if range(0) is 1, or without skipping it if
+// range(0) is 0.
+void BM_FindNumbersInDenseText(benchmark::State& state) {
+  const string document = MakeDocument(1 << 20);
+  const bool skip_text_without_digits = state.range(0) != 0;
+  int num_matches = 0;
+  while (state.KeepRunning()) {
+    num_matches = PhoneNumberMatcherBenchmark::CountMatches(
+        document, skip_text_without_digits);
+  }
+  state.counters["matches"] = num_matches;
+  state.SetBytesProcessed(state.iterations() * document.size());
+}
+BENCHMARK(BM_FindNumbersInDenseText)
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond);
+
+// The same document fed by chunks of 4KB.
+void BM_FindNumbersInStream(benchmark::State& state) {
+  static const size_t kChunkLength = 4096;
+  const string document = MakeDocument(state.range(0));
+  int num_matches = 0;
+  while (state.KeepRunning()) {
+    PhoneNumberStreamMatcher matcher("US");
+    PhoneNumberMatch match;
+    num_matches = 0;
+    for (size_t i = 0; i < document.length(); i += kChunkLength) {
+      matcher.Feed(document.substr(i, kChunkLength));
+      while (matcher.Next(&match)) {
+        ++num_matches;
+      }
+    }
+    matcher.Finish();
+    while (matcher.Next(&match)) {
+      ++num_matches;
+    }
+  }
+  state.counters["matches"] = num_matches;
+  state.SetBytesProcessed(state.iterations() * document.size());
+}
+BENCHMARK(BM_FindNumbersInStream)
+    ->Arg(1 << 10)
+    ->Arg(1 << 20)
+    ->Arg(100 << 20)
+    ->Unit(benchmark::kMillisecond);
+
+// A document of 4MB searched on an increasing number of threads.
+void BM_FindNumbersOnThreads(benchmark::State& state) {
+  static const string document = MakeDocument(4 << 20);
+  const PhoneNumberParallelMatcher matcher(*PhoneNumberUtil::GetInstance(),
+                                           "US", PhoneNumberMatcher::VALID,
+                                           state.range(0));
+  vector<PhoneNumberMatch*> matches;
+  while (state.KeepRunning()) {
+    matcher.FindNumbers(document, &matches);
+    state.PauseTiming();
+    STLDeleteElements(&matches);
+    matches.clear();
+    state.ResumeTiming();
+  }
+  state.SetBytesProcessed(state.iterations() * document.size());
+}
+BENCHMARK(BM_FindNumbersOnThreads)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace phonenumbers
+}  // namespace i18n
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,369 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks of the parsing, validation, classification and formatting code
+// paths of PhoneNumberUtil, run against the real metadata with the example
+// numbers of every supported region.
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "phonenumbers/dfa_based_matcher.h"
+#include "phonenumbers/metadata.h"
+#include "phonenumbers/phonemetadata.pb.h"
+#include "phonenumbers/phonenumber.pb.h"
+#include "phonenumbers/phonenumberbulkprocessor.h"
+#include "phonenumbers/phonenumberutil.h"
+#include "phonenumbers/preparedphonenumber.h"
+#include "phonenumbers/regex_based_matcher.h"
+#include "phonenumbers/stl_util.h"
+
+namespace i18n {
+namespace phonenumbers {
+namespace {
+
+using google::protobuf::RepeatedPtrField;
+using std::set;
+using std::string;
+using std::vector;
+
+// Returns the example numbers of all the number types of all the regions.
+const vector<PhoneNumber>& GetExampleNumbers() {
+  static vector<PhoneNumber>* numbers = NULL;
+  if (!numbers) {
+    numbers = new vector<PhoneNumber>();
+    const PhoneNumberUtil& phone_util = *PhoneNumberUtil::GetInstance();
+    set<string> regions;
+    phone_util.GetSupportedRegions(&regions);
+    for (set<string>::const_iterator it = regions.begin();
+         it != regions.end(); ++it) {
+      for (int type = PhoneNumberUtil::FIXED_LINE;
+           type <= PhoneNumberUtil::VOICEMAIL; ++type) {
+        PhoneNumber number;
+        if (phone_util.GetExampleNumberForType(
+                *it, static_cast<PhoneNumberUtil::PhoneNumberType>(type),
+                &number)) {
+          numbers->push_back(number);
+        }
+      }
+    }
+  }
+  return *numbers;
+}
+
+// Returns the example numbers formatted in the international format.
+const vector<string>& GetFormattedExampleNumbers() {
+  static vector<string>* formatted_numbers = NULL;
+  if (!formatted_numbers) {
+    formatted_numbers = new vector<string>();
+    const PhoneNumberUtil& phone_util = *PhoneNumberUtil::GetInstance();
+    const vector<PhoneNumber>& numbers = GetExampleNumbers();
+    for (size_t i = 0; i < numbers.size(); ++i) {
+      string formatted_number;
+      phone_util.Format(numbers[i], PhoneNumberUtil::INTERNATIONAL,
+                        &formatted_number);
+      formatted_numbers->push_back(formatted_number);
+    }
+  }
+  return *formatted_numbers;
+}
+
+void BM_Parse(benchmark::State& state) {
+  const PhoneNumberUtil& phone_util = *PhoneNumberUtil::GetInstance();
+  const vector<string>& formatted_numbers = GetFormattedExampleNumbers();
+  PhoneNumber number;
+  // Warms up the pattern caches.
+  for (size_t i = 0; i < formatted_numbers.size(); ++i) {
+    phone_util.Parse(formatted_numbers[i], "ZZ", &number);
+  }
+  size_t i = 0;
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        phone_util.Parse(formatted_numbers[i], "ZZ", &number));
+    if (++i == formatted_numbers.size()) {
+      i = 0;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Parse)->ThreadRange(1, 32)->UseRealTime();
+
+void BM_GetRegionCodeForNumber(benchmark::State& state) {
+  const PhoneNumberUtil& phone_util = *PhoneNumberUtil::GetInstance();
+  const vector<PhoneNumber>& numbers = GetExampleNumbers();
+  string region_code;
+  // Warms up the pattern caches.
+  for (size_t i = 0; i < numbers.size(); ++i) {
+    phone_util.GetRegionCodeForNumber(numbers[i], &region_code);
+  }
+  size_t i = 0;
+  while (state.KeepRunning()) {
+    phone_util.GetRegionCodeForNumber(numbers[i], &region_code);
+    benchmark::DoNotOptimize(region_code.data());
+    if (++i == numbers.size()) {
+      i = 0;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GetRegionCodeForNumber);
+
+void BM_IsValidNumber(benchmark::State& state) {
+  const PhoneNumberUtil& phone_util = *PhoneNumberUtil::GetInstance();
+  const vector<PhoneNumber>& numbers = GetExampleNumbers();
+  // Warms up the pattern caches.
+  for (size_t i = 0; i < numbers.size(); ++i) {
+    phone_util.IsValidNumber(numbers[i]);
+  }
+  size_t i = 0;
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(phone_util.IsValidNumber(numbers[i]));
+    if (++i == numbers.size()) {
+      i = 0;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+// Also run with several threads validating numbers concurrently, which must
+// not contend on any lock once the caches are warm.
+BENCHMARK(BM_IsValidNumber)->ThreadRange(1, 32)->UseRealTime();
+
+void BM_GetNumberType(benchmark::State& state) {
+  const PhoneNumberUtil& phone_util = *PhoneNumberUtil::GetInstance();
+  const vector<PhoneNumber>& numbers = GetExampleNumbers();
+  // Warms up the pattern caches.
+  for (size_t i = 0; i < numbers.size(); ++i) {
+    phone_util.GetNumberType(numbers[i]);
+  }
+  size_t i = 0;
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(phone_util.GetNumberType(numbers[i]));
+    if (++i == numbers.size()) {
+      i = 0;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GetNumberType);
+
+// Formats the example numbers in the format given by the argument.
+void BM_Format(benchmark::State& state) {
+  const PhoneNumberUtil& phone_util = *PhoneNumberUtil::GetInstance();
+  const vector<PhoneNumber>& numbers = GetExampleNumbers();
+  const PhoneNumberUtil::PhoneNumberFormat number_format =
+      static_cast<PhoneNumberUtil::PhoneNumberFormat>(state.range(0));
+  string formatted_number;
+  // Warms up the pattern caches.
+  for (size_t i = 0; i < numbers.size(); ++i) {
+    phone_util.Format(numbers[i], number_format, &formatted_number);
+  }
+  size_t i = 0;
+  while (state.KeepRunning()) {
+    phone_util.Format(numbers[i], number_format, &formatted_number);
+    benchmark::DoNotOptimize(formatted_number.data());
+    if (++i == numbers.size()) {
+      i = 0;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Format)
+    ->Arg(PhoneNumberUtil::E164)
+    ->Arg(PhoneNumberUtil::INTERNATIONAL)
+    ->Arg(PhoneNumberUtil::NATIONAL)
+    ->Arg(PhoneNumberUtil::RFC3966);
+
+// Same as BM_Format, appending the numbers to a buffer which is reused, the way
+// they would be serialized.
+void BM_AppendFormattedNumber(benchmark::State& state) {
+  const PhoneNumberUtil& phone_util = *PhoneNumberUtil::GetInstance();
+  const vector<PhoneNumber>& numbers = GetExampleNumbers();
+  const PhoneNumberUtil::PhoneNumberFormat number_format =
+      static_cast<PhoneNumberUtil::PhoneNumberFormat>(state.range(0));
+  string buffer;
+  // Warms up the pattern caches.
+  for (size_t i = 0; i < numbers.size(); ++i) {
+    phone_util.AppendFormattedNumber(numbers[i], number_format, &buffer);
+  }
+  size_t i = 0;
+  while (state.KeepRunning()) {
+    if (i == 0) {
+      buffer.clear();
+    }
+    phone_util.AppendFormattedNumber(numbers[i], number_format, &buffer);
+    buffer.push_back(',');
+    if (++i == numbers.size()) {
+      i = 0;
+    }
+  }
+  benchmark::DoNotOptimize(buffer.data());
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AppendFormattedNumber)
+    ->Arg(PhoneNumberUtil::E164)
+    ->Arg(PhoneNumberUtil::INTERNATIONAL)
+    ->Arg(PhoneNumberUtil::NATIONAL)
+    ->Arg(PhoneNumberUtil::RFC3966);
+
+// Compares every example number with the next one, half of them written in the
+// international format and half of them in the national format, like in an
+// address book. The argument selects how the numbers are given: as PhoneNumber
+// objects parsed with their raw input, as strings, or prepared once from the
+// strings.
+void BM_IsNumberMatch(benchmark::State& state) {
+  const PhoneNumberUtil& phone_util = *PhoneNumberUtil::GetInstance();
+  const vector<PhoneNumber>& example_numbers = GetExampleNumbers();
+  const size_t num_numbers = example_numbers.size();
+  vector<string> texts(num_numbers);
+  vector<PhoneNumber> numbers(num_numbers);
+  vector<PreparedPhoneNumber*> prepared_numbers(num_numbers);
+  for (size_t i = 0; i < num_numbers; ++i) {
+    phone_util.Format(example_numbers[i],
+                      i % 2 == 0 ? PhoneNumberUtil::INTERNATIONAL
+                                 : PhoneNumberUtil::NATIONAL,
+                      &texts[i]);
+    phone_util.ParseAndKeepRawInput(texts[i], "ZZ", &numbers[i]);
+    prepared_numbers[i] = new PreparedPhoneNumber();
+    phone_util.PrepareNumberForMatching(texts[i], prepared_numbers[i]);
+  }
+  size_t i = 0;
+  while (state.KeepRunning()) {
+    const size_t j = i + 1 == num_numbers ? 0 : i + 1;
+    switch (state.range(0)) {
+      case 0:
+        benchmark::DoNotOptimize(
+            phone_util.IsNumberMatch(numbers[i], numbers[j]));
+        break;
+      case 1:
+        benchmark::DoNotOptimize(
+            phone_util.IsNumberMatchWithTwoStrings(texts[i], texts[j]));
+        break;
+      default:
+        benchmark::DoNotOptimize(
+            phone_util.IsNumberMatch(*prepared_numbers[i],
+                                     *prepared_numbers[j]));
+        break;
+    }
+    i = j;
+  }
+  STLDeleteElements(&prepared_numbers);
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_IsNumberMatch)->DenseRange(0, 2);
+
+// Processes the formatted example numbers, repeated to make up a large input,
+// on the number of threads given by the argument.
+void BM_BulkProcess(benchmark::State& state) {
+  const vector<string>& formatted_numbers = GetFormattedExampleNumbers();
+  vector<string> numbers_to_parse;
+  while (numbers_to_parse.size() < 100000) {
+    numbers_to_parse.insert(numbers_to_parse.end(), formatted_numbers.begin(),
+                            formatted_numbers.end());
+  }
+  const PhoneNumberBulkProcessor processor(state.range(0));
+  vector<BulkProcessingResult> results;
+  while (state.KeepRunning()) {
+    processor.Process(numbers_to_parse, "ZZ", &results);
+  }
+  state.SetItemsProcessed(state.iterations() * numbers_to_parse.size());
+}
+BENCHMARK(BM_BulkProcess)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
+
+// A national number together with the descriptions of its region, probed in
+// the order used by PhoneNumberUtil::GetNumberType().
+struct Probe {
+  string national_number;
+  vector<const PhoneNumberDesc*> descs;
+};
+
+const vector<Probe>& GetProbes() {
+  static PhoneMetadataCollection* metadata_collection = NULL;
+  static vector<Probe>* probes = NULL;
+  if (!probes) {
+    metadata_collection = new PhoneMetadataCollection();
+    metadata_collection->ParseFromArray(metadata_get(), metadata_size());
+    probes = new vector<Probe>();
+    for (RepeatedPtrField<PhoneMetadata>::const_iterator it =
+             metadata_collection->metadata().begin();
+         it != metadata_collection->metadata().end(); ++it) {
+      const PhoneNumberDesc* const descs[] = {
+        &it->general_desc(), &it->premium_rate(), &it->toll_free(),
+        &it->shared_cost(), &it->voip(), &it->personal_number(),
+        &it->pager(), &it->uan(), &it->voicemail(), &it->fixed_line(),
+        &it->mobile(),
+      };
+      for (size_t i = 0; i < arraysize(descs); ++i) {
+        if (!descs[i]->has_example_number()) {
+          continue;
+        }
+        Probe probe;
+        probe.national_number = descs[i]->example_number();
+        probe.descs.assign(descs, descs + arraysize(descs));
+        probes->push_back(probe);
+      }
+    }
+  }
+  return *probes;
+}
+
+// Runs the matcher over every description of the region of a number, the way
+// the number type classification does, to compare the matcher implementations
+// independently of the rest of PhoneNumberUtil.
+template <typename Matcher>
+void BM_MatchNumberTypes(benchmark::State& state) {
+  const Matcher matcher;
+  const vector<Probe>& probes = GetProbes();
+  // Compiles the patterns beforehand, so that only matching is measured.
+  for (vector<Probe>::const_iterator probe = probes.begin();
+       probe != probes.end(); ++probe) {
+    for (vector<const PhoneNumberDesc*>::const_iterator it =
+             probe->descs.begin(); it != probe->descs.end(); ++it) {
+      matcher.MatchesPossibleNumber(probe->national_number, **it);
+      matcher.MatchesNationalNumber(probe->national_number, **it, false);
+    }
+  }
+  size_t i = 0;
+  while (state.KeepRunning()) {
+    const Probe& probe = probes[i];
+    for (vector<const PhoneNumberDesc*>::const_iterator it =
+             probe.descs.begin(); it != probe.descs.end(); ++it) {
+      benchmark::DoNotOptimize(
+          matcher.MatchesPossibleNumber(probe.national_number, **it) &&
+          matcher.MatchesNationalNumber(probe.national_number, **it, false));
+    }
+    if (++i == probes.size()) {
+      i = 0;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_MatchNumberTypes, RegexBasedMatcher);
+BENCHMARK_TEMPLATE(BM_MatchNumberTypes, DfaBasedMatcher);
+
+}  // namespace
+}  // namespace phonenumbers
+}  // namespace i18n
+
+int main(int argc, char** argv) {
+  // Loads the test data before any benchmark thread is started.
+  i18n::phonenumbers::GetExampleNumbers();
+  i18n::phonenumbers::GetFormattedExampleNumbers();
+  i18n::phonenumbers::GetProbes();
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,141 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Multi-threaded benchmark of cache hits in RegExpCache, compared to a cache
+// taking a lock on every lookup as RegExpCache used to do. With the lock, the
+// throughput collapses as threads are added, whereas RegExpCache scales with
+// the number of cores.
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "phonenumbers/base/synchronization/lock.h"
+#include "phonenumbers/metadata.h"
+#include "phonenumbers/phonemetadata.pb.h"
+#include "phonenumbers/regexp_adapter.h"
+#include "phonenumbers/regexp_cache.h"
+#include "phonenumbers/regexp_factory.h"
+#include "phonenumbers/stl_util.h"
+
+namespace i18n {
+namespace phonenumbers {
+namespace {
+
+using std::make_pair;
+using std::map;
+using std::string;
+using std::vector;
+
+// The previous implementation of RegExpCache, used as a reference.
+class LockingRegExpCache {
+ public:
+  explicit LockingRegExpCache(const AbstractRegExpFactory& regexp_factory)
+      : regexp_factory_(regexp_factory) {}
+
+  ~LockingRegExpCache() {
+    STLDeleteContainerPairSecondPointers(cache_impl_.begin(),
+                                         cache_impl_.end());
+  }
+
+  const RegExp& GetRegExp(const string& pattern) {
+    AutoLock l(lock_);
+    map<string, const RegExp*>::const_iterator it = cache_impl_.find(pattern);
+    if (it != cache_impl_.end()) return *it->second;
+
+    const RegExp* regexp = regexp_factory_.CreateRegExp(pattern);
+    cache_impl_.insert(make_pair(pattern, regexp));
+    return *regexp;
+  }
+
+ private:
+  const AbstractRegExpFactory& regexp_factory_;
+  Lock lock_;
+  map<string, const RegExp*> cache_impl_;
+};
+
+// Returns the national number patterns of the metadata.
+const vector<string>& GetPatterns() {
+  static vector<string>* patterns = NULL;
+  if (!patterns) {
+    patterns = new vector<string>();
+    PhoneMetadataCollection metadata_collection;
+    metadata_collection.ParseFromArray(metadata_get(), metadata_size());
+    for (int i = 0; i < metadata_collection.metadata_size(); ++i) {
+      const PhoneMetadata& metadata = metadata_collection.metadata(i);
+      patterns->push_back(metadata.general_desc().national_number_pattern());
+      patterns->push_back(metadata.fixed_line().national_number_pattern());
+      patterns->push_back(metadata.mobile().national_number_pattern());
+    }
+  }
+  return *patterns;
+}
+
+// Returns a cache holding all the patterns, shared by all the threads.
+template <typename Cache>
+Cache* GetWarmCache() {
+  static RegExpFactory* regexp_factory = NULL;
+  static Cache* cache = NULL;
+  if (!cache) {
+    regexp_factory = new RegExpFactory();
+    cache = new Cache(*regexp_factory);
+    const vector<string>& patterns = GetPatterns();
+    for (size_t i = 0; i < patterns.size(); ++i) {
+      cache->GetRegExp(patterns[i]);
+    }
+  }
+  return cache;
+}
+
+// Adapts the constructor of RegExpCache to the one of LockingRegExpCache.
+class SizedRegExpCache : public RegExpCache {
+ public:
+  explicit SizedRegExpCache(const AbstractRegExpFactory& regexp_factory)
+      : RegExpCache(regexp_factory, 128) {}
+};
+
+template <typename Cache>
+void BM_GetCachedRegExp(benchmark::State& state) {
+  // The caches are filled by main(), before the threads are started.
+  Cache* const cache = GetWarmCache<Cache>();
+  const vector<string>& patterns = GetPatterns();
+  size_t i = 0;
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(&cache->GetRegExp(patterns[i]));
+    if (++i == patterns.size()) {
+      i = 0;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_GetCachedRegExp, LockingRegExpCache)
+    ->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_GetCachedRegExp, SizedRegExpCache)
+    ->ThreadRange(1, 32)->UseRealTime();
+
+}  // namespace
+}  // namespace phonenumbers
+}  // namespace i18n
+
+int main(int argc, char** argv) {
+  using i18n::phonenumbers::GetWarmCache;
+  GetWarmCache<i18n::phonenumbers::LockingRegExpCache>();
+  GetWarmCache<i18n::phonenumbers::SizedRegExpCache>();
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
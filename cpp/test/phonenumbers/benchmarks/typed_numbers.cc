@@ -0,0 +1,58 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/benchmarks/typed_numbers.h"
+
+#include <set>
+
+#include "phonenumbers/phonenumber.pb.h"
+#include "phonenumbers/phonenumberutil.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::set;
+
+const vector<TypedNumber>& GetTypedNumbers() {
+  static vector<TypedNumber>* typed_numbers = NULL;
+  if (!typed_numbers) {
+    typed_numbers = new vector<TypedNumber>();
+    const PhoneNumberUtil& phone_util = *PhoneNumberUtil::GetInstance();
+    set<string> regions;
+    phone_util.GetSupportedRegions(&regions);
+    vector<TypedNumber> e164_numbers;
+    for (set<string>::const_iterator it = regions.begin();
+         it != regions.end(); ++it) {
+      PhoneNumber number;
+      if (!phone_util.GetExampleNumber(*it, &number)) {
+        continue;
+      }
+      TypedNumber typed_number;
+      typed_number.region_code = *it;
+      phone_util.Format(number, PhoneNumberUtil::NATIONAL,
+                        &typed_number.keystrokes);
+      phone_util.NormalizeDigitsOnly(&typed_number.keystrokes);
+      typed_numbers->push_back(typed_number);
+      phone_util.Format(number, PhoneNumberUtil::E164,
+                        &typed_number.keystrokes);
+      e164_numbers.push_back(typed_number);
+    }
+    typed_numbers->insert(typed_numbers->end(), e164_numbers.begin(),
+                          e164_numbers.end());
+  }
+  return *typed_numbers;
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -0,0 +1,44 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// The numbers typed into the AsYouTypeFormatter benchmarks.
+
+#ifndef I18N_PHONENUMBERS_BENCHMARKS_TYPED_NUMBERS_H_
+#define I18N_PHONENUMBERS_BENCHMARKS_TYPED_NUMBERS_H_
+
+#include <string>
+#include <vector>
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+using std::vector;
+
+// A number as typed by a user, with the region of the formatter.
+struct TypedNumber {
+  string region_code;
+  string keystrokes;
+};
+
+// Returns the fixed-line example numbers of all the regions, typed in the
+// national format without punctuation, followed by the same numbers typed in
+// the E.164 format. The numbers are created by the first call, which must be
+// made before any benchmark thread is started.
+const vector<TypedNumber>& GetTypedNumbers();
+
+}  // namespace phonenumbers
+}  // namespace i18n
+
+#endif  // I18N_PHONENUMBERS_BENCHMARKS_TYPED_NUMBERS_H_
@@ -0,0 +1,243 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/compactphonenumber.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "phonenumbers/phonenumber.h"
+#include "phonenumbers/phonenumber.pb.h"
+#include "phonenumbers/phonenumberutil.h"
+#include "phonenumbers/test_util.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+using std::vector;
+
+class CompactPhoneNumberTest : public testing::Test {
+ protected:
+  CompactPhoneNumberTest() : phone_util_(*PhoneNumberUtil::GetInstance()) {}
+
+  // Returns the compact representation of number, which must exist.
+  static CompactPhoneNumber MakeCompact(const PhoneNumber& number) {
+    CompactPhoneNumber compact_number;
+    EXPECT_TRUE(CompactPhoneNumber::FromPhoneNumber(number, &compact_number))
+        << number;
+    return compact_number;
+  }
+
+  const PhoneNumberUtil& phone_util_;
+};
+
+TEST_F(CompactPhoneNumberTest, IsSmall) {
+  EXPECT_EQ(16U, sizeof(CompactPhoneNumber));
+}
+
+TEST_F(CompactPhoneNumberTest, ConvertsPhoneNumbers) {
+  PhoneNumber number;
+  number.set_country_code(64);
+  number.set_national_number(33316005ULL);
+  CompactPhoneNumber compact_number = MakeCompact(number);
+  EXPECT_EQ(64, compact_number.country_code());
+  EXPECT_EQ(33316005ULL, compact_number.national_number());
+  EXPECT_FALSE(compact_number.italian_leading_zero());
+  EXPECT_EQ(1, compact_number.number_of_leading_zeros());
+  EXPECT_FALSE(compact_number.has_extension());
+  PhoneNumber converted_number;
+  compact_number.ToPhoneNumber(&converted_number);
+  EXPECT_TRUE(ExactlySameAs(number, converted_number)) << converted_number;
+
+  // The leading zeros of the extensions are kept.
+  number.set_extension("0012");
+  compact_number = MakeCompact(number);
+  EXPECT_TRUE(compact_number.has_extension());
+  string extension;
+  compact_number.GetExtension(&extension);
+  EXPECT_EQ("0012", extension);
+  compact_number.ToPhoneNumber(&converted_number);
+  EXPECT_TRUE(ExactlySameAs(number, converted_number)) << converted_number;
+
+  number.set_extension("123456789");
+  compact_number = MakeCompact(number);
+  compact_number.ToPhoneNumber(&converted_number);
+  EXPECT_TRUE(ExactlySameAs(number, converted_number)) << converted_number;
+
+  PhoneNumber it_number;
+  it_number.set_country_code(39);
+  it_number.set_national_number(236618300ULL);
+  it_number.set_italian_leading_zero(true);
+  compact_number = MakeCompact(it_number);
+  EXPECT_TRUE(compact_number.italian_leading_zero());
+  EXPECT_EQ(1, compact_number.number_of_leading_zeros());
+  compact_number.ToPhoneNumber(&converted_number);
+  EXPECT_TRUE(ExactlySameAs(it_number, converted_number)) << converted_number;
+
+  it_number.set_number_of_leading_zeros(2);
+  compact_number = MakeCompact(it_number);
+  EXPECT_EQ(2, compact_number.number_of_leading_zeros());
+  compact_number.ToPhoneNumber(&converted_number);
+  EXPECT_TRUE(ExactlySameAs(it_number, converted_number)) << converted_number;
+}
+
+TEST_F(CompactPhoneNumberTest, DropsTheFieldsWhichDontIdentifyNumbers) {
+  PhoneNumber number;
+  number.set_country_code(1);
+  number.set_national_number(6502530000ULL);
+  number.set_raw_input("+1 650 253 0000");
+  number.set_country_code_source(PhoneNumber::FROM_NUMBER_WITH_PLUS_SIGN);
+  number.set_preferred_domestic_carrier_code("15");
+  number.set_extension("");
+  PhoneNumber converted_number;
+  MakeCompact(number).ToPhoneNumber(&converted_number);
+  PhoneNumber expected_number;
+  expected_number.set_country_code(1);
+  expected_number.set_national_number(6502530000ULL);
+  EXPECT_TRUE(ExactlySameAs(expected_number, converted_number))
+      << converted_number;
+}
+
+TEST_F(CompactPhoneNumberTest, DoesNotConvertUnrepresentableNumbers) {
+  CompactPhoneNumber compact_number;
+  PhoneNumber number;
+  number.set_country_code(1);
+  number.set_national_number(6502530000ULL);
+  number.set_extension("1234567890");
+  EXPECT_FALSE(CompactPhoneNumber::FromPhoneNumber(number, &compact_number));
+  // Fullwidth digits.
+  number.set_extension("\xEF\xBC\x91\xEF\xBC\x92");
+  EXPECT_FALSE(CompactPhoneNumber::FromPhoneNumber(number, &compact_number));
+  number.set_extension("12#");
+  EXPECT_FALSE(CompactPhoneNumber::FromPhoneNumber(number, &compact_number));
+  number.clear_extension();
+  number.set_country_code(65536);
+  EXPECT_FALSE(CompactPhoneNumber::FromPhoneNumber(number, &compact_number));
+  number.set_country_code(-1);
+  EXPECT_FALSE(CompactPhoneNumber::FromPhoneNumber(number, &compact_number));
+  number.set_country_code(39);
+  number.set_italian_leading_zero(true);
+  number.set_number_of_leading_zeros(256);
+  EXPECT_FALSE(CompactPhoneNumber::FromPhoneNumber(number, &compact_number));
+  number.set_number_of_leading_zeros(0);
+  EXPECT_FALSE(CompactPhoneNumber::FromPhoneNumber(number, &compact_number));
+  // Without an Italian leading zero, the number of leading zeros is ignored.
+  number.set_italian_leading_zero(false);
+  EXPECT_TRUE(CompactPhoneNumber::FromPhoneNumber(number, &compact_number));
+}
+
+TEST_F(CompactPhoneNumberTest, ComparesNumbers) {
+  PhoneNumber number;
+  number.set_country_code(1);
+  number.set_national_number(6502530000ULL);
+  const CompactPhoneNumber us_number = MakeCompact(number);
+  number.set_extension("12");
+  const CompactPhoneNumber us_number_with_extension = MakeCompact(number);
+  number.set_extension("012");
+  const CompactPhoneNumber us_number_with_other_extension =
+      MakeCompact(number);
+  number.clear_extension();
+  number.set_country_code(44);
+  number.set_national_number(2070313000ULL);
+  const CompactPhoneNumber gb_number = MakeCompact(number);
+
+  EXPECT_EQ(us_number, us_number);
+  EXPECT_NE(us_number, us_number_with_extension);
+  EXPECT_NE(us_number_with_extension, us_number_with_other_extension);
+  EXPECT_NE(us_number, gb_number);
+  EXPECT_TRUE(us_number < us_number_with_extension);
+  EXPECT_TRUE(us_number_with_extension < us_number_with_other_extension);
+  EXPECT_TRUE(us_number_with_other_extension < gb_number);
+  EXPECT_FALSE(gb_number < us_number);
+  EXPECT_FALSE(us_number < us_number);
+}
+
+TEST_F(CompactPhoneNumberTest, IsUsableWithPhoneNumberUtil) {
+  PhoneNumber number;
+  number.set_country_code(64);
+  number.set_national_number(33316005ULL);
+  number.set_extension("1234");
+  const CompactPhoneNumber nz_number = MakeCompact(number);
+  string formatted_number;
+  phone_util_.Format(nz_number, PhoneNumberUtil::RFC3966, &formatted_number);
+  EXPECT_EQ("tel:+64-3-331-6005;ext=1234", formatted_number);
+  EXPECT_TRUE(phone_util_.IsValidNumber(nz_number));
+  EXPECT_EQ(PhoneNumberUtil::FIXED_LINE, phone_util_.GetNumberType(nz_number));
+
+  number.clear_extension();
+  EXPECT_EQ(PhoneNumberUtil::SHORT_NSN_MATCH,
+            phone_util_.IsNumberMatch(nz_number, MakeCompact(number)));
+  EXPECT_EQ(PhoneNumberUtil::EXACT_MATCH,
+            phone_util_.IsNumberMatch(nz_number, nz_number));
+  number.set_country_code(0);
+  number.set_extension("1234");
+  EXPECT_EQ(PhoneNumberUtil::NSN_MATCH,
+            phone_util_.IsNumberMatch(nz_number, MakeCompact(number)));
+
+  number.set_country_code(1);
+  number.set_national_number(2530000ULL);
+  const CompactPhoneNumber invalid_number = MakeCompact(number);
+  EXPECT_FALSE(phone_util_.IsValidNumber(invalid_number));
+  EXPECT_EQ(PhoneNumberUtil::UNKNOWN,
+            phone_util_.GetNumberType(invalid_number));
+}
+
+TEST_F(CompactPhoneNumberTest, AgreesWithPhoneNumberOverloads) {
+  const int country_codes[] = { 0, 1, 39, 64, 800 };
+  const uint64 national_numbers[] = {
+    236618300ULL, 36618300ULL, 6502530000ULL, 2530000ULL, 12345678ULL
+  };
+  const int numbers_of_leading_zeros[] = { 0, 1, 2 };
+  const char* const extensions[] = { "", "1", "01", "12" };
+  vector<PhoneNumber> numbers;
+  for (size_t i = 0; i < arraysize(country_codes); ++i) {
+    for (size_t j = 0; j < arraysize(national_numbers); ++j) {
+      for (size_t k = 0; k < arraysize(numbers_of_leading_zeros); ++k) {
+        for (size_t l = 0; l < arraysize(extensions); ++l) {
+          PhoneNumber number;
+          number.set_country_code(country_codes[i]);
+          number.set_national_number(national_numbers[j]);
+          if (numbers_of_leading_zeros[k] > 0) {
+            number.set_italian_leading_zero(true);
+            number.set_number_of_leading_zeros(numbers_of_leading_zeros[k]);
+          }
+          if (*extensions[l]) {
+            number.set_extension(extensions[l]);
+          }
+          numbers.push_back(number);
+        }
+      }
+    }
+  }
+  for (size_t i = 0; i < numbers.size(); ++i) {
+    SCOPED_TRACE(testing::Message() << numbers[i]);
+    const CompactPhoneNumber compact_number = MakeCompact(numbers[i]);
+    EXPECT_EQ(phone_util_.IsValidNumber(numbers[i]),
+              phone_util_.IsValidNumber(compact_number));
+    EXPECT_EQ(phone_util_.GetNumberType(numbers[i]),
+              phone_util_.GetNumberType(compact_number));
+    for (size_t j = 0; j < numbers.size(); ++j) {
+      EXPECT_EQ(phone_util_.IsNumberMatch(numbers[i], numbers[j]),
+                phone_util_.IsNumberMatch(compact_number,
+                                          MakeCompact(numbers[j])))
+          << numbers[j];
+    }
+  }
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -0,0 +1,196 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/decoded_text.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <unicode/stringpiece.h>
+#include <unicode/uchar.h>
+#include <unicode/unistr.h>
+
+namespace i18n {
+namespace phonenumbers {
+
+using icu::UnicodeString;
+using std::string;
+using std::vector;
+
+namespace {
+
+UnicodeString FromUtf8(const string& s) {
+  return UnicodeString::fromUTF8(icu::StringPiece(s.data(), s.size()));
+}
+
+}  // namespace
+
+TEST(DecodedTextTest, Empty) {
+  const string text;
+  DecodedText decoded_text(text);
+  EXPECT_EQ(0, decoded_text.utf16_text().length());
+  EXPECT_EQ(0, decoded_text.ToUtf16Index(0));
+  EXPECT_EQ(0, decoded_text.ToUtf8Offset(0));
+}
+
+TEST(DecodedTextTest, ConvertsOffsets) {
+  // "a", "é" (2 bytes), "€" (3 bytes), "𝄞" (4 bytes, 2 UTF-16 code units).
+  const string text("a\xC3\xA9\xE2\x82\xAC\xF0\x9D\x84\x9E" "b");
+  DecodedText decoded_text(text);
+  EXPECT_EQ(FromUtf8(text), decoded_text.utf16_text());
+
+  const int utf8_offsets[] = { 0, 1, 3, 6, 10, 11 };
+  const int utf16_indices[] = { 0, 1, 2, 3, 5, 6 };
+  for (size_t i = 0; i < arraysize(utf8_offsets); ++i) {
+    EXPECT_EQ(utf16_indices[i], decoded_text.ToUtf16Index(utf8_offsets[i]));
+    EXPECT_EQ(utf8_offsets[i], decoded_text.ToUtf8Offset(utf16_indices[i]));
+  }
+  // Backwards, which can't start from the last converted offset.
+  for (size_t i = arraysize(utf8_offsets); i > 0; --i) {
+    EXPECT_EQ(utf16_indices[i - 1],
+              decoded_text.ToUtf16Index(utf8_offsets[i - 1]));
+    EXPECT_EQ(utf8_offsets[i - 1],
+              decoded_text.ToUtf8Offset(utf16_indices[i - 1]));
+  }
+}
+
+TEST(DecodedTextTest, DecodesInvalidBytesToReplacementCharacters) {
+  // A lone continuation byte, an invalid byte and a truncated character.
+  const string text("1\x80" "2\xFF" "3\xE2\x82");
+  DecodedText decoded_text(text);
+  const UChar expected_text[] = {
+    '1', 0xFFFD, '2', 0xFFFD, '3', 0xFFFD, 0xFFFD
+  };
+  EXPECT_EQ(UnicodeString(expected_text, arraysize(expected_text)),
+            decoded_text.utf16_text());
+  for (int i = 0; i <= static_cast<int>(text.length()); ++i) {
+    EXPECT_EQ(i, decoded_text.ToUtf16Index(i));
+    EXPECT_EQ(i, decoded_text.ToUtf8Offset(i));
+  }
+}
+
+TEST(DecodedTextTest, ConvertsOffsetsOfLongTexts) {
+  // Characters of all the lengths, so that the checkpoints fall in the middle
+  // of characters.
+  string text;
+  vector<int> utf8_offsets;
+  vector<int> utf16_indices;
+  int utf16_index = 0;
+  for (int i = 0; i < 10000; ++i) {
+    utf8_offsets.push_back(static_cast<int>(text.length()));
+    utf16_indices.push_back(utf16_index);
+    switch (i % 4) {
+      case 0:
+        text.append("5");
+        utf16_index += 1;
+        break;
+      case 1:
+        text.append("\xD9\xA5");  // "٥"
+        utf16_index += 1;
+        break;
+      case 2:
+        text.append("\xEF\xBC\x95");  // "５"
+        utf16_index += 1;
+        break;
+      case 3:
+        text.append("\xF0\x9D\x9F\x93");  // "𝟓"
+        utf16_index += 2;
+        break;
+    }
+  }
+  utf8_offsets.push_back(static_cast<int>(text.length()));
+  utf16_indices.push_back(utf16_index);
+
+  DecodedText decoded_text(text);
+  EXPECT_EQ(FromUtf8(text), decoded_text.utf16_text());
+  for (size_t i = 0; i < utf8_offsets.size(); ++i) {
+    EXPECT_EQ(utf16_indices[i], decoded_text.ToUtf16Index(utf8_offsets[i]));
+    EXPECT_EQ(utf8_offsets[i], decoded_text.ToUtf8Offset(utf16_indices[i]));
+  }
+  // Jumps around the text.
+  for (size_t i = 0; i < utf8_offsets.size(); i += 997) {
+    const size_t j = utf8_offsets.size() - 1 - i;
+    EXPECT_EQ(utf16_indices[j], decoded_text.ToUtf16Index(utf8_offsets[j]));
+    EXPECT_EQ(utf8_offsets[i], decoded_text.ToUtf8Offset(utf16_indices[i]));
+  }
+}
+
+TEST(DecodedTextTest, ConvertsOffsetsOfMostlyAsciiTexts) {
+  // Runs of ASCII characters of all the lengths around the size of the blocks
+  // they are decoded by, between non-ASCII characters.
+  string text;
+  vector<int> utf8_offsets;
+  vector<int> utf16_indices;
+  int utf16_index = 0;
+  for (int i = 0; i < 2000; ++i) {
+    for (int j = 0; j < i % 41; ++j) {
+      utf8_offsets.push_back(static_cast<int>(text.length()));
+      utf16_indices.push_back(utf16_index);
+      text.push_back(static_cast<char>('a' + j % 26));
+      utf16_index += 1;
+    }
+    utf8_offsets.push_back(static_cast<int>(text.length()));
+    utf16_indices.push_back(utf16_index);
+    text.append("\xC3\xA9");  // "é"
+    utf16_index += 1;
+  }
+  utf8_offsets.push_back(static_cast<int>(text.length()));
+  utf16_indices.push_back(utf16_index);
+
+  DecodedText decoded_text(text);
+  EXPECT_EQ(FromUtf8(text), decoded_text.utf16_text());
+  for (size_t i = 0; i < utf8_offsets.size(); ++i) {
+    EXPECT_EQ(utf16_indices[i], decoded_text.ToUtf16Index(utf8_offsets[i]));
+    EXPECT_EQ(utf8_offsets[i], decoded_text.ToUtf8Offset(utf16_indices[i]));
+  }
+}
+
+TEST(DecodedTextTest, FindsDigits) {
+  // "٥" is an Arabic-Indic digit, and "𝟓" takes 2 UTF-16 code units.
+  const string text("Tel. \xD9\xA5\xF0\x9D\x9F\x93 9 and a longer end");
+  const DecodedText decoded_text(text);
+  EXPECT_EQ(5, decoded_text.FindDigit(0));
+  EXPECT_EQ(5, decoded_text.FindDigit(5));
+  EXPECT_EQ(6, decoded_text.FindDigit(6));
+  EXPECT_EQ(9, decoded_text.FindDigit(8));
+  EXPECT_EQ(decoded_text.utf16_text().length(), decoded_text.FindDigit(10));
+  EXPECT_EQ(decoded_text.utf16_text().length(),
+            decoded_text.FindDigit(decoded_text.utf16_text().length()));
+}
+
+TEST(DecodedTextTest, FindsAllTheDecimalDigits) {
+  // The digits are looked for after 16 other characters, to be found by the
+  // searches processing several characters at a time too.
+  const UnicodeString prefix(FromUtf8("Phone number is "));
+  UnicodeString non_digits;
+  for (UChar32 c = 0; c <= 0x10FFFF; ++c) {
+    if (!u_isdigit(c)) {
+      if (c < 0xD800 || (c > 0xDFFF && c <= 0xFFFF)) {
+        non_digits.append(c);
+      }
+      continue;
+    }
+    string text;
+    UnicodeString(prefix).append(c).append(' ').toUTF8String(text);
+    EXPECT_EQ(prefix.length(), DecodedText(text).FindDigit(0)) << c;
+  }
+  string text;
+  non_digits.toUTF8String(text);
+  const DecodedText decoded_text(text);
+  EXPECT_EQ(decoded_text.utf16_text().length(), decoded_text.FindDigit(0));
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
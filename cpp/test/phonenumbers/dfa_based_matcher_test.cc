@@ -0,0 +1,143 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/dfa_based_matcher.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "phonenumbers/metadata.h"
+#include "phonenumbers/phonemetadata.pb.h"
+#include "phonenumbers/regex_based_matcher.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using google::protobuf::RepeatedPtrField;
+using std::string;
+using std::vector;
+
+class DfaBasedMatcherTest : public testing::Test {
+ protected:
+  DfaBasedMatcherTest() {
+    PhoneMetadataCollection metadata_collection;
+    EXPECT_TRUE(
+        metadata_collection.ParseFromArray(metadata_get(), metadata_size()));
+    for (RepeatedPtrField<PhoneMetadata>::const_iterator it =
+             metadata_collection.metadata().begin();
+         it != metadata_collection.metadata().end(); ++it) {
+      AddDesc(it->general_desc());
+      AddDesc(it->fixed_line());
+      AddDesc(it->mobile());
+      AddDesc(it->toll_free());
+      AddDesc(it->premium_rate());
+      AddDesc(it->shared_cost());
+      AddDesc(it->personal_number());
+      AddDesc(it->voip());
+      AddDesc(it->pager());
+      AddDesc(it->uan());
+      AddDesc(it->voicemail());
+      AddDesc(it->no_international_dialling());
+    }
+  }
+
+  void AddDesc(const PhoneNumberDesc& desc) {
+    descs_.push_back(desc);
+    if (desc.has_example_number()) {
+      const string& example = desc.example_number();
+      for (size_t length = 0; length <= example.length() + 2; ++length) {
+        numbers_.push_back(example.substr(0, length));
+      }
+      numbers_.push_back(example + "0");
+      numbers_.push_back(example + "99");
+    }
+  }
+
+  // Checks that both matchers agree on every number for every description.
+  void ExpectSameResults() const {
+    for (vector<PhoneNumberDesc>::const_iterator desc = descs_.begin();
+         desc != descs_.end(); ++desc) {
+      for (vector<string>::const_iterator number = numbers_.begin();
+           number != numbers_.end(); ++number) {
+        EXPECT_EQ(
+            regex_based_matcher_.MatchesNationalNumber(*number, *desc, false),
+            dfa_based_matcher_.MatchesNationalNumber(*number, *desc, false))
+            << *number << " " << desc->national_number_pattern();
+        EXPECT_EQ(
+            regex_based_matcher_.MatchesNationalNumber(*number, *desc, true),
+            dfa_based_matcher_.MatchesNationalNumber(*number, *desc, true))
+            << *number << " " << desc->national_number_pattern();
+        EXPECT_EQ(
+            regex_based_matcher_.MatchesPossibleNumber(*number, *desc),
+            dfa_based_matcher_.MatchesPossibleNumber(*number, *desc))
+            << *number << " " << desc->possible_number_pattern();
+      }
+    }
+  }
+
+  const RegexBasedMatcher regex_based_matcher_;
+  const DfaBasedMatcher dfa_based_matcher_;
+  vector<PhoneNumberDesc> descs_;
+  vector<string> numbers_;
+};
+
+TEST_F(DfaBasedMatcherTest, AgreesWithRegexBasedMatcherOnExampleNumbers) {
+  ExpectSameResults();
+}
+
+TEST_F(DfaBasedMatcherTest, AgreesWithRegexBasedMatcherOnGeneratedNumbers) {
+  numbers_.clear();
+  // Deterministic pseudo-random digit strings of every plausible length.
+  uint32 seed = 12345;
+  for (int i = 0; i < 200; ++i) {
+    string number;
+    for (int length = i % 18; length > 0; --length) {
+      seed = seed * 1103515245 + 12345;
+      number.push_back('0' + (seed >> 16) % 10);
+    }
+    numbers_.push_back(number);
+  }
+  ExpectSameResults();
+}
+
+TEST_F(DfaBasedMatcherTest, FallsBackToRegexForNonDigits) {
+  PhoneNumberDesc desc;
+  desc.set_national_number_pattern("\\d{4}");
+  desc.set_possible_number_pattern("\\d{4}");
+  EXPECT_TRUE(dfa_based_matcher_.MatchesNationalNumber("1234", desc, false));
+  EXPECT_FALSE(dfa_based_matcher_.MatchesNationalNumber("12a4", desc, false));
+  // Full-width digits are matched by \d with the regular expressions.
+  const string full_width_digits("\xEF\xBC\x91\xEF\xBC\x92\xEF\xBC\x93"
+                                 "\xEF\xBC\x94" /* "１２３４" */);
+  EXPECT_EQ(
+      regex_based_matcher_.MatchesNationalNumber(full_width_digits, desc,
+                                                 false),
+      dfa_based_matcher_.MatchesNationalNumber(full_width_digits, desc,
+                                               false));
+}
+
+TEST_F(DfaBasedMatcherTest, FallsBackToRegexForUnsupportedPatterns) {
+  PhoneNumberDesc desc;
+  desc.set_national_number_pattern("(?i)1[2-4]\\d");
+  desc.set_possible_number_pattern("\\d{3}");
+  EXPECT_EQ(regex_based_matcher_.MatchesNationalNumber("112", desc, false),
+            dfa_based_matcher_.MatchesNationalNumber("112", desc, false));
+  EXPECT_EQ(regex_based_matcher_.MatchesNationalNumber("122", desc, false),
+            dfa_based_matcher_.MatchesNationalNumber("122", desc, false));
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
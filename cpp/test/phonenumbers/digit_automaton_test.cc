@@ -0,0 +1,145 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/digit_automaton.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "phonenumbers/base/memory/scoped_ptr.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+
+namespace {
+
+const DigitAutomaton* CreateOrDie(const string& pattern) {
+  const DigitAutomaton* automaton = DigitAutomaton::Create(pattern);
+  EXPECT_TRUE(automaton != NULL) << pattern;
+  return automaton;
+}
+
+bool IsPrefixFree(const string& pattern) {
+  const scoped_ptr<const DigitAutomaton> automaton(CreateOrDie(pattern));
+  return automaton->IsPrefixFree();
+}
+
+}  // namespace
+
+TEST(DigitAutomatonTest, Literals) {
+  const scoped_ptr<const DigitAutomaton> automaton(CreateOrDie("123"));
+  EXPECT_TRUE(automaton->FullMatch("123"));
+  EXPECT_FALSE(automaton->FullMatch("12"));
+  EXPECT_FALSE(automaton->FullMatch("1234"));
+  EXPECT_FALSE(automaton->FullMatch(""));
+  EXPECT_TRUE(automaton->PrefixMatch("1234"));
+  EXPECT_FALSE(automaton->PrefixMatch("12"));
+}
+
+TEST(DigitAutomatonTest, CharacterClasses) {
+  const scoped_ptr<const DigitAutomaton> automaton(
+      CreateOrDie("[2-4][^1-8]\\d"));
+  EXPECT_TRUE(automaton->FullMatch("300"));
+  EXPECT_TRUE(automaton->FullMatch("299"));
+  EXPECT_FALSE(automaton->FullMatch("100"));
+  EXPECT_FALSE(automaton->FullMatch("310"));
+
+  // "[.]" only matches a full stop, never a digit.
+  const scoped_ptr<const DigitAutomaton> full_stop(CreateOrDie("1[.]"));
+  EXPECT_FALSE(full_stop->PrefixMatch("10"));
+}
+
+TEST(DigitAutomatonTest, Quantifiers) {
+  const scoped_ptr<const DigitAutomaton> automaton(
+      CreateOrDie("1\\d{2,3}5?(?:67)*8+9{2}"));
+  EXPECT_TRUE(automaton->FullMatch("1008899"));
+  EXPECT_TRUE(automaton->FullMatch("100056767888899"));
+  EXPECT_FALSE(automaton->FullMatch("18899"));
+  EXPECT_FALSE(automaton->FullMatch("100005899"));
+  EXPECT_FALSE(automaton->FullMatch("10099"));
+  EXPECT_FALSE(automaton->FullMatch("100889"));
+}
+
+TEST(DigitAutomatonTest, Alternations) {
+  const scoped_ptr<const DigitAutomaton> automaton(
+      CreateOrDie("(?:2[0-3]|3(?:1|45))\\d{3}|800\\d{4,5}"));
+  EXPECT_TRUE(automaton->FullMatch("21123"));
+  EXPECT_TRUE(automaton->FullMatch("31123"));
+  EXPECT_TRUE(automaton->FullMatch("345123"));
+  EXPECT_TRUE(automaton->FullMatch("8001234"));
+  EXPECT_TRUE(automaton->FullMatch("80012345"));
+  EXPECT_FALSE(automaton->FullMatch("24123"));
+  EXPECT_FALSE(automaton->FullMatch("800123"));
+  EXPECT_TRUE(automaton->PrefixMatch("211234567"));
+}
+
+TEST(DigitAutomatonTest, PrefixMatchOfEmptyPattern) {
+  const scoped_ptr<const DigitAutomaton> automaton(CreateOrDie("1?"));
+  EXPECT_TRUE(automaton->FullMatch(""));
+  EXPECT_TRUE(automaton->PrefixMatch("2"));
+}
+
+TEST(DigitAutomatonTest, NotApplicablePatternNeverMatches) {
+  const scoped_ptr<const DigitAutomaton> automaton(CreateOrDie("NA"));
+  EXPECT_FALSE(automaton->FullMatch(""));
+  EXPECT_FALSE(automaton->PrefixMatch("123"));
+}
+
+TEST(DigitAutomatonTest, ShortestPrefixMatchLength) {
+  const scoped_ptr<const DigitAutomaton> automaton(
+      CreateOrDie("0(?:0|1[0-9])"));
+  EXPECT_EQ(2, automaton->ShortestPrefixMatchLength("0044", 4));
+  EXPECT_EQ(3, automaton->ShortestPrefixMatchLength("0154", 4));
+  EXPECT_EQ(-1, automaton->ShortestPrefixMatchLength("0154", 2));
+  EXPECT_EQ(-1, automaton->ShortestPrefixMatchLength("1234", 4));
+
+  const scoped_ptr<const DigitAutomaton> optional_automaton(
+      CreateOrDie("0?"));
+  EXPECT_EQ(0, optional_automaton->ShortestPrefixMatchLength("0123", 4));
+  EXPECT_EQ(0, optional_automaton->ShortestPrefixMatchLength("", 0));
+}
+
+TEST(DigitAutomatonTest, IsPrefixFree) {
+  EXPECT_TRUE(IsPrefixFree("0"));
+  EXPECT_TRUE(IsPrefixFree("0(?:0|1[0-9])"));
+  EXPECT_TRUE(IsPrefixFree("NA"));
+  EXPECT_FALSE(IsPrefixFree("0?"));
+  EXPECT_FALSE(IsPrefixFree("00|0011"));
+  EXPECT_FALSE(IsPrefixFree("0\\d*"));
+}
+
+TEST(DigitAutomatonTest, UnsupportedPatterns) {
+  const char* const kUnsupportedPatterns[] = {
+    "^123", "123$", "\\s\\d", "\\D", "(?=1)2", "(1)\\1", "1++", "(?i)1",
+    "[[1-2]3]", "1{2", "1{3,2}", "(12", "12)", "*1", "1|+",
+  };
+  for (size_t i = 0; i < arraysize(kUnsupportedPatterns); ++i) {
+    const scoped_ptr<const DigitAutomaton> automaton(
+        DigitAutomaton::Create(kUnsupportedPatterns[i]));
+    EXPECT_TRUE(automaton.get() == NULL) << kUnsupportedPatterns[i];
+  }
+}
+
+TEST(DigitAutomatonTest, IsAsciiDigitString) {
+  EXPECT_TRUE(IsAsciiDigitString(""));
+  EXPECT_TRUE(IsAsciiDigitString("0123456789"));
+  EXPECT_FALSE(IsAsciiDigitString("12a"));
+  EXPECT_FALSE(IsAsciiDigitString("\xEF\xBC\x91" /* "１" */));
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
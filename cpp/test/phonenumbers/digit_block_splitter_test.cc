@@ -0,0 +1,155 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/digit_block_splitter.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "phonenumbers/base/strings/string_piece.h"
+#include "phonenumbers/phonemetadata.pb.h"
+#include "phonenumbers/phonenumberutil.h"
+#include "phonenumbers/stringutil.h"
+#include "phonenumbers/test_util.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using google::protobuf::RepeatedPtrField;
+using std::string;
+using std::vector;
+
+class DigitBlockSplitterTest : public testing::Test {
+ protected:
+  DigitBlockSplitterTest()
+      : phone_util_(*PhoneNumberUtil::GetInstance()) {}
+
+  // Returns the digit blocks of the national number found by the splitter, or
+  // a single "?" block if the layout of the format is not known.
+  vector<string> Split(const string& national_number,
+                       const NumberFormat& format) const {
+    vector<StringPiece> pieces;
+    vector<string> blocks;
+    if (!splitter_.Split(national_number, format, &pieces)) {
+      blocks.push_back("?");
+    }
+    for (vector<StringPiece>::const_iterator it = pieces.begin();
+         it != pieces.end(); ++it) {
+      blocks.push_back(it->as_string());
+    }
+    return blocks;
+  }
+
+  // Returns the digit blocks of the national number formatted in RFC3966.
+  vector<string> FormatAndSplit(const string& national_number,
+                                const NumberFormat& format) const {
+    string formatted_number;
+    phone_util_.FormatNsnUsingPattern(national_number, format,
+                                      PhoneNumberUtil::RFC3966,
+                                      &formatted_number);
+    vector<string> blocks;
+    SplitStringUsing(formatted_number, "-", &blocks);
+    return blocks;
+  }
+
+  // Checks the splitter agrees with the formatting of numbers of all the
+  // lengths, for the formats whose layout is known, and returns their number.
+  int CheckFormats(const RepeatedPtrField<NumberFormat>& formats) const {
+    int num_known_layouts = 0;
+    for (RepeatedPtrField<NumberFormat>::const_iterator it = formats.begin();
+         it != formats.end(); ++it) {
+      vector<StringPiece> blocks;
+      if (!splitter_.Split("", *it, &blocks)) {
+        continue;
+      }
+      ++num_known_layouts;
+      string national_number;
+      for (int length = 0; length <= 20; ++length) {
+        SCOPED_TRACE(it->pattern() + " " + it->format() + " " +
+                     national_number);
+        EXPECT_EQ(FormatAndSplit(national_number, *it),
+                  Split(national_number, *it));
+        national_number.push_back(static_cast<char>('0' + length * 7 % 10));
+      }
+    }
+    return num_known_layouts;
+  }
+
+  const PhoneNumberUtil& phone_util_;
+  const DigitBlockSplitter splitter_;
+};
+
+TEST_F(DigitBlockSplitterTest, SplitsNumbersWithKnownLayouts) {
+  const NumberFormat format = MakeFormat("(\\d{3})(\\d{3,4})", "$1-$2");
+  vector<string> expected_blocks;
+  EXPECT_EQ(expected_blocks, Split("", format));
+  expected_blocks.push_back("12345");
+  EXPECT_EQ(expected_blocks, Split("12345", format));
+
+  expected_blocks.clear();
+  expected_blocks.push_back("123");
+  expected_blocks.push_back("456");
+  EXPECT_EQ(expected_blocks, Split("123456", format));
+
+  // The second group takes as many digits as it can, and the ones left are
+  // not separated from it.
+  expected_blocks.back() = "4567890";
+  EXPECT_EQ(expected_blocks, Split("1234567890", format));
+
+  // The pattern is replaced again after its first match.
+  expected_blocks.push_back("123");
+  EXPECT_EQ(expected_blocks, Split("1234567890123", format));
+
+  const NumberFormat single_digits =
+      MakeFormat("(\\d)(\\d\\d)(\\d{1,2}\\d)", "$1 / $2.$3");
+  expected_blocks.clear();
+  expected_blocks.push_back("1");
+  expected_blocks.push_back("23");
+  expected_blocks.push_back("456");
+  EXPECT_EQ(expected_blocks, Split("123456", single_digits));
+  EXPECT_EQ(FormatAndSplit("123456", single_digits),
+            Split("123456", single_digits));
+}
+
+TEST_F(DigitBlockSplitterTest, DoesNotSplitNumbersWithUnknownLayouts) {
+  const vector<string> unknown(1, "?");
+  // Patterns which are not only made of groups of digits.
+  EXPECT_EQ(unknown, Split("1234567", MakeFormat("(\\d{3}|\\d{2})(\\d{4})",
+                                                "$1 $2")));
+  EXPECT_EQ(unknown, Split("1234567", MakeFormat("(\\d{3})\\d(\\d{3})",
+                                                "$1 $2")));
+  EXPECT_EQ(unknown, Split("1234567", MakeFormat("(\\d{3})(\\d{4,})",
+                                                "$1 $2")));
+  // Formats which don't join all the groups in order with punctuation.
+  EXPECT_EQ(unknown, Split("1234567", MakeFormat("(\\d{3})(\\d{4})",
+                                                "$2 $1")));
+  EXPECT_EQ(unknown, Split("1234567", MakeFormat("(\\d{3})(\\d{4})",
+                                                "$1$2")));
+  EXPECT_EQ(unknown, Split("1234567", MakeFormat("(\\d{3})(\\d{4})",
+                                                "($1) $2")));
+  EXPECT_EQ(unknown, Split("1234567", MakeFormat("(\\d{3})(\\d{4})",
+                                                "$1 15-$2")));
+  EXPECT_EQ(unknown, Split("1234567", MakeFormat("(\\d{3})(\\d{4})", "$1")));
+}
+
+TEST_F(DigitBlockSplitterTest, AgreesWithFormattingForAllFormats) {
+  RepeatedPtrField<NumberFormat> formats;
+  ASSERT_TRUE(GetAllNumberFormats(&formats));
+  EXPECT_LT(0, CheckFormats(formats));
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -16,9 +16,13 @@
 
 #include "phonenumbers/geocoding/phonenumber_offline_geocoder.h"
 
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 #include <unicode/locid.h>
 
+#include "phonenumbers/base/threading/simple_thread.h"
 #include "phonenumbers/geocoding/geocoding_test_data.h"
 #include "phonenumbers/phonenumber.h"
 #include "phonenumbers/phonenumber.pb.h"
@@ -27,6 +31,8 @@ namespace i18n {
 namespace phonenumbers {
 
 using icu::Locale;
+using std::string;
+using std::vector;
 
 namespace {
 
@@ -44,6 +50,56 @@ const Locale kItalianLocale = Locale("it", "IT");
 const Locale kKoreanLocale = Locale("ko", "KR");
 const Locale kSimplifiedChineseLocale = Locale("zh", "CN");
 
+PhoneNumberOfflineGeocoder* CreateTestGeocoder() {
+  return new PhoneNumberOfflineGeocoder(
+      get_test_country_calling_codes(),
+      get_test_country_calling_codes_size(),
+      get_test_country_languages,
+      get_test_prefix_language_code_pairs(),
+      get_test_prefix_language_code_pairs_size(),
+      get_test_prefix_descriptions);
+}
+
+// Describes a set of numbers in a set of languages over and over, and counts
+// the descriptions which differ from the expected ones.
+class DescriptionChecker : public SimpleThread::Delegate {
+ public:
+  DescriptionChecker(const PhoneNumberOfflineGeocoder& geocoder,
+                     const vector<PhoneNumber>& numbers,
+                     const vector<Locale>& locales,
+                     const vector<string>& expected_descriptions)
+      : geocoder_(geocoder),
+        numbers_(numbers),
+        locales_(locales),
+        expected_descriptions_(expected_descriptions),
+        num_mismatches_(0) {}
+
+  virtual void Run() {
+    for (int i = 0; i < 20; ++i) {
+      size_t description_index = 0;
+      for (size_t j = 0; j < numbers_.size(); ++j) {
+        for (size_t k = 0; k < locales_.size(); ++k) {
+          if (geocoder_.GetDescriptionForNumber(numbers_[j], locales_[k]) !=
+              expected_descriptions_[description_index++]) {
+            ++num_mismatches_;
+          }
+        }
+      }
+    }
+  }
+
+  int num_mismatches() const {
+    return num_mismatches_;
+  }
+
+ private:
+  const PhoneNumberOfflineGeocoder& geocoder_;
+  const vector<PhoneNumber>& numbers_;
+  const vector<Locale>& locales_;
+  const vector<string>& expected_descriptions_;
+  int num_mismatches_;
+};
+
 }  // namespace
 
 class PhoneNumberOfflineGeocoderTest : public testing::Test {
@@ -65,14 +121,7 @@ class PhoneNumberOfflineGeocoderTest : public testing::Test {
   }
 
   virtual void SetUp() {
-    geocoder_.reset(
-        new PhoneNumberOfflineGeocoder(
-            get_test_country_calling_codes(),
-            get_test_country_calling_codes_size(),
-            get_test_country_languages,
-            get_test_prefix_language_code_pairs(),
-            get_test_prefix_language_code_pairs_size(),
-            get_test_prefix_descriptions));
+    geocoder_.reset(CreateTestGeocoder());
   }
 
  protected:
@@ -200,5 +249,73 @@ TEST_F(PhoneNumberOfflineGeocoderTest, TestGetDescriptionForInvalidNumber) {
                                                    kEnglishLocale));
 }
 
+TEST_F(PhoneNumberOfflineGeocoderTest, TestLoadAllAreaCodeMaps) {
+  geocoder_->LoadAllAreaCodeMaps();
+  EXPECT_EQ("Mountain View, CA",
+            geocoder_->GetDescriptionForNumber(US_NUMBER2, Locale("en", "US")));
+  EXPECT_EQ("Kalifornien",
+            geocoder_->GetDescriptionForNumber(US_NUMBER1, kGermanLocale));
+  // "\uC11C\uC6B8"
+  EXPECT_EQ("\xec""\x84""\x9c""\xec""\x9a""\xb8",
+            geocoder_->GetDescriptionForNumber(KO_NUMBER1, kKoreanLocale));
+  EXPECT_EQ("Australia",
+            geocoder_->GetDescriptionForNumber(AU_NUMBER, Locale("en", "US")));
+  // Loading the maps again is a no-op.
+  geocoder_->LoadAllAreaCodeMaps();
+  EXPECT_EQ("Seoul",
+            geocoder_->GetDescriptionForNumber(KO_NUMBER1, kEnglishLocale));
+}
+
+TEST_F(PhoneNumberOfflineGeocoderTest, TestConcurrentGetDescriptionForNumber) {
+  vector<PhoneNumber> numbers;
+  numbers.push_back(KO_NUMBER1);
+  numbers.push_back(KO_NUMBER2);
+  numbers.push_back(KO_NUMBER3);
+  numbers.push_back(KO_INVALID_NUMBER);
+  numbers.push_back(US_NUMBER1);
+  numbers.push_back(US_NUMBER2);
+  numbers.push_back(US_NUMBER3);
+  numbers.push_back(US_NUMBER4);
+  numbers.push_back(BS_NUMBER1);
+  numbers.push_back(AU_NUMBER);
+  numbers.push_back(INTERNATIONAL_TOLL_FREE);
+  vector<Locale> locales;
+  locales.push_back(kEnglishLocale);
+  locales.push_back(kFrenchLocale);
+  locales.push_back(kGermanLocale);
+  locales.push_back(kItalianLocale);
+  locales.push_back(kKoreanLocale);
+  locales.push_back(kSimplifiedChineseLocale);
+  // The expected descriptions are computed with another geocoder, so that the
+  // threads below start with none of the maps loaded.
+  const scoped_ptr<PhoneNumberOfflineGeocoder> reference_geocoder(
+      CreateTestGeocoder());
+  vector<string> expected_descriptions;
+  for (size_t i = 0; i < numbers.size(); ++i) {
+    for (size_t j = 0; j < locales.size(); ++j) {
+      expected_descriptions.push_back(
+          reference_geocoder->GetDescriptionForNumber(numbers[i], locales[j]));
+    }
+  }
+
+  const int kNumThreads = 16;
+  vector<DescriptionChecker*> checkers;
+  vector<SimpleThread*> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    checkers.push_back(new DescriptionChecker(*geocoder_, numbers, locales,
+                                              expected_descriptions));
+    threads.push_back(new SimpleThread(checkers.back()));
+  }
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads[i]->Start();
+  }
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads[i]->Join();
+    EXPECT_EQ(0, checkers[i]->num_mismatches());
+    delete threads[i];
+    delete checkers[i];
+  }
+}
+
 }  // namespace phonenumbers
 }  // namespace i18n
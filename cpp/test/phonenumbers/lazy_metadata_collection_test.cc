@@ -0,0 +1,82 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/lazy_metadata_collection.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "phonenumbers/metadata.h"
+#include "phonenumbers/phonemetadata.pb.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+
+class LazyMetadataCollectionTest : public testing::Test {
+ protected:
+  LazyMetadataCollectionTest() {
+    EXPECT_TRUE(
+        metadata_collection_.ParseFromArray(metadata_get(), metadata_size()));
+  }
+
+  PhoneMetadataCollection metadata_collection_;
+};
+
+TEST_F(LazyMetadataCollectionTest, IndexesAllEntries) {
+  LazyMetadataCollection collection;
+  ASSERT_TRUE(collection.Init(metadata_get(), metadata_size()));
+  ASSERT_EQ(metadata_collection_.metadata_size(), collection.size());
+  for (int i = 0; i < collection.size(); ++i) {
+    const PhoneMetadata& metadata = metadata_collection_.metadata(i);
+    EXPECT_EQ(metadata.id(), collection.id(i));
+    EXPECT_EQ(metadata.country_code(), collection.country_code(i));
+    EXPECT_EQ(metadata.main_country_for_code(),
+              collection.main_country_for_code(i));
+  }
+}
+
+TEST_F(LazyMetadataCollectionTest, GetParsesEntriesOnce) {
+  LazyMetadataCollection collection;
+  ASSERT_TRUE(collection.Init(metadata_get(), metadata_size()));
+  for (int i = 0; i < collection.size(); ++i) {
+    const PhoneMetadata* const metadata = collection.Get(i);
+    ASSERT_TRUE(metadata != NULL);
+    EXPECT_EQ(metadata_collection_.metadata(i).SerializeAsString(),
+              metadata->SerializeAsString());
+    EXPECT_EQ(metadata, collection.Get(i));
+  }
+}
+
+TEST_F(LazyMetadataCollectionTest, EmptyCollection) {
+  LazyMetadataCollection collection;
+  EXPECT_TRUE(collection.Init("", 0));
+  EXPECT_EQ(0, collection.size());
+}
+
+TEST_F(LazyMetadataCollectionTest, RejectsMalformedData) {
+  const string data(static_cast<const char*>(metadata_get()), metadata_size());
+  // Truncates the last entry.
+  LazyMetadataCollection truncated_collection;
+  EXPECT_FALSE(truncated_collection.Init(data.data(), data.size() - 1));
+  // A length-delimited field whose length exceeds the data.
+  const char kBadLength[] = "\x0a\x7f";
+  LazyMetadataCollection bad_length_collection;
+  EXPECT_FALSE(bad_length_collection.Init(kBadLength, sizeof(kBadLength) - 1));
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -0,0 +1,112 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/normalize_digits.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+
+namespace {
+
+string StripNonDigits(const string& number) {
+  string normalized_number(number);
+  StripNonDigitsAndNormalize(&normalized_number);
+  return normalized_number;
+}
+
+}  // namespace
+
+TEST(NormalizeDigitsTest, StripNonDigitsAndNormalizeAscii) {
+  EXPECT_EQ("", StripNonDigits(""));
+  EXPECT_EQ("", StripNonDigits("abc-()"));
+  EXPECT_EQ("6502530000", StripNonDigits("(650) 253-0000"));
+  // Long enough to be processed by blocks, with a tail.
+  EXPECT_EQ("12345678901234567890", StripNonDigits("12345678901234567890"));
+  EXPECT_EQ("12345678901234567890",
+            StripNonDigits("+1 (234) 567-8901 ext. 234 567 890"));
+  EXPECT_EQ("0123456789012345",
+            StripNonDigits("0123456789012345xxxxxxxxxxxxxxxx"));
+}
+
+TEST(NormalizeDigitsTest, StripNonDigitsAndNormalizeNonAscii) {
+  // Full-width digits.
+  EXPECT_EQ("12", StripNonDigits("\xEF\xBC\x91\xEF\xBC\x92"  /* "１２" */));
+  // Arabic-Indic digits.
+  EXPECT_EQ("15", StripNonDigits("\xD9\xA1\xD9\xA5"  /* "١٥" */));
+  // Eastern Arabic digits.
+  EXPECT_EQ("15", StripNonDigits("\xDB\xB1\xDB\xB5"  /* "۱۵" */));
+  // A non-ASCII character in the middle of a long ASCII run.
+  EXPECT_EQ("0123456789123456789",
+            StripNonDigits("01234-56789-\xEF\xBC\x91" "23-45678-9"));
+  // Non-digit non-ASCII characters are removed.
+  EXPECT_EQ("6502530000",
+            StripNonDigits("\xEF\xBC\x8B" "650 \xE2\x80\x93 253 0000"
+                           /* "＋650 – 253 0000" */));
+  // Invalid UTF-8 is skipped one byte at a time.
+  EXPECT_EQ("12", StripNonDigits("1\xEF\xBC" "2"));
+  EXPECT_EQ("12", StripNonDigits("1\xFF" "2\x80"));
+}
+
+TEST(NormalizeDigitsTest, GetDigitValue) {
+  EXPECT_EQ(0, GetDigitValue('0'));
+  EXPECT_EQ(9, GetDigitValue('9'));
+  // Full-width digits.
+  EXPECT_EQ(1, GetDigitValue(0xFF11));
+  // Arabic-Indic digits.
+  EXPECT_EQ(5, GetDigitValue(0x0665));
+  EXPECT_EQ(-1, GetDigitValue('+'));
+  EXPECT_EQ(-1, GetDigitValue('a'));
+  EXPECT_EQ(-1, GetDigitValue(0xFF0B));
+  // Numbers which are not decimal digits, like the superscript two.
+  EXPECT_EQ(-1, GetDigitValue(0x00B2));
+}
+
+TEST(NormalizeDigitsTest, CountAsciiLetters) {
+  EXPECT_EQ(0U, CountAsciiLetters(""));
+  EXPECT_EQ(0U, CountAsciiLetters("+1 650 253 0000 @[`{"));
+  EXPECT_EQ(7U, CountAsciiLetters("1-800-FLOWERS"));
+  EXPECT_EQ(26U, CountAsciiLetters("abcdefghijklmnopqrstuvwxyz"));
+  EXPECT_EQ(26U, CountAsciiLetters("ABCDEFGHIJKLMNOPQRSTUVWXYZ"));
+  // Letters which are not ASCII aren't counted.
+  EXPECT_EQ(2U, CountAsciiLetters("\xEF\xBC\xA1" "AB" /* "ＡAB" */));
+}
+
+TEST(NormalizeDigitsTest, IsAsciiString) {
+  EXPECT_TRUE(IsAsciiString(""));
+  EXPECT_TRUE(IsAsciiString("+1 650 253 0000"));
+  EXPECT_TRUE(IsAsciiString("+1 (650) 253-0000 ext. 1234"));
+  EXPECT_FALSE(IsAsciiString("\xEF\xBC\x8B" "1"));
+  EXPECT_FALSE(IsAsciiString("+1 (650) 253-0000 \xD9\xA1"));
+}
+
+TEST(NormalizeDigitsTest, GetLeadingPlusCharsLength) {
+  EXPECT_EQ(0U, GetLeadingPlusCharsLength(""));
+  EXPECT_EQ(0U, GetLeadingPlusCharsLength("1+"));
+  EXPECT_EQ(0U, GetLeadingPlusCharsLength(" +1"));
+  EXPECT_EQ(1U, GetLeadingPlusCharsLength("+1"));
+  EXPECT_EQ(2U, GetLeadingPlusCharsLength("++"));
+  EXPECT_EQ(3U, GetLeadingPlusCharsLength("\xEF\xBC\x8B" "1"));
+  EXPECT_EQ(4U, GetLeadingPlusCharsLength("+\xEF\xBC\x8B" "1"));
+  // An incomplete full-width plus sign.
+  EXPECT_EQ(1U, GetLeadingPlusCharsLength("+\xEF\xBC"));
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -0,0 +1,169 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/number_format_selector.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "phonenumbers/base/memory/scoped_ptr.h"
+#include "phonenumbers/metadata.h"
+#include "phonenumbers/number_type_classifier.h"
+#include "phonenumbers/phonemetadata.pb.h"
+#include "phonenumbers/regexp_adapter.h"
+#include "phonenumbers/regexp_cache.h"
+#include "phonenumbers/regexp_factory.h"
+#include "phonenumbers/test_util.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+using std::vector;
+
+class NumberFormatSelectorTest : public testing::Test {
+ protected:
+  NumberFormatSelectorTest() : regexp_cache_(regexp_factory_, 128) {
+    EXPECT_TRUE(
+        metadata_collection_.ParseFromArray(metadata_get(), metadata_size()));
+  }
+
+  static NumberFormat* AddFormat(const string& pattern,
+                                 const string& leading_digits_pattern,
+                                 RepeatedPtrField<NumberFormat>* formats) {
+    NumberFormat* const format = formats->Add();
+    *format = MakeFormat(pattern, "$1 $2");
+    if (!leading_digits_pattern.empty()) {
+      format->add_leading_digits_pattern(leading_digits_pattern);
+    }
+    return format;
+  }
+
+  // Returns the format chosen for the number the way PhoneNumberUtil does it
+  // with regular expressions.
+  const NumberFormat* ChooseFormatUsingRegExps(
+      const RepeatedPtrField<NumberFormat>& formats,
+      const string& national_number) {
+    for (RepeatedPtrField<NumberFormat>::const_iterator it = formats.begin();
+         it != formats.end(); ++it) {
+      const int size = it->leading_digits_pattern_size();
+      if (size > 0) {
+        const scoped_ptr<RegExpInput> input(
+            regexp_factory_.CreateInput(national_number));
+        if (!regexp_cache_.GetRegExp(
+                it->leading_digits_pattern(size - 1)).Consume(input.get())) {
+          continue;
+        }
+      }
+      if (regexp_cache_.GetRegExp(it->pattern()).FullMatch(national_number)) {
+        return &*it;
+      }
+    }
+    return NULL;
+  }
+
+  // Checks the selector chooses the same formats as the regular expressions
+  // for the numbers.
+  void CheckFormats(const RepeatedPtrField<NumberFormat>& formats,
+                    const vector<string>& numbers) {
+    for (vector<string>::const_iterator it = numbers.begin();
+         it != numbers.end(); ++it) {
+      const NumberFormat* format = NULL;
+      ASSERT_TRUE(selector_.ChooseFormat(formats, *it, &format)) << *it;
+      EXPECT_EQ(ChooseFormatUsingRegExps(formats, *it), format) << *it;
+    }
+  }
+
+  const RegExpFactory regexp_factory_;
+  RegExpCache regexp_cache_;
+  const NumberFormatSelector selector_;
+  PhoneMetadataCollection metadata_collection_;
+};
+
+TEST_F(NumberFormatSelectorTest, ChoosesTheFirstMatchingFormat) {
+  RepeatedPtrField<NumberFormat> formats;
+  const NumberFormat* const mobile =
+      AddFormat("(\\d{3})(\\d{4})", "7(?:[01]|2[0-4])", &formats);
+  const NumberFormat* const fixed_line =
+      AddFormat("(\\d)(\\d{6})", "[2-8]", &formats);
+  const NumberFormat* const other =
+      AddFormat("(\\d{4})(\\d{3,4})", "", &formats);
+
+  const NumberFormat* format = NULL;
+  ASSERT_TRUE(selector_.ChooseFormat(formats, "7123456", &format));
+  EXPECT_EQ(mobile, format);
+  // The leading digits of the first format don't match.
+  ASSERT_TRUE(selector_.ChooseFormat(formats, "7256789", &format));
+  EXPECT_EQ(fixed_line, format);
+  // Only the leading digits of the first format match.
+  ASSERT_TRUE(selector_.ChooseFormat(formats, "71234567", &format));
+  EXPECT_EQ(other, format);
+  ASSERT_TRUE(selector_.ChooseFormat(formats, "9123456", &format));
+  EXPECT_EQ(other, format);
+  ASSERT_TRUE(selector_.ChooseFormat(formats, "912345", &format));
+  EXPECT_TRUE(format == NULL);
+  ASSERT_TRUE(selector_.ChooseFormat(formats, "", &format));
+  EXPECT_TRUE(format == NULL);
+}
+
+TEST_F(NumberFormatSelectorTest, FallsBackForUnsupportedFormats) {
+  RepeatedPtrField<NumberFormat> formats;
+  AddFormat("(\\d{3})(\\d{4})", "[2-9]", &formats);
+  const NumberFormat* format = NULL;
+  // Non-ASCII digits.
+  EXPECT_FALSE(selector_.ChooseFormat(
+      formats, "\xD9\xA2\xD9\xA3\xD9\xA4" "4567", &format));
+
+  RepeatedPtrField<NumberFormat> unsupported_formats;
+  AddFormat("(\\d{3})(\\d{4})", "[2-9]", &unsupported_formats);
+  AddFormat("(?i)(\\d{3})(\\d{4})", "", &unsupported_formats);
+  EXPECT_FALSE(
+      selector_.ChooseFormat(unsupported_formats, "2345678", &format));
+}
+
+TEST_F(NumberFormatSelectorTest, AgreesWithRegExpsForAllFormats) {
+  for (int i = 0; i < metadata_collection_.metadata_size(); ++i) {
+    const PhoneMetadata& metadata = metadata_collection_.metadata(i);
+    SCOPED_TRACE(metadata.id());
+    vector<string> numbers;
+    for (int desc_type = 0;
+         desc_type < NumberTypeClassifier::NUM_DESC_TYPES; ++desc_type) {
+      const PhoneNumberDesc& desc = NumberTypeClassifier::GetDesc(
+          metadata, static_cast<NumberTypeClassifier::DescType>(desc_type));
+      if (desc.has_example_number()) {
+        const string& example = desc.example_number();
+        numbers.push_back(example);
+        numbers.push_back(example.substr(0, example.length() - 1));
+        numbers.push_back(example + "1");
+      }
+    }
+    // Numbers of several lengths starting with all the pairs of digits.
+    for (int prefix = 0; prefix < 100; ++prefix) {
+      string number(1, static_cast<char>('0' + prefix / 10));
+      number.push_back(static_cast<char>('0' + prefix % 10));
+      for (int length = 2; length <= 12; ++length) {
+        numbers.push_back(number);
+        number.push_back(static_cast<char>('0' + (prefix + length) % 10));
+      }
+    }
+    numbers.push_back("");
+    CheckFormats(metadata.number_format(), numbers);
+    CheckFormats(metadata.intl_number_format(), numbers);
+  }
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -0,0 +1,129 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/number_type_classifier.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "phonenumbers/metadata.h"
+#include "phonenumbers/phonemetadata.pb.h"
+#include "phonenumbers/regex_based_matcher.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+using std::vector;
+
+class NumberTypeClassifierTest : public testing::Test {
+ protected:
+  NumberTypeClassifierTest() : classifier_(regex_based_matcher_) {
+    EXPECT_TRUE(
+        metadata_collection_.ParseFromArray(metadata_get(), metadata_size()));
+  }
+
+  // Returns the descriptions matched by the number, testing them one by one.
+  uint32 GetMatchingDescsOneByOne(const string& national_number,
+                                  const PhoneMetadata& metadata) const {
+    uint32 matching_descs = 0;
+    for (int desc_type = 0;
+         desc_type < NumberTypeClassifier::NUM_DESC_TYPES; ++desc_type) {
+      const PhoneNumberDesc& desc = NumberTypeClassifier::GetDesc(
+          metadata, static_cast<NumberTypeClassifier::DescType>(desc_type));
+      if (regex_based_matcher_.MatchesPossibleNumber(national_number, desc) &&
+          regex_based_matcher_.MatchesNationalNumber(national_number, desc,
+                                                     false)) {
+        matching_descs |= 1U << desc_type;
+      }
+    }
+    return matching_descs;
+  }
+
+  const RegexBasedMatcher regex_based_matcher_;
+  const NumberTypeClassifier classifier_;
+  PhoneMetadataCollection metadata_collection_;
+};
+
+TEST_F(NumberTypeClassifierTest, AgreesWithMatchingDescsOneByOne) {
+  for (int i = 0; i < metadata_collection_.metadata_size(); ++i) {
+    const PhoneMetadata& metadata = metadata_collection_.metadata(i);
+    vector<string> numbers;
+    for (int desc_type = 0;
+         desc_type < NumberTypeClassifier::NUM_DESC_TYPES; ++desc_type) {
+      const PhoneNumberDesc& desc = NumberTypeClassifier::GetDesc(
+          metadata, static_cast<NumberTypeClassifier::DescType>(desc_type));
+      if (desc.has_example_number()) {
+        const string& example = desc.example_number();
+        numbers.push_back(example);
+        numbers.push_back(example.substr(0, example.length() - 1));
+        numbers.push_back(example + "1");
+      }
+    }
+    numbers.push_back("");
+    numbers.push_back("0");
+    for (vector<string>::const_iterator it = numbers.begin();
+         it != numbers.end(); ++it) {
+      EXPECT_EQ(GetMatchingDescsOneByOne(*it, metadata),
+                classifier_.GetMatchingDescs(*it, metadata))
+          << metadata.id() << " " << *it;
+    }
+  }
+}
+
+TEST_F(NumberTypeClassifierTest, ReportsEveryMatchingDesc) {
+  PhoneMetadata metadata;
+  metadata.mutable_general_desc()->set_national_number_pattern("[2-9]\\d{3}");
+  metadata.mutable_general_desc()->set_possible_number_pattern("\\d{4}");
+  metadata.mutable_fixed_line()->set_national_number_pattern("[2-5]\\d{3}");
+  metadata.mutable_fixed_line()->set_possible_number_pattern("\\d{4}");
+  metadata.mutable_mobile()->set_national_number_pattern("[5-9]\\d{3}");
+  metadata.mutable_mobile()->set_possible_number_pattern("\\d{4}");
+  // The national number pattern matches but not the possible number pattern.
+  metadata.mutable_toll_free()->set_national_number_pattern("8\\d{3}");
+  metadata.mutable_toll_free()->set_possible_number_pattern("\\d{5}");
+
+  EXPECT_EQ(1U << NumberTypeClassifier::GENERAL_DESC |
+            1U << NumberTypeClassifier::FIXED_LINE,
+            classifier_.GetMatchingDescs("2345", metadata));
+  EXPECT_EQ(1U << NumberTypeClassifier::GENERAL_DESC |
+            1U << NumberTypeClassifier::FIXED_LINE |
+            1U << NumberTypeClassifier::MOBILE,
+            classifier_.GetMatchingDescs("5678", metadata));
+  EXPECT_EQ(1U << NumberTypeClassifier::GENERAL_DESC |
+            1U << NumberTypeClassifier::MOBILE,
+            classifier_.GetMatchingDescs("8000", metadata));
+  EXPECT_EQ(0U, classifier_.GetMatchingDescs("1234", metadata));
+  EXPECT_EQ(0U, classifier_.GetMatchingDescs("23456", metadata));
+}
+
+TEST_F(NumberTypeClassifierTest, FallsBackForUnsupportedPatterns) {
+  PhoneMetadata metadata;
+  metadata.mutable_general_desc()->set_national_number_pattern(
+      "(?i)[2-9]\\d{3}");
+  metadata.mutable_general_desc()->set_possible_number_pattern("\\d{4}");
+  metadata.mutable_fixed_line()->set_national_number_pattern("[2-5]\\d{3}");
+  metadata.mutable_fixed_line()->set_possible_number_pattern("\\d{4}");
+
+  EXPECT_EQ(1U << NumberTypeClassifier::GENERAL_DESC |
+            1U << NumberTypeClassifier::FIXED_LINE,
+            classifier_.GetMatchingDescs("2345", metadata));
+  EXPECT_EQ(1U << NumberTypeClassifier::GENERAL_DESC,
+            classifier_.GetMatchingDescs("6789", metadata));
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -0,0 +1,127 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/phonenumberbulkprocessor.h"
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/phonenumber.pb.h"
+#include "phonenumbers/phonenumberutil.h"
+#include "phonenumbers/test_util.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+using std::vector;
+
+class PhoneNumberBulkProcessorTest : public testing::Test {
+ protected:
+  PhoneNumberBulkProcessorTest()
+      : phone_util_(*PhoneNumberUtil::GetInstance()) {}
+
+  // Returns num_numbers numbers cycling through valid, invalid and unparsable
+  // ones, in different formats.
+  static vector<string> GetNumbersToParse(size_t num_numbers) {
+    static const char* const kNumbers[] = {
+      "+6433316005",
+      "03-331 6005",
+      "+64 3 331 6005",
+      "+1 650 253 0000",
+      "+44 7912 345 678",
+      "+800 1234 5678",
+      "+39 02 3661 8300",
+      "1-800-FLOWERS",
+      "+1 234 567 8901",
+      "123",
+      "This is not a phone number",
+      "",
+    };
+    vector<string> numbers;
+    for (size_t i = 0; i < num_numbers; ++i) {
+      numbers.push_back(kNumbers[i % arraysize(kNumbers)]);
+    }
+    return numbers;
+  }
+
+  // Processes the numbers on num_threads threads, and checks the results
+  // against the ones of the sequential calls to PhoneNumberUtil.
+  void CheckProcess(int num_threads, const vector<string>& numbers_to_parse,
+                    vector<BulkProcessingResult>* results) const {
+    const PhoneNumberBulkProcessor processor(num_threads);
+    processor.Process(numbers_to_parse, RegionCode::NZ(), results);
+    ASSERT_EQ(numbers_to_parse.size(), results->size());
+    for (size_t i = 0; i < numbers_to_parse.size(); ++i) {
+      const BulkProcessingResult& result = (*results)[i];
+      PhoneNumber number;
+      const PhoneNumberUtil::ErrorType error =
+          phone_util_.Parse(numbers_to_parse[i], RegionCode::NZ(), &number);
+      ASSERT_EQ(error, result.error) << numbers_to_parse[i];
+      if (error != PhoneNumberUtil::NO_PARSING_ERROR) {
+        EXPECT_EQ(PhoneNumber(), result.number);
+        EXPECT_FALSE(result.is_valid);
+        EXPECT_EQ(PhoneNumberUtil::UNKNOWN, result.type);
+        EXPECT_EQ("", result.e164_number);
+        continue;
+      }
+      EXPECT_EQ(number, result.number) << numbers_to_parse[i];
+      EXPECT_EQ(phone_util_.IsValidNumber(number), result.is_valid)
+          << numbers_to_parse[i];
+      EXPECT_EQ(phone_util_.GetNumberType(number), result.type)
+          << numbers_to_parse[i];
+      string e164_number;
+      phone_util_.Format(number, PhoneNumberUtil::E164, &e164_number);
+      EXPECT_EQ(e164_number, result.e164_number) << numbers_to_parse[i];
+    }
+  }
+
+  const PhoneNumberUtil& phone_util_;
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(PhoneNumberBulkProcessorTest);
+};
+
+TEST_F(PhoneNumberBulkProcessorTest, ProcessSingleThread) {
+  vector<BulkProcessingResult> results;
+  CheckProcess(1, GetNumbersToParse(0), &results);
+  CheckProcess(1, GetNumbersToParse(1), &results);
+  CheckProcess(1, GetNumbersToParse(500), &results);
+}
+
+TEST_F(PhoneNumberBulkProcessorTest, ProcessMultipleThreads) {
+  vector<BulkProcessingResult> results;
+  // Fewer numbers than threads.
+  CheckProcess(4, GetNumbersToParse(3), &results);
+  // Numbers which don't split evenly between the threads.
+  CheckProcess(3, GetNumbersToParse(1001), &results);
+  CheckProcess(8, GetNumbersToParse(5000), &results);
+}
+
+TEST_F(PhoneNumberBulkProcessorTest, ProcessReusesResults) {
+  const PhoneNumberBulkProcessor processor(2);
+  vector<BulkProcessingResult> results;
+  processor.Process(GetNumbersToParse(300), RegionCode::NZ(), &results);
+  // The results of the previous call are overwritten, including those of the
+  // numbers which failed to parse.
+  vector<string> numbers_to_parse = GetNumbersToParse(200);
+  numbers_to_parse.insert(numbers_to_parse.begin(), "This is not a number");
+  CheckProcess(2, numbers_to_parse, &results);
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -93,6 +93,22 @@ class PhoneNumberMatcherTest : public testing::Test {
     return matcher_.ExtractMatch(text, offset_, match);
   }
 
+  // Returns the offsets and the raw strings of the matches found in text,
+  // skipping the text without digits if skip_text_without_digits is true.
+  vector<string> FindMatches(const string& text,
+                             bool skip_text_without_digits) const {
+    PhoneNumberMatcher matcher(phone_util_, text, RegionCode::US(),
+                               PhoneNumberMatcher::POSSIBLE, 100);
+    matcher.skip_text_without_digits_ = skip_text_without_digits;
+    vector<string> matches;
+    PhoneNumberMatch match;
+    while (matcher.Next(&match)) {
+      matches.push_back(
+          StrCat(SimpleItoa(match.start()), ":", match.raw_string()));
+    }
+    return matches;
+  }
+
   PhoneNumberMatcher* GetMatcherWithLeniency(
       const string& text, const string& region,
       PhoneNumberMatcher::Leniency leniency) const {
@@ -1222,5 +1238,17 @@ TEST_F(PhoneNumberMatcherTest, DoubleIteration_WithNextOnly) {
   EXPECT_FALSE(matcher->Next(&match));
 }
 
+TEST_F(PhoneNumberMatcherTest, SkippingTextWithoutDigitsKeepsMatches) {
+  const string text =
+      "Some prose ((((((((((650) 253-0000, more prose, "
+      "\xEF\xBC\x96\xEF\xBC\x95\xEF\xBC\x90" /* "６５０" */
+      " 253 0001 and "
+      "+1 650 253 0002 ext. 42; finally (650) 253-0003";
+  const vector<string> matches = FindMatches(text, true);
+  EXPECT_EQ(4U, matches.size());
+  EXPECT_EQ(FindMatches(text, false), matches);
+  EXPECT_TRUE(FindMatches("Only prose here.", true).empty());
+}
+
 }  // namespace phonenumbers
 }  // namespace i18n
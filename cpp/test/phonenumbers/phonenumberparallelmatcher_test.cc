@@ -0,0 +1,134 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/phonenumberparallelmatcher.h"
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/phonenumbermatch.h"
+#include "phonenumbers/phonenumbermatcher.h"
+#include "phonenumbers/phonenumberutil.h"
+#include "phonenumbers/stl_util.h"
+#include "phonenumbers/test_util.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+using std::vector;
+
+class PhoneNumberParallelMatcherTest : public testing::Test {
+ protected:
+  PhoneNumberParallelMatcherTest()
+      : phone_util_(*PhoneNumberUtil::GetInstance()) {}
+
+  // Returns a text of about length bytes with phone numbers, things which
+  // look like phone numbers and non-ASCII characters.
+  static string GetText(size_t length) {
+    static const char* const kParagraphs[] = {
+      "Call 650-253-0000 or (650) 253-0001, or fax +1 650 253 0002. ",
+      "Z\xC3\xBCrich: +41 44 668 18 00; Rechnung Nr. 2011-3344 vom "
+      "3/10/2011. ",
+      "Meeting on 2012-01-02 08:00:30 in room 1234, ext. 42 at "
+      "800 555 0199 x 42. ",
+      "\xE9\x9B\xBB\xE8\xA9\xB1\xEF\xBC\x9A\xEF\xBC\x96\xEF\xBC\x95\xEF\xBC"
+      "\x90\xEF\xBC\x8D\xEF\xBC\x92\xEF\xBC\x95\xEF\xBC\x93\xEF\xBC\x8D\xEF"
+      "\xBC\x90\xEF\xBC\x90\xEF\xBC\x90\xEF\xBC\x90 abc8005001234 "
+      "8005001234def. ",
+      "(650) 223 3345 (754) 223 3321 x 3324451234 8002341234 12345 - "
+      "332-445-1234 651-234-2345/332-445-1234 *2345 +972 2345. ",
+    };
+    string text;
+    for (size_t i = 0; text.length() < length; ++i) {
+      text.append(kParagraphs[i % arraysize(kParagraphs)]);
+      text.append(i % 7, ' ');
+    }
+    return text;
+  }
+
+  // Checks the matches found on num_threads threads, with segments of
+  // segment_length bytes, are the same as the ones of PhoneNumberMatcher.
+  void CheckMatches(const string& text, int num_threads, int segment_length,
+                    PhoneNumberMatcher::Leniency leniency) const {
+    PhoneNumberParallelMatcher parallel_matcher(phone_util_, RegionCode::US(),
+                                                leniency, num_threads);
+    parallel_matcher.segment_length_ = segment_length;
+    vector<PhoneNumberMatch*> matches;
+    parallel_matcher.FindNumbers(text, &matches);
+
+    PhoneNumberMatcher matcher(phone_util_, text, RegionCode::US(), leniency,
+                               std::numeric_limits<int>::max());
+    PhoneNumberMatch match;
+    for (vector<PhoneNumberMatch*>::const_iterator it = matches.begin();
+         it != matches.end(); ++it) {
+      ASSERT_TRUE(matcher.Next(&match))
+          << "Unexpected match: " << (*it)->ToString();
+      EXPECT_TRUE(match.Equals(**it))
+          << "Expected " << match.ToString() << ", got " << (*it)->ToString();
+    }
+    EXPECT_FALSE(matcher.HasNext()) << matches.size() << " matches found";
+    STLDeleteElements(&matches);
+  }
+
+  const PhoneNumberUtil& phone_util_;
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(PhoneNumberParallelMatcherTest);
+};
+
+TEST_F(PhoneNumberParallelMatcherTest, FindsNoNumbersInEmptyText) {
+  const PhoneNumberParallelMatcher matcher(phone_util_, RegionCode::US(),
+                                           PhoneNumberMatcher::VALID, 4);
+  vector<PhoneNumberMatch*> matches;
+  matcher.FindNumbers("", &matches);
+  EXPECT_TRUE(matches.empty());
+}
+
+TEST_F(PhoneNumberParallelMatcherTest, MatchesAreTheSameAsPhoneNumberMatcher) {
+  const string text = GetText(30000);
+  // Segments shorter than the overlaps, segments which don't start on
+  // character boundaries, and segments longer than the text.
+  const int segment_lengths[] = { 997, 4096, 10000, 100000 };
+  for (size_t i = 0; i < arraysize(segment_lengths); ++i) {
+    SCOPED_TRACE(segment_lengths[i]);
+    CheckMatches(text, 1, segment_lengths[i], PhoneNumberMatcher::VALID);
+    CheckMatches(text, 3, segment_lengths[i], PhoneNumberMatcher::VALID);
+  }
+  CheckMatches(text, 4, 1000, PhoneNumberMatcher::POSSIBLE);
+  CheckMatches(text, 4, 1000, PhoneNumberMatcher::EXACT_GROUPING);
+}
+
+TEST_F(PhoneNumberParallelMatcherTest, SearchesSegmentsAgainWithoutOverlap) {
+  // A sequence of digits and spaces longer than the overlap between the
+  // segments, which the search of a segment starting in its middle splits
+  // into other candidates.
+  string text = GetText(3000);
+  for (int i = 0; i < 3000; ++i) {
+    text.append("1 ");
+  }
+  text.append(GetText(3000));
+  const int segment_lengths[] = { 1000, 2345, 4000 };
+  for (size_t i = 0; i < arraysize(segment_lengths); ++i) {
+    SCOPED_TRACE(segment_lengths[i]);
+    CheckMatches(text, 2, segment_lengths[i], PhoneNumberMatcher::POSSIBLE);
+  }
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -0,0 +1,170 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/phonenumberstreammatcher.h"
+
+#include <algorithm>
+#include <limits>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/phonenumbermatch.h"
+#include "phonenumbers/phonenumbermatcher.h"
+#include "phonenumbers/phonenumberutil.h"
+#include "phonenumbers/test_util.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+
+class PhoneNumberStreamMatcherTest : public testing::Test {
+ protected:
+  PhoneNumberStreamMatcherTest()
+      : phone_util_(*PhoneNumberUtil::GetInstance()) {}
+
+  // Returns a text of about length bytes with phone numbers, things which
+  // look like phone numbers and non-ASCII characters, at offsets which vary
+  // relatively to the parts the text is searched by.
+  static string GetText(size_t length) {
+    static const char* const kParagraphs[] = {
+      "Call 650-253-0000 or (650) 253-0001, or fax +1 650 253 0002. ",
+      "Z\xC3\xBCrich: +41 44 668 18 00; Rechnung Nr. 2011-3344 vom "
+      "3/10/2011. ",
+      "Meeting on 2012-01-02 08:00:30 in room 1234, ext. 42 at "
+      "800 555 0199 x 42. ",
+      "\xE9\x9B\xBB\xE8\xA9\xB1\xEF\xBC\x9A\xEF\xBC\x96\xEF\xBC\x95\xEF\xBC"
+      "\x90\xEF\xBC\x8D\xEF\xBC\x92\xEF\xBC\x95\xEF\xBC\x93\xEF\xBC\x8D\xEF"
+      "\xBC\x90\xEF\xBC\x90\xEF\xBC\x90\xEF\xBC\x90 abc8005001234 "
+      "8005001234def. ",
+      "(650) 223 3345 (754) 223 3321 x 3324451234 8002341234 12345 - "
+      "332-445-1234 651-234-2345/332-445-1234 *2345 +972 2345. ",
+    };
+    string text;
+    for (size_t i = 0; text.length() < length; ++i) {
+      text.append(kParagraphs[i % arraysize(kParagraphs)]);
+      text.append(i % 7, ' ');
+    }
+    return text;
+  }
+
+  // Checks the matches found in text fed by chunks of chunk_length bytes are
+  // the same as the ones of PhoneNumberMatcher.
+  void CheckMatches(const string& text, size_t chunk_length,
+                    PhoneNumberMatcher::Leniency leniency,
+                    int max_tries) const {
+    PhoneNumberStreamMatcher stream_matcher(phone_util_, RegionCode::US(),
+                                            leniency, max_tries);
+    PhoneNumberMatcher matcher(phone_util_, text, RegionCode::US(), leniency,
+                               max_tries);
+    PhoneNumberMatch stream_match;
+    PhoneNumberMatch match;
+    int num_matches = 0;
+    for (size_t i = 0; i < text.length() + chunk_length; i += chunk_length) {
+      if (i < text.length()) {
+        stream_matcher.Feed(text.substr(i, chunk_length));
+      } else {
+        stream_matcher.Finish();
+      }
+      while (stream_matcher.Next(&stream_match)) {
+        ASSERT_TRUE(matcher.Next(&match))
+            << "Unexpected match: " << stream_match.ToString();
+        EXPECT_TRUE(match.Equals(stream_match))
+            << "Expected " << match.ToString() << ", got "
+            << stream_match.ToString();
+        ++num_matches;
+      }
+    }
+    EXPECT_FALSE(matcher.HasNext()) << num_matches << " matches found";
+  }
+
+  static size_t GetBufferedLength(const PhoneNumberStreamMatcher& matcher) {
+    return matcher.buffer_.length();
+  }
+
+  const PhoneNumberUtil& phone_util_;
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(PhoneNumberStreamMatcherTest);
+};
+
+TEST_F(PhoneNumberStreamMatcherTest, FindsNumbersSplitByChunks) {
+  PhoneNumberStreamMatcher matcher(RegionCode::US());
+  PhoneNumberMatch match;
+  matcher.Feed("Call 650-25");
+  matcher.Feed("3-0000 or +1 650 253 00");
+  EXPECT_FALSE(matcher.HasNext());
+  // "。" split by two chunks.
+  matcher.Feed("01\xE3\x80");
+  matcher.Feed("\x82 42");
+  matcher.Finish();
+
+  ASSERT_TRUE(matcher.Next(&match));
+  EXPECT_EQ(5, match.start());
+  EXPECT_EQ("650-253-0000", match.raw_string());
+  ASSERT_TRUE(matcher.Next(&match));
+  EXPECT_EQ(21, match.start());
+  EXPECT_EQ("+1 650 253 0001", match.raw_string());
+  EXPECT_FALSE(matcher.Next(&match));
+}
+
+TEST_F(PhoneNumberStreamMatcherTest, FindsNoNumbersInEmptyText) {
+  PhoneNumberStreamMatcher matcher(RegionCode::US());
+  PhoneNumberMatch match;
+  matcher.Feed("");
+  matcher.Finish();
+  EXPECT_FALSE(matcher.HasNext());
+  EXPECT_FALSE(matcher.Next(&match));
+}
+
+TEST_F(PhoneNumberStreamMatcherTest, MatchesAreTheSameAsPhoneNumberMatcher) {
+  const string text = GetText(50000);
+  const size_t chunk_lengths[] = { 1, 7, 1000, 4096, 20000, text.length() };
+  for (size_t i = 0; i < arraysize(chunk_lengths); ++i) {
+    SCOPED_TRACE(chunk_lengths[i]);
+    CheckMatches(text, chunk_lengths[i], PhoneNumberMatcher::VALID,
+                 std::numeric_limits<int>::max());
+  }
+  CheckMatches(text, 999, PhoneNumberMatcher::POSSIBLE,
+               std::numeric_limits<int>::max());
+  CheckMatches(text, 999, PhoneNumberMatcher::EXACT_GROUPING,
+               std::numeric_limits<int>::max());
+}
+
+TEST_F(PhoneNumberStreamMatcherTest, LimitsRetriesOverTheWholeText) {
+  const string text = GetText(50000);
+  CheckMatches(text, 100, PhoneNumberMatcher::VALID, 1);
+  CheckMatches(text, 100, PhoneNumberMatcher::VALID, 500);
+}
+
+TEST_F(PhoneNumberStreamMatcherTest, KeepsOnlyTheEndOfTheText) {
+  const string text = GetText(20000);
+  PhoneNumberStreamMatcher matcher(RegionCode::US());
+  PhoneNumberMatch match;
+  size_t max_buffered_length = 0;
+  for (int i = 0; i < 50; ++i) {
+    matcher.Feed(text);
+    while (matcher.Next(&match)) {}
+    max_buffered_length =
+        std::max(max_buffered_length, GetBufferedLength(matcher));
+  }
+  EXPECT_GT(20000U, max_buffered_length);
+  matcher.Finish();
+  EXPECT_EQ(0U, GetBufferedLength(matcher));
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
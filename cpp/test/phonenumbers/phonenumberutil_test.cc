@@ -34,6 +34,7 @@
 #include "phonenumbers/phonemetadata.pb.h"
 #include "phonenumbers/phonenumber.h"
 #include "phonenumbers/phonenumber.pb.h"
+#include "phonenumbers/preparedphonenumber.h"
 #include "phonenumbers/test_util.h"
 
 namespace i18n {
@@ -123,6 +124,21 @@ class PhoneNumberUtilTest : public testing::Test {
     return phone_util_.MaybeStripExtension(number, extension);
   }
 
+  bool MaybeParseE164Number(const string& number_to_parse,
+                            const string& default_region,
+                            PhoneNumber* phone_number) const {
+    return phone_util_.MaybeParseE164Number(number_to_parse, default_region,
+                                            phone_number);
+  }
+
+  // Parses the number without the fast path of Parse().
+  PhoneNumberUtil::ErrorType ParseHelper(const string& number_to_parse,
+                                         const string& default_region,
+                                         PhoneNumber* phone_number) const {
+    return phone_util_.ParseHelper(number_to_parse, default_region, false,
+                                   true, phone_number);
+  }
+
   PhoneNumberUtil::ErrorType MaybeExtractCountryCode(
       const PhoneMetadata* default_region_metadata,
       bool keep_raw_input,
@@ -173,6 +189,26 @@ TEST_F(PhoneNumberUtilTest, GetSupportedRegions) {
   EXPECT_GT(regions.size(), 0U);
 }
 
+TEST_F(PhoneNumberUtilTest, PrecompilePatterns) {
+  PhoneNumberUtil::PatternPrecompilationStats stats;
+  phone_util_.PrecompilePatterns(4, &stats);
+  set<string> regions;
+  GetSupportedRegions(&regions);
+  // The non-geographical entities are precompiled as well.
+  EXPECT_LT(regions.size(), static_cast<size_t>(stats.num_metadata));
+  EXPECT_GE(stats.elapsed_microseconds, 0);
+
+  // Precompiling again only hits the caches.
+  phone_util_.PrecompilePatterns(1, NULL);
+
+  PhoneNumber us_number;
+  us_number.set_country_code(1);
+  us_number.set_national_number(6502530000ULL);
+  EXPECT_TRUE(phone_util_.IsValidNumber(us_number));
+  EXPECT_EQ(PhoneNumberUtil::FIXED_LINE_OR_MOBILE,
+            phone_util_.GetNumberType(us_number));
+}
+
 TEST_F(PhoneNumberUtilTest, GetRegionCodesForCountryCallingCode) {
   list<string> regions;
 
@@ -1264,6 +1300,58 @@ TEST_F(PhoneNumberUtilTest, FormatNumberWithExtension) {
   EXPECT_EQ("650 253 0000 extn. 4567", formatted_number);
 }
 
+TEST_F(PhoneNumberUtilTest, AppendFormattedNumber) {
+  PhoneNumber nz_number;
+  nz_number.set_country_code(64);
+  nz_number.set_national_number(33316005ULL);
+  nz_number.set_extension("1234");
+  PhoneNumber it_number;
+  it_number.set_country_code(39);
+  it_number.set_national_number(236618300ULL);
+  it_number.set_italian_leading_zero(true);
+  string formatted_numbers("[");
+  phone_util_.AppendFormattedNumber(nz_number, PhoneNumberUtil::E164,
+                                    &formatted_numbers);
+  formatted_numbers.push_back(',');
+  phone_util_.AppendFormattedNumber(nz_number, PhoneNumberUtil::INTERNATIONAL,
+                                    &formatted_numbers);
+  formatted_numbers.push_back(',');
+  phone_util_.AppendFormattedNumber(nz_number, PhoneNumberUtil::NATIONAL,
+                                    &formatted_numbers);
+  formatted_numbers.push_back(',');
+  phone_util_.AppendFormattedNumber(nz_number, PhoneNumberUtil::RFC3966,
+                                    &formatted_numbers);
+  formatted_numbers.push_back(',');
+  phone_util_.AppendFormattedNumber(it_number, PhoneNumberUtil::E164,
+                                    &formatted_numbers);
+  formatted_numbers.push_back(',');
+  phone_util_.AppendFormattedNumber(it_number, PhoneNumberUtil::RFC3966,
+                                    &formatted_numbers);
+  formatted_numbers.push_back(']');
+  EXPECT_EQ("[+6433316005,+64 3-331 6005 ext. 1234,03-331 6005 ext. 1234,"
+            "tel:+64-3-331-6005;ext=1234,+390236618300,tel:+39-02-3661-8300]",
+            formatted_numbers);
+
+  // Appends the same as what Format() sets.
+  PhoneNumber ar_number;
+  ar_number.set_country_code(54);
+  ar_number.set_national_number(91187654321ULL);
+  string formatted_number;
+  for (int number_format = PhoneNumberUtil::E164;
+       number_format <= PhoneNumberUtil::RFC3966; ++number_format) {
+    phone_util_.Format(ar_number,
+                       static_cast<PhoneNumberUtil::PhoneNumberFormat>(
+                           number_format),
+                       &formatted_number);
+    formatted_numbers.assign("prefix ");
+    phone_util_.AppendFormattedNumber(
+        ar_number, static_cast<PhoneNumberUtil::PhoneNumberFormat>(
+            number_format),
+        &formatted_numbers);
+    EXPECT_EQ("prefix " + formatted_number, formatted_numbers);
+  }
+}
+
 TEST_F(PhoneNumberUtilTest, GetLengthOfGeographicalAreaCode) {
   PhoneNumber number;
   // Google MTV, which has area code "650".
@@ -2933,6 +3021,60 @@ TEST_F(PhoneNumberUtilTest, IsNumberMatchShortNsnMatches) {
             phone_util_.IsNumberMatch(it_number_1, it_number_2));
 }
 
+TEST_F(PhoneNumberUtilTest, IsNumberMatchWithPreparedNumbers) {
+  static const char* const kNumbers[] = {
+    "+64 3 331 6005", "+64 03 331-6005", "03 331 6005", "3 331-6005",
+    "331 6005", "+64 3 331-6005 extn 1234", "+64 3 331-6005 ext.1235",
+    "3 331 6005#1234", "tel:331-6005;phone-context=abc.nz", "+800 1234 5678",
+    "+1 234-567 8901", "1 234-567 8901", "234 567 8901", "+1800 siX-Flags",
+    "+39 02 3661 8300", "02 3661 8300", "+43", "Dog", "4", "",
+  };
+  const size_t kNumNumbers = arraysize(kNumbers);
+  PreparedPhoneNumber prepared_strings[kNumNumbers];
+  PreparedPhoneNumber prepared_numbers[kNumNumbers];
+  PhoneNumber numbers[kNumNumbers];
+  for (size_t i = 0; i < kNumNumbers; ++i) {
+    phone_util_.PrepareNumberForMatching(kNumbers[i], &prepared_strings[i]);
+    phone_util_.Parse(kNumbers[i], RegionCode::NZ(), &numbers[i]);
+    phone_util_.PrepareNumberForMatching(numbers[i], &prepared_numbers[i]);
+  }
+  // Twice, the second time with the parsings cached in the prepared numbers.
+  for (int pass = 0; pass < 2; ++pass) {
+    for (size_t i = 0; i < kNumNumbers; ++i) {
+      for (size_t j = 0; j < kNumNumbers; ++j) {
+        EXPECT_EQ(
+            phone_util_.IsNumberMatchWithTwoStrings(kNumbers[i], kNumbers[j]),
+            phone_util_.IsNumberMatch(prepared_strings[i],
+                                      prepared_strings[j]))
+            << kNumbers[i] << " / " << kNumbers[j];
+        EXPECT_EQ(
+            phone_util_.IsNumberMatchWithOneString(numbers[i], kNumbers[j]),
+            phone_util_.IsNumberMatch(prepared_numbers[i],
+                                      prepared_strings[j]))
+            << numbers[i] << " / " << kNumbers[j];
+        EXPECT_EQ(phone_util_.IsNumberMatch(numbers[i], numbers[j]),
+                  phone_util_.IsNumberMatch(prepared_numbers[i],
+                                            prepared_numbers[j]))
+            << numbers[i] << " / " << numbers[j];
+      }
+    }
+  }
+  EXPECT_EQ(PhoneNumberUtil::NSN_MATCH,
+            phone_util_.IsNumberMatch(prepared_strings[0],
+                                      prepared_strings[2]));
+  EXPECT_EQ(PhoneNumberUtil::SHORT_NSN_MATCH,
+            phone_util_.IsNumberMatch(prepared_strings[0],
+                                      prepared_strings[4]));
+  EXPECT_EQ(PhoneNumberUtil::INVALID_NUMBER,
+            phone_util_.IsNumberMatch(prepared_strings[0],
+                                      prepared_strings[17]));
+
+  // A number which wasn't prepared doesn't match anything.
+  const PreparedPhoneNumber unprepared_number;
+  EXPECT_EQ(PhoneNumberUtil::INVALID_NUMBER,
+            phone_util_.IsNumberMatch(unprepared_number, prepared_numbers[0]));
+}
+
 TEST_F(PhoneNumberUtilTest, ParseNationalNumber) {
   PhoneNumber nz_number;
   nz_number.set_country_code(64);
@@ -3531,6 +3673,145 @@ TEST_F(PhoneNumberUtilTest, ParseNumbersWithPlusWithNoRegion) {
   EXPECT_EQ(nz_number, result_proto);
 }
 
+TEST_F(PhoneNumberUtilTest, MaybeParseE164Number) {
+  PhoneNumber nz_number;
+  nz_number.set_country_code(64);
+  nz_number.set_national_number(33316005ULL);
+  PhoneNumber test_number;
+  EXPECT_TRUE(MaybeParseE164Number("+6433316005", RegionCode::GetUnknown(),
+                                   &test_number));
+  EXPECT_EQ(nz_number, test_number);
+  // The default region doesn't matter.
+  EXPECT_TRUE(MaybeParseE164Number("+6433316005", RegionCode::US(),
+                                   &test_number));
+  EXPECT_EQ(nz_number, test_number);
+
+  PhoneNumber it_number;
+  it_number.set_country_code(39);
+  it_number.set_national_number(236618300ULL);
+  it_number.set_italian_leading_zero(true);
+  EXPECT_TRUE(MaybeParseE164Number("+390236618300", RegionCode::NZ(),
+                                   &test_number));
+  EXPECT_EQ(it_number, test_number);
+
+  PhoneNumber toll_free_number;
+  toll_free_number.set_country_code(800);
+  toll_free_number.set_national_number(12345678ULL);
+  EXPECT_TRUE(MaybeParseE164Number("+80012345678", RegionCode::UN001(),
+                                   &test_number));
+  EXPECT_EQ(toll_free_number, test_number);
+
+  // Anything else than a plus sign followed by digits is left to the full
+  // parsing, as are the numbers which are too short or too long.
+  test_number.Clear();
+  EXPECT_FALSE(MaybeParseE164Number("+64 3 331 6005", RegionCode::NZ(),
+                                    &test_number));
+  EXPECT_FALSE(MaybeParseE164Number("6433316005", RegionCode::NZ(),
+                                    &test_number));
+  EXPECT_FALSE(MaybeParseE164Number(" +6433316005", RegionCode::NZ(),
+                                    &test_number));
+  EXPECT_FALSE(MaybeParseE164Number("\xEF\xBC\x8B" "6433316005",
+                                    /* "＋6433316005" */
+                                    RegionCode::NZ(), &test_number));
+  EXPECT_FALSE(MaybeParseE164Number("+6433316005;ext=1", RegionCode::NZ(),
+                                    &test_number));
+  EXPECT_FALSE(MaybeParseE164Number("+64", RegionCode::NZ(), &test_number));
+  EXPECT_FALSE(MaybeParseE164Number("+643", RegionCode::NZ(), &test_number));
+  EXPECT_FALSE(MaybeParseE164Number("+6433316005123456789", RegionCode::NZ(),
+                                    &test_number));
+  EXPECT_FALSE(MaybeParseE164Number("+06433316005", RegionCode::NZ(),
+                                    &test_number));
+  // The national prefix for parsing of Argentina, which ParseHelper() would
+  // try to strip.
+  EXPECT_FALSE(MaybeParseE164Number("+5401187654321", RegionCode::AR(),
+                                    &test_number));
+  EXPECT_EQ(PhoneNumber(), test_number);
+
+  // The fast path parses the example numbers exactly as the full parsing does.
+  set<string> regions;
+  GetSupportedRegions(&regions);
+  int num_fast_path_numbers = 0;
+  for (set<string>::const_iterator it = regions.begin(); it != regions.end();
+       ++it) {
+    PhoneNumber example_number;
+    if (!phone_util_.GetExampleNumber(*it, &example_number)) {
+      continue;
+    }
+    string e164_number;
+    phone_util_.Format(example_number, PhoneNumberUtil::E164, &e164_number);
+    PhoneNumber fast_path_number;
+    if (!MaybeParseE164Number(e164_number, *it, &fast_path_number)) {
+      continue;
+    }
+    ++num_fast_path_numbers;
+    PhoneNumber expected_number;
+    EXPECT_EQ(PhoneNumberUtil::NO_PARSING_ERROR,
+              ParseHelper(e164_number, *it, &expected_number));
+    EXPECT_EQ(expected_number, fast_path_number) << e164_number;
+  }
+  EXPECT_GT(num_fast_path_numbers, 0);
+}
+
+TEST_F(PhoneNumberUtilTest, ParseBatch) {
+  const string numbers_to_parse[] = {
+    "+6433316005",
+    "03-331 6005",
+    "+64 3 331 6005",
+    "\xEF\xBC\x8B" "\xEF\xBC\x96\xEF\xBC\x94" "33316005",
+    /* "＋６４33316005" */
+    "+5401187654321",
+    "011 8765-4321",
+    "This is not a phone number",
+    "",
+    "+80012345678",
+  };
+  const string default_regions[] = {
+    RegionCode::GetUnknown(),
+    RegionCode::NZ(),
+    RegionCode::GetUnknown(),
+    RegionCode::NZ(),
+    RegionCode::AR(),
+    RegionCode::AR(),
+    RegionCode::NZ(),
+    RegionCode::NZ(),
+    RegionCode::US(),
+  };
+  const size_t num_numbers = arraysize(numbers_to_parse);
+  ASSERT_EQ(num_numbers, arraysize(default_regions));
+
+  PhoneNumber numbers[arraysize(numbers_to_parse)];
+  PhoneNumberUtil::ErrorType errors[arraysize(numbers_to_parse)];
+  phone_util_.ParseBatch(numbers_to_parse, default_regions, num_numbers,
+                         numbers, errors);
+  for (size_t i = 0; i < num_numbers; ++i) {
+    PhoneNumber expected_number;
+    EXPECT_EQ(phone_util_.Parse(numbers_to_parse[i], default_regions[i],
+                                &expected_number),
+              errors[i]) << numbers_to_parse[i];
+    if (errors[i] == PhoneNumberUtil::NO_PARSING_ERROR) {
+      EXPECT_EQ(expected_number, numbers[i]) << numbers_to_parse[i];
+    }
+  }
+  EXPECT_EQ(PhoneNumberUtil::NO_PARSING_ERROR, errors[0]);
+  EXPECT_EQ(PhoneNumberUtil::NOT_A_NUMBER, errors[6]);
+
+  // All the numbers are parsed with the same default region.
+  phone_util_.ParseBatch(numbers_to_parse, RegionCode::NZ(), num_numbers,
+                         numbers, errors);
+  for (size_t i = 0; i < num_numbers; ++i) {
+    PhoneNumber expected_number;
+    EXPECT_EQ(phone_util_.Parse(numbers_to_parse[i], RegionCode::NZ(),
+                                &expected_number),
+              errors[i]) << numbers_to_parse[i];
+    if (errors[i] == PhoneNumberUtil::NO_PARSING_ERROR) {
+      EXPECT_EQ(expected_number, numbers[i]) << numbers_to_parse[i];
+    }
+  }
+
+  // An empty batch is a no-op.
+  phone_util_.ParseBatch(NULL, RegionCode::NZ(), 0, NULL, NULL);
+}
+
 TEST_F(PhoneNumberUtilTest, ParseNumberTooShortIfNationalPrefixStripped) {
   PhoneNumber test_number;
 
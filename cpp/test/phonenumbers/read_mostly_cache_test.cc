@@ -0,0 +1,101 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/read_mostly_cache.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "phonenumbers/base/basictypes.h"
+#include "phonenumbers/stringutil.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::string;
+
+namespace {
+
+// Counts the live instances, to check that the cache deletes its values.
+class Value {
+ public:
+  explicit Value(int id) : id_(id) { ++instances_; }
+  ~Value() { --instances_; }
+
+  int id() const { return id_; }
+
+  static int instances_;
+
+ private:
+  const int id_;
+
+  DISALLOW_COPY_AND_ASSIGN(Value);
+};
+
+int Value::instances_ = 0;
+
+}  // namespace
+
+TEST(ReadMostlyCacheTest, FindInsertedValues) {
+  ReadMostlyCache<string, Value> cache(2);
+  const Value* value;
+  EXPECT_FALSE(cache.Find("foo", &value));
+
+  const Value* const foo = new Value(1);
+  EXPECT_EQ(foo, cache.Insert("foo", foo));
+  ASSERT_TRUE(cache.Find("foo", &value));
+  EXPECT_EQ(foo, value);
+  EXPECT_FALSE(cache.Find("bar", &value));
+  EXPECT_EQ(1U, cache.size());
+}
+
+TEST(ReadMostlyCacheTest, KeepsFirstInsertedValue) {
+  ReadMostlyCache<string, Value> cache(2);
+  const Value* const first = new Value(1);
+  cache.Insert("foo", first);
+  // The second value is deleted by the cache.
+  EXPECT_EQ(first, cache.Insert("foo", new Value(2)));
+  EXPECT_EQ(1, Value::instances_);
+  EXPECT_EQ(1U, cache.size());
+}
+
+TEST(ReadMostlyCacheTest, CachesNullValues) {
+  ReadMostlyCache<const void*, Value> cache(2);
+  EXPECT_TRUE(cache.Insert(&cache, NULL) == NULL);
+  const Value dummy(0);
+  const Value* value = &dummy;
+  ASSERT_TRUE(cache.Find(&cache, &value));
+  EXPECT_TRUE(value == NULL);
+}
+
+TEST(ReadMostlyCacheTest, GrowsAndDeletesValues) {
+  {
+    ReadMostlyCache<string, Value> cache(2);
+    for (int i = 0; i < 1000; ++i) {
+      cache.Insert(SimpleItoa(i), new Value(i));
+    }
+    EXPECT_EQ(1000U, cache.size());
+    EXPECT_EQ(1000, Value::instances_);
+    for (int i = 0; i < 1000; ++i) {
+      const Value* value = NULL;
+      ASSERT_TRUE(cache.Find(SimpleItoa(i), &value));
+      EXPECT_EQ(i, value->id());
+    }
+  }
+  EXPECT_EQ(0, Value::instances_);
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -19,7 +19,6 @@
 
 #include <gtest/gtest.h>
 
-#include "phonenumbers/base/synchronization/lock.h"
 #include "phonenumbers/regexp_cache.h"
 #include "phonenumbers/regexp_factory.h"
 
@@ -40,9 +39,8 @@ class RegExpCacheTest : public testing::Test {
 };
 
 TEST_F(RegExpCacheTest, CacheConstructor) {
-  AutoLock l(cache_.lock_);  
   ASSERT_TRUE(cache_.cache_impl_ != NULL);
-  EXPECT_TRUE(cache_.cache_impl_->empty());
+  EXPECT_EQ(0U, cache_.cache_impl_->size());
 }
 
 TEST_F(RegExpCacheTest, GetRegExp) {
@@ -0,0 +1,106 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/region_index.h"
+
+#include <list>
+#include <set>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace i18n {
+namespace phonenumbers {
+
+using std::list;
+using std::set;
+using std::string;
+
+TEST(RegionIndexTest, IsIndexableRegionCode) {
+  EXPECT_TRUE(RegionIndex::IsIndexableRegionCode("AA"));
+  EXPECT_TRUE(RegionIndex::IsIndexableRegionCode("ZZ"));
+  EXPECT_FALSE(RegionIndex::IsIndexableRegionCode(""));
+  EXPECT_FALSE(RegionIndex::IsIndexableRegionCode("U"));
+  EXPECT_FALSE(RegionIndex::IsIndexableRegionCode("us"));
+  EXPECT_FALSE(RegionIndex::IsIndexableRegionCode("USA"));
+  EXPECT_FALSE(RegionIndex::IsIndexableRegionCode("001"));
+}
+
+TEST(RegionIndexTest, FindRegion) {
+  RegionIndex index;
+  index.AddRegion("US", 3);
+  index.AddRegion("AA", 0);
+  index.AddRegion("ZZ", 7);
+  // The first metadata added for a region is kept.
+  index.AddRegion("US", 4);
+
+  EXPECT_EQ(3, index.FindRegion("US"));
+  EXPECT_EQ(0, index.FindRegion("AA"));
+  EXPECT_EQ(7, index.FindRegion("ZZ"));
+  EXPECT_EQ(-1, index.FindRegion("CA"));
+  EXPECT_EQ(-1, index.FindRegion("us"));
+  EXPECT_EQ(-1, index.FindRegion("001"));
+  EXPECT_EQ(-1, index.FindRegion(""));
+
+  set<string> regions;
+  index.GetRegions(&regions);
+  ASSERT_EQ(3U, regions.size());
+  set<string>::const_iterator it = regions.begin();
+  EXPECT_EQ("AA", *it++);
+  EXPECT_EQ("US", *it++);
+  EXPECT_EQ("ZZ", *it++);
+}
+
+TEST(RegionIndexTest, FindNonGeographicalEntity) {
+  RegionIndex index;
+  index.AddNonGeographicalEntity(800, 2);
+  index.AddNonGeographicalEntity(RegionIndex::kMaxCountryCallingCode, 5);
+
+  EXPECT_EQ(2, index.FindNonGeographicalEntity(800));
+  EXPECT_EQ(5, index.FindNonGeographicalEntity(
+      RegionIndex::kMaxCountryCallingCode));
+  EXPECT_EQ(-1, index.FindNonGeographicalEntity(808));
+  EXPECT_EQ(-1, index.FindNonGeographicalEntity(-1));
+  EXPECT_EQ(-1, index.FindNonGeographicalEntity(1000));
+}
+
+TEST(RegionIndexTest, GetRegionsForCountryCallingCode) {
+  RegionIndex index;
+  list<string> nanpa_regions;
+  nanpa_regions.push_back("US");
+  nanpa_regions.push_back("BS");
+  index.SetRegionsForCountryCallingCode(1, nanpa_regions);
+  index.SetRegionsForCountryCallingCode(44, list<string>(1, "GB"));
+
+  size_t num_region_codes;
+  const string* region_codes =
+      index.GetRegionsForCountryCallingCode(1, &num_region_codes);
+  ASSERT_EQ(2U, num_region_codes);
+  EXPECT_EQ("US", region_codes[0]);
+  EXPECT_EQ("BS", region_codes[1]);
+
+  region_codes = index.GetRegionsForCountryCallingCode(44, &num_region_codes);
+  ASSERT_EQ(1U, num_region_codes);
+  EXPECT_EQ("GB", region_codes[0]);
+
+  index.GetRegionsForCountryCallingCode(49, &num_region_codes);
+  EXPECT_EQ(0U, num_region_codes);
+  index.GetRegionsForCountryCallingCode(-44, &num_region_codes);
+  EXPECT_EQ(0U, num_region_codes);
+  index.GetRegionsForCountryCallingCode(1044, &num_region_codes);
+  EXPECT_EQ(0U, num_region_codes);
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
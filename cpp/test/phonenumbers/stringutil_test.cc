@@ -302,5 +302,18 @@ TEST(StringUtilTest, StrAppend) {
   ASSERT_EQ("abcdefghijklmno42", s);
 }
 
+TEST(StringUtilTest, StrAppendDecimal) {
+  string s("+");
+  StrAppendDecimal(&s, 0);
+  ASSERT_EQ("+0", s);
+
+  StrAppendDecimal(&s, 6502530000ULL);
+  ASSERT_EQ("+06502530000", s);
+
+  s.clear();
+  StrAppendDecimal(&s, 18446744073709551615ULL);
+  ASSERT_EQ("18446744073709551615", s);
+}
+
 }  // namespace phonenumbers
 }  // namespace i18n
@@ -0,0 +1,152 @@
+// Copyright (C) 2014 The Libphonenumber Authors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "phonenumbers/template_formatter.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "phonenumbers/phonemetadata.pb.h"
+#include "phonenumbers/regexp_adapter.h"
+#include "phonenumbers/regexp_cache.h"
+#include "phonenumbers/regexp_factory.h"
+#include "phonenumbers/test_util.h"
+
+namespace i18n {
+namespace phonenumbers {
+
+using google::protobuf::RepeatedPtrField;
+using std::string;
+
+class TemplateFormatterTest : public testing::Test {
+ protected:
+  TemplateFormatterTest() : regexp_cache_(regexp_factory_, 128) {}
+
+  // Returns the number formatted with templates, or "?" if there is no
+  // template for the format.
+  string Format(const string& national_number, const NumberFormat& format,
+                bool national) const {
+    string formatted_number;
+    if (!formatter_.Format(national_number, format, national,
+                           &formatted_number)) {
+      return "?";
+    }
+    return formatted_number;
+  }
+
+  // Returns the number formatted with regular expressions, the way
+  // PhoneNumberUtil does it.
+  string FormatUsingRegExps(const string& national_number,
+                            const NumberFormat& format, bool national) {
+    string format_text(format.format());
+    if (national && !format.national_prefix_formatting_rule().empty()) {
+      regexp_cache_.GetRegExp("(\\$\\d)").Replace(
+          &format_text, format.national_prefix_formatting_rule());
+    }
+    string formatted_number(national_number);
+    regexp_cache_.GetRegExp(format.pattern()).GlobalReplace(
+        &formatted_number, format_text);
+    return formatted_number;
+  }
+
+  // Checks the templates format numbers of all the lengths the same way as
+  // the regular expressions, and returns the number of formats with
+  // templates.
+  int CheckFormats(const RepeatedPtrField<NumberFormat>& formats) {
+    int num_templates = 0;
+    for (RepeatedPtrField<NumberFormat>::const_iterator it = formats.begin();
+         it != formats.end(); ++it) {
+      string national_number;
+      if (Format(national_number, *it, false) == "?") {
+        continue;
+      }
+      ++num_templates;
+      for (int length = 0; length <= 17; ++length) {
+        SCOPED_TRACE(it->pattern() + " " + it->format() + " " +
+                     national_number);
+        EXPECT_EQ(FormatUsingRegExps(national_number, *it, false),
+                  Format(national_number, *it, false));
+        EXPECT_EQ(FormatUsingRegExps(national_number, *it, true),
+                  Format(national_number, *it, true));
+        national_number.push_back(static_cast<char>('0' + length * 3 % 10));
+      }
+    }
+    return num_templates;
+  }
+
+  const RegExpFactory regexp_factory_;
+  RegExpCache regexp_cache_;
+  const TemplateFormatter formatter_;
+};
+
+TEST_F(TemplateFormatterTest, FormatsNumbers) {
+  const NumberFormat format =
+      MakeFormat("(\\d{3})(\\d{3})(\\d{4})", "$1 $2-$3", "($1)");
+  EXPECT_EQ("650 253-0000", Format("6502530000", format, false));
+  EXPECT_EQ("(650) 253-0000", Format("6502530000", format, true));
+
+  // The national prefix formatting rule applies to the first group referred
+  // to by the format.
+  const NumberFormat second_group_first =
+      MakeFormat("(\\d)(\\d{2})(\\d{4})", "$2 15-$3", "0$1");
+  EXPECT_EQ("34 15-5678", Format("1345678", second_group_first, false));
+  EXPECT_EQ("034 15-5678", Format("1345678", second_group_first, true));
+
+  // The pattern is replaced as many times as it matches, and the digits left
+  // are kept as they are.
+  const NumberFormat short_pattern =
+      MakeFormat("(\\d{2})(\\d{2,3})", "$1 $2", "");
+  EXPECT_EQ("12 3456", Format("123456", short_pattern, true));
+  EXPECT_EQ("12 345", Format("12345", short_pattern, true));
+  EXPECT_EQ("12 34567 890", Format("1234567890", short_pattern, true));
+  EXPECT_EQ("123", Format("123", short_pattern, true));
+  EXPECT_EQ("", Format("", short_pattern, true));
+
+  // The matches don't necessarily start where the previous one ended.
+  const NumberFormat class_pattern =
+      MakeFormat("([4-9]\\d)(\\d{2})", "$1 $2", "");
+  EXPECT_EQ("0369 25", Format("036925", class_pattern, true));
+  EXPECT_EQ("45 67045 6701", Format("45670456701", class_pattern, true));
+}
+
+TEST_F(TemplateFormatterTest, DoesNotFormatWithoutTemplates) {
+  // Patterns which are not only made of groups of digits.
+  EXPECT_EQ("?", Format("2345678",
+                        MakeFormat("(\\d{3}|\\d{2})(\\d{4})", "$1 $2", ""),
+                        false));
+  EXPECT_EQ("?", Format("2345678",
+                        MakeFormat("(\\d{3})\\d(\\d{3})", "$1 $2", ""),
+                        false));
+  // Formats referring to groups which don't exist.
+  EXPECT_EQ("?", Format("2345678",
+                        MakeFormat("(\\d{3})(\\d{4})", "$1 $3", ""), false));
+  EXPECT_EQ("?", Format("2345678",
+                        MakeFormat("(\\d{3})(\\d{4})", "$1 $2", "$2 $1"),
+                        false));
+  EXPECT_EQ("?", Format("2345678",
+                        MakeFormat("(\\d{3})(\\d{4})", "$1 \\$2", ""), false));
+  // Numbers with other characters than ASCII digits.
+  EXPECT_EQ("?", Format("234567\xD9\xA8",
+                        MakeFormat("(\\d{3})(\\d{4})", "$1 $2", ""), false));
+}
+
+TEST_F(TemplateFormatterTest, AgreesWithRegExpsForAllFormats) {
+  RepeatedPtrField<NumberFormat> formats;
+  ASSERT_TRUE(GetAllNumberFormats(&formats));
+  EXPECT_LT(0, CheckFormats(formats));
+}
+
+}  // namespace phonenumbers
+}  // namespace i18n
@@ -17,12 +17,20 @@
 #include <iostream>
 #include <vector>
 
+#include "phonenumbers/metadata.h"
+#include "phonenumbers/phonemetadata.pb.h"
 #include "phonenumbers/phonenumber.pb.h"
 #include "phonenumbers/test_util.h"
 
+#if defined(I18N_PHONENUMBERS_USE_ALTERNATE_FORMATS)
+#include "phonenumbers/alternate_format.h"
+#endif
+
 using std::cout;
 using std::endl;
 
+using google::protobuf::RepeatedPtrField;
+
 namespace i18n {
 namespace phonenumbers {
 
@@ -59,5 +67,41 @@ ostream& operator<<(ostream& os, const vector<PhoneNumber>& numbers) {
   return os;
 }
 
+NumberFormat MakeFormat(const string& pattern, const string& format) {
+  NumberFormat number_format;
+  number_format.set_pattern(pattern);
+  number_format.set_format(format);
+  return number_format;
+}
+
+NumberFormat MakeFormat(const string& pattern, const string& format,
+                        const string& national_prefix_formatting_rule) {
+  NumberFormat number_format = MakeFormat(pattern, format);
+  number_format.set_national_prefix_formatting_rule(
+      national_prefix_formatting_rule);
+  return number_format;
+}
+
+bool GetAllNumberFormats(RepeatedPtrField<NumberFormat>* formats) {
+  PhoneMetadataCollection metadata_collection;
+  if (!metadata_collection.ParseFromArray(metadata_get(), metadata_size())) {
+    return false;
+  }
+#if defined(I18N_PHONENUMBERS_USE_ALTERNATE_FORMATS)
+  PhoneMetadataCollection alternate_formats;
+  if (!alternate_formats.ParseFromArray(alternate_format_get(),
+                                        alternate_format_size())) {
+    return false;
+  }
+  metadata_collection.MergeFrom(alternate_formats);
+#endif
+  for (int i = 0; i < metadata_collection.metadata_size(); ++i) {
+    const PhoneMetadata& metadata = metadata_collection.metadata(i);
+    formats->MergeFrom(metadata.number_format());
+    formats->MergeFrom(metadata.intl_number_format());
+  }
+  return true;
+}
+
 }  // namespace phonenumbers
 }  // namespace i18n
@@ -18,6 +18,7 @@
 #include <ostream>
 #include <vector>
 
+#include "phonenumbers/phonemetadata.pb.h"
 #include "phonenumbers/phonenumber.h"
 
 namespace i18n {
@@ -44,6 +45,19 @@ ostream& operator<<(ostream& os, const PhoneNumber& number);
 
 ostream& operator<<(ostream& os, const vector<PhoneNumber>& numbers);
 
+// Returns a number format with the given pattern, format and national prefix
+// formatting rule, if any.
+NumberFormat MakeFormat(const string& pattern, const string& format);
+
+NumberFormat MakeFormat(const string& pattern, const string& format,
+                        const string& national_prefix_formatting_rule);
+
+// Appends to formats the national and international number formats of all the
+// regions of the compiled-in metadata, and the alternate formats when they are
+// used. Returns false if the metadata can't be parsed.
+bool GetAllNumberFormats(
+    google::protobuf::RepeatedPtrField<NumberFormat>* formats);
+
 // Class containing string constants of region codes for easier testing. Note
 // that another private RegionCode class is defined in
 // cpp/src/phonenumbers/region_code.h. This one contains more constants.